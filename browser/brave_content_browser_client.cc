@@ -214,6 +214,7 @@ using extensions::ChromeContentBrowserClientExtensionsPart;
 
 #if BUILDFLAG(ENABLE_PLAYLIST_WEBUI)
 #include "brave/browser/ui/webui/playlist_ui.h"
+#include "brave/components/playlist/browser/playlist_data_url_loader_factory.h"
 #endif  // BUILDFLAG(ENABLE_PLAYLIST_WEBUI)
 
 namespace {
@@ -510,6 +511,41 @@ void BraveContentBrowserClient::RegisterWebUIInterfaceBrokers(
 #endif
 }
 
+void BraveContentBrowserClient::RegisterNonNetworkSubresourceURLLoaderFactories(
+    int render_process_id,
+    int render_frame_id,
+    const absl::optional<url::Origin>& request_initiator_origin,
+    NonNetworkURLLoaderFactoryMap* factories) {
+  ChromeContentBrowserClient::RegisterNonNetworkSubresourceURLLoaderFactories(
+      render_process_id, render_frame_id, request_initiator_origin, factories);
+
+#if BUILDFLAG(ENABLE_PLAYLIST_WEBUI)
+  // Playlist pages load cached media from chrome-untrusted://playlist-data/,
+  // which is streamed from disk instead of going through a URLDataSource.
+  if (!request_initiator_origin ||
+      request_initiator_origin->scheme() != content::kChromeUIUntrustedScheme ||
+      (request_initiator_origin->host() != kPlaylistHost &&
+       request_initiator_origin->host() != kPlaylistPlayerHost)) {
+    return;
+  }
+
+  auto* render_process_host =
+      content::RenderProcessHost::FromID(render_process_id);
+  if (!render_process_host)
+    return;
+
+  auto* playlist_service =
+      playlist::PlaylistServiceFactory::GetForBrowserContext(
+          render_process_host->GetBrowserContext());
+  if (!playlist_service)
+    return;
+
+  auto& factory = (*factories)[content::kChromeUIUntrustedScheme];
+  factory = playlist::PlaylistDataURLLoaderFactory::Create(
+      playlist_service->GetWeakPtr(), std::move(factory));
+#endif  // BUILDFLAG(ENABLE_PLAYLIST_WEBUI)
+}
+
 bool BraveContentBrowserClient::AllowWorkerFingerprinting(
     const GURL& url,
     content::BrowserContext* browser_context) {
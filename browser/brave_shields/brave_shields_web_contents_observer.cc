@@ -9,6 +9,7 @@
 #include <string>
 #include <utility>
 
+#include "base/containers/contains.h"
 #include "base/containers/cxx20_erase_vector.h"
 #include "base/feature_list.h"
 #include "base/strings/utf_string_conversions.h"
@@ -44,6 +45,24 @@ namespace {
 
 BraveShieldsWebContentsObserver* g_receiver_impl_for_testing = nullptr;
 
+constexpr base::TimeDelta kBlockedEventsFlushDelay = base::Seconds(1);
+base::TimeDelta g_blocked_events_flush_delay = kBlockedEventsFlushDelay;
+
+// Returns the name of the profile pref counting |block_type| events, or null
+// if such events aren't counted.
+const char* GetBlockedCountPrefName(const std::string& block_type) {
+  if (block_type == kAds) {
+    return kAdsBlocked;
+  } else if (block_type == kHTTPUpgradableResources) {
+    return kHttpsUpgrades;
+  } else if (block_type == kJavaScript) {
+    return kJavascriptBlocked;
+  } else if (block_type == kFingerprintingV2) {
+    return kFingerprintingBlocked;
+  }
+  return nullptr;
+}
+
 }  // namespace
 
 BraveShieldsWebContentsObserver::~BraveShieldsWebContentsObserver() {
@@ -89,7 +108,7 @@ void BraveShieldsWebContentsObserver::RenderFrameHostChanged(
 
 bool BraveShieldsWebContentsObserver::IsBlockedSubresource(
     const std::string& subresource) {
-  return blocked_url_paths_.find(subresource) != blocked_url_paths_.end();
+  return base::Contains(blocked_url_paths_, subresource);
 }
 
 void BraveShieldsWebContentsObserver::AddBlockedSubresource(
@@ -97,6 +116,52 @@ void BraveShieldsWebContentsObserver::AddBlockedSubresource(
   blocked_url_paths_.insert(subresource);
 }
 
+void BraveShieldsWebContentsObserver::RecordBlockedEvent(
+    const std::string& block_type,
+    const std::string& subresource) {
+  // Only the first block of a given URL on the current page is counted.
+  if (blocked_url_paths_.insert(subresource).second) {
+    if (const char* pref_name = GetBlockedCountPrefName(block_type))
+      ++pending_blocked_counts_[pref_name];
+  }
+  pending_blocked_events_.emplace_back(block_type, subresource);
+
+  if (g_blocked_events_flush_delay.is_zero()) {
+    FlushBlockedEvents();
+    return;
+  }
+  if (!flush_timer_.IsRunning()) {
+    flush_timer_.Start(FROM_HERE, g_blocked_events_flush_delay, this,
+                       &BraveShieldsWebContentsObserver::FlushBlockedEvents);
+  }
+}
+
+void BraveShieldsWebContentsObserver::FlushBlockedEvents() {
+  flush_timer_.Stop();
+
+  if (!pending_blocked_counts_.empty()) {
+    PrefService* prefs =
+        Profile::FromBrowserContext(web_contents()->GetBrowserContext())
+            ->GetOriginalProfile()
+            ->GetPrefs();
+    for (const auto& [pref_name, count] : pending_blocked_counts_)
+      prefs->SetUint64(pref_name, prefs->GetUint64(pref_name) + count);
+    pending_blocked_counts_.clear();
+  }
+
+  if (!pending_blocked_events_.empty()) {
+    BlockedEvents events;
+    events.swap(pending_blocked_events_);
+    DispatchBlockedEventsForWebContents(events, web_contents());
+  }
+}
+
+// static
+void BraveShieldsWebContentsObserver::SetBlockedEventsFlushDelayForTesting(
+    base::TimeDelta delay) {
+  g_blocked_events_flush_delay = delay;
+}
+
 // static
 void BraveShieldsWebContentsObserver::BindBraveShieldsHost(
     mojo::PendingAssociatedReceiver<brave_shields::mojom::BraveShieldsHost>
@@ -128,30 +193,14 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEvent(
   auto subresource = request_url.spec();
   WebContents* web_contents =
       WebContents::FromFrameTreeNodeId(frame_tree_node_id);
-  DispatchBlockedEventForWebContents(block_type, subresource, web_contents);
-
-  if (web_contents) {
-    BraveShieldsWebContentsObserver* observer =
-        BraveShieldsWebContentsObserver::FromWebContents(web_contents);
-    if (observer && !observer->IsBlockedSubresource(subresource)) {
-      observer->AddBlockedSubresource(subresource);
-      PrefService* prefs =
-          Profile::FromBrowserContext(web_contents->GetBrowserContext())
-              ->GetOriginalProfile()
-              ->GetPrefs();
-
-      if (block_type == kAds) {
-        prefs->SetUint64(kAdsBlocked, prefs->GetUint64(kAdsBlocked) + 1);
-      } else if (block_type == kHTTPUpgradableResources) {
-        prefs->SetUint64(kHttpsUpgrades, prefs->GetUint64(kHttpsUpgrades) + 1);
-      } else if (block_type == kJavaScript) {
-        prefs->SetUint64(kJavascriptBlocked,
-                         prefs->GetUint64(kJavascriptBlocked) + 1);
-      } else if (block_type == kFingerprintingV2) {
-        prefs->SetUint64(kFingerprintingBlocked,
-                         prefs->GetUint64(kFingerprintingBlocked) + 1);
-      }
-    }
+  BraveShieldsWebContentsObserver* observer =
+      web_contents
+          ? BraveShieldsWebContentsObserver::FromWebContents(web_contents)
+          : nullptr;
+  if (observer) {
+    observer->RecordBlockedEvent(block_type, subresource);
+  } else {
+    DispatchBlockedEventForWebContents(block_type, subresource, web_contents);
   }
   brave_perf_predictor::PerfPredictorTabHelper::DispatchBlockedEvent(
       request_url.spec(), frame_tree_node_id);
@@ -174,6 +223,20 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
   shields_data_ctrlr->HandleItemBlocked(block_type, subresource);
 }
 // static
+void BraveShieldsWebContentsObserver::DispatchBlockedEventsForWebContents(
+    const BlockedEvents& events,
+    WebContents* web_contents) {
+  if (!web_contents) {
+    return;
+  }
+  auto* shields_data_ctrlr =
+      brave_shields::BraveShieldsDataController::FromWebContents(web_contents);
+  if (!shields_data_ctrlr) {
+    return;
+  }
+  shields_data_ctrlr->HandleItemsBlocked(events);
+}
+// static
 void BraveShieldsWebContentsObserver::DispatchAllowedOnceEventForWebContents(
     const std::string& block_type,
     const std::string& subresource,
@@ -231,6 +294,8 @@ void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
   content::ReloadType reload_type = navigation_handle->GetReloadType();
   if (navigation_handle->IsInMainFrame() &&
       !navigation_handle->IsSameDocument()) {
+    // Report whatever the previous page blocked before forgetting about it.
+    FlushBlockedEvents();
     if (reload_type == content::ReloadType::NONE) {
       // For new loads, we reset the counters for both blocked scripts and URLs.
       allowed_scripts_.clear();
@@ -256,6 +321,17 @@ void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
       });
 }
 
+void BraveShieldsWebContentsObserver::DidFinishLoad(
+    content::RenderFrameHost* render_frame_host,
+    const GURL& validated_url) {
+  if (render_frame_host->IsInPrimaryMainFrame())
+    FlushBlockedEvents();
+}
+
+void BraveShieldsWebContentsObserver::WebContentsDestroyed() {
+  FlushBlockedEvents();
+}
+
 void BraveShieldsWebContentsObserver::BlockAllowedScripts(
     const std::vector<std::string>& scripts) {
   for (const auto& script : scripts) {
@@ -7,12 +7,15 @@
 #define BRAVE_BROWSER_BRAVE_SHIELDS_BRAVE_SHIELDS_WEB_CONTENTS_OBSERVER_H_
 
 #include <map>
-#include <set>
 #include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/synchronization/lock.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/brave_shields/common/brave_shields.mojom.h"
 #include "content/public/browser/render_frame_host_receiver_set.h"
 #include "content/public/browser/web_contents_observer.h"
@@ -31,6 +34,9 @@ class BraveShieldsWebContentsObserver
       public content::WebContentsUserData<BraveShieldsWebContentsObserver>,
       public brave_shields::mojom::BraveShieldsHost {
  public:
+  // Pairs of (block type, subresource URL spec).
+  using BlockedEvents = std::vector<std::pair<std::string, std::string>>;
+
   explicit BraveShieldsWebContentsObserver(content::WebContents*);
   BraveShieldsWebContentsObserver(const BraveShieldsWebContentsObserver&) =
       delete;
@@ -48,6 +54,9 @@ class BraveShieldsWebContentsObserver
       const std::string& block_type,
       const std::string& subresource,
       content::WebContents* web_contents);
+  static void DispatchBlockedEventsForWebContents(
+      const BlockedEvents& events,
+      content::WebContents* web_contents);
   static void DispatchAllowedOnceEventForWebContents(
       const std::string& block_type,
       const std::string& subresource,
@@ -61,6 +70,11 @@ class BraveShieldsWebContentsObserver
   bool IsBlockedSubresource(const std::string& subresource);
   void AddBlockedSubresource(const std::string& subresource);
 
+  // Blocked events are accumulated per tab and flushed to the profile prefs
+  // and the shields panel after this delay, or earlier when the page finishes
+  // loading or navigates away. A zero delay flushes every event right away.
+  static void SetBlockedEventsFlushDelayForTesting(base::TimeDelta delay);
+
  protected:
   // content::WebContentsObserver overrides.
   void RenderFrameCreated(content::RenderFrameHost* host) override;
@@ -69,6 +83,9 @@ class BraveShieldsWebContentsObserver
                               content::RenderFrameHost* new_host) override;
   void ReadyToCommitNavigation(
       content::NavigationHandle* navigation_handle) override;
+  void DidFinishLoad(content::RenderFrameHost* render_frame_host,
+                     const GURL& validated_url) override;
+  void WebContentsDestroyed() override;
 
   // brave_shields::mojom::BraveShieldsHost.
   void OnJavaScriptBlocked(const std::u16string& details) override;
@@ -98,10 +115,20 @@ class BraveShieldsWebContentsObserver
   mojo::AssociatedRemote<brave_shields::mojom::BraveShields>&
   GetBraveShieldsRemote(content::RenderFrameHost* rfh);
 
+  void RecordBlockedEvent(const std::string& block_type,
+                          const std::string& subresource);
+  void FlushBlockedEvents();
+
   std::vector<std::string> allowed_scripts_;
   // We keep a set of the current page's blocked URLs in case the page
   // continually tries to load the same blocked URLs.
-  std::set<std::string> blocked_url_paths_;
+  std::unordered_set<std::string> blocked_url_paths_;
+
+  // Blocked counters not yet added to the profile prefs, keyed by pref name.
+  base::flat_map<std::string, uint64_t> pending_blocked_counts_;
+  // Blocked events not yet reported to the shields panel.
+  BlockedEvents pending_blocked_events_;
+  base::OneShotTimer flush_timer_;
 
   content::RenderFrameHostReceiverSet<brave_shields::mojom::BraveShieldsHost>
       receivers_;
@@ -32,4 +32,13 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEventForWebContents(
       tabId, block_type, subresource);
 }
 
+// static
+void BraveShieldsWebContentsObserver::DispatchBlockedEventsForWebContents(
+    const BlockedEvents& events,
+    WebContents* web_contents) {
+  for (const auto& [block_type, subresource] : events) {
+    DispatchBlockedEventForWebContents(block_type, subresource, web_contents);
+  }
+}
+
 }  // namespace brave_shields
@@ -10,7 +10,11 @@
 
 #include "base/containers/contains.h"
 #include "base/functional/bind.h"
+#include "base/json/json_reader.h"
 #include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
 #include "base/test/bind.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/eth_nonce_tracker.h"
@@ -63,12 +67,74 @@ class EthPendingTxTrackerUnitTest : public testing::Test {
 
   void WaitForResponse() { task_environment_.RunUntilIdle(); }
 
+  // Fake RPC server which answers every request of a eth_getTransactionReceipt
+  // batch with |receipt_json| and counts the requests it received.
+  void SetReceiptsInterceptor(const std::string& receipt_json) {
+    url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+        [&, receipt_json](const network::ResourceRequest& request) {
+          ++requests_count_;
+          base::StringPiece request_string(request.request_body->elements()
+                                               ->at(0)
+                                               .As<network::DataElementBytes>()
+                                               .AsStringPiece());
+          auto batch = base::JSONReader::Read(request_string);
+          ASSERT_TRUE(batch && batch->is_list());
+          std::vector<std::string> responses;
+          for (const auto& item : batch->GetList()) {
+            const auto id = item.GetDict().FindInt("id");
+            ASSERT_TRUE(id);
+            responses.push_back(base::StringPrintf(
+                R"({"jsonrpc":"2.0","id":%d,"result":%s})", *id,
+                receipt_json.c_str()));
+          }
+          url_loader_factory_.ClearResponses();
+          url_loader_factory_.AddResponse(
+              request.url.spec(),
+              base::StrCat({"[", base::JoinString(responses, ","), "]"}));
+        }));
+  }
+
+  // Fake RPC server which rejects batch requests like some custom networks do
+  // and answers single eth_getTransactionReceipt requests with |receipt_json|.
+  void SetNoBatchReceiptsInterceptor(const std::string& receipt_json) {
+    url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+        [&, receipt_json](const network::ResourceRequest& request) {
+          ++requests_count_;
+          base::StringPiece request_string(request.request_body->elements()
+                                               ->at(0)
+                                               .As<network::DataElementBytes>()
+                                               .AsStringPiece());
+          auto request_value = base::JSONReader::Read(request_string);
+          ASSERT_TRUE(request_value);
+          url_loader_factory_.ClearResponses();
+          if (request_value->is_list()) {
+            ++batch_requests_count_;
+            url_loader_factory_.AddResponse(
+                request.url.spec(),
+                R"({"jsonrpc":"2.0","id":null,"error":)"
+                R"({"code":-32600,"message":"Batch requests not supported"}})");
+            return;
+          }
+          const auto id = request_value->GetDict().FindInt("id");
+          ASSERT_TRUE(id);
+          url_loader_factory_.AddResponse(
+              request.url.spec(),
+              base::StringPrintf(R"({"jsonrpc":"2.0","id":%d,"result":%s})",
+                                 *id, receipt_json.c_str()));
+        }));
+  }
+
+  size_t requests_count() const { return requests_count_; }
+  size_t batch_requests_count() const { return batch_requests_count_; }
+
  private:
   network::TestURLLoaderFactory url_loader_factory_;
   scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
   content::BrowserTaskEnvironment task_environment_;
   std::unique_ptr<TestingProfile> profile_;
   data_decoder::test::InProcessDataDecoder in_process_data_decoder_;
+  size_t requests_count_ = 0;
+  size_t batch_requests_count_ = 0;
 };
 
 TEST_F(EthPendingTxTrackerUnitTest, IsNonceTaken) {
@@ -196,27 +262,20 @@ TEST_F(EthPendingTxTrackerUnitTest, UpdatePendingTransactions) {
     tx_state_manager.AddOrUpdateTx(meta);
   }
 
-  test_url_loader_factory()->SetInterceptor(
-      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
-        test_url_loader_factory()->AddResponse(
-            request.url.spec(),
-            "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":{"
-            "\"transactionHash\":"
-            "\"0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce5682"
-            "38\","
-            "\"transactionIndex\":  \"0x1\","
-            "\"blockNumber\": \"0xb\","
-            "\"blockHash\": "
-            "\"0xc6ef2fc5426d6ad6fd9e2a26abeab0aa2411b7ab17f30a99d3cb96aed1d105"
-            "5b\","
-            "\"cumulativeGasUsed\": \"0x33bc\","
-            "\"gasUsed\": \"0x4dc\","
-            "\"contractAddress\": "
-            "\"0xb60e8dd61c5d32be8058bb8eb970870f07233155\","
-            "\"logs\": [],"
-            "\"logsBloom\": \"0x00...0\","
-            "\"status\": \"0x1\"}}");
-      }));
+  SetReceiptsInterceptor(
+      "{\"transactionHash\":"
+      "\"0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238\","
+      "\"transactionIndex\":  \"0x1\","
+      "\"blockNumber\": \"0xb\","
+      "\"blockHash\": "
+      "\"0xc6ef2fc5426d6ad6fd9e2a26abeab0aa2411b7ab17f30a99d3cb96aed1d1055b\","
+      "\"cumulativeGasUsed\": \"0x33bc\","
+      "\"gasUsed\": \"0x4dc\","
+      "\"contractAddress\": "
+      "\"0xb60e8dd61c5d32be8058bb8eb970870f07233155\","
+      "\"logs\": [],"
+      "\"logsBloom\": \"0x00...0\","
+      "\"status\": \"0x1\"}");
 
   for (const std::string& chain_id :
        {mojom::kMainnetChainId, mojom::kGoerliChainId,
@@ -249,4 +308,98 @@ TEST_F(EthPendingTxTrackerUnitTest, UpdatePendingTransactions) {
   }
 }
 
+TEST_F(EthPendingTxTrackerUnitTest, BatchesReceiptRequests) {
+  JsonRpcService service(shared_url_loader_factory(), GetPrefs());
+  EthTxStateManager tx_state_manager(GetPrefs());
+  EthNonceTracker nonce_tracker(&tx_state_manager, &service);
+  EthPendingTxTracker pending_tx_tracker(&tx_state_manager, &service,
+                                         &nonce_tracker);
+  WaitForResponse();
+
+  constexpr size_t kPendingTxCount = 20;
+  for (size_t i = 0; i < kPendingTxCount; ++i) {
+    EthTxMeta meta;
+    meta.set_id(base::NumberToString(i));
+    meta.set_chain_id(mojom::kMainnetChainId);
+    meta.set_from(
+        EthAddress::FromHex("0x2f015c60e0be116b1f0cd534704db9c92118fb6a")
+            .ToChecksumAddress());
+    meta.tx()->set_nonce(uint256_t(i));
+    meta.set_status(mojom::TransactionStatus::Submitted);
+    tx_state_manager.AddOrUpdateTx(meta);
+  }
+
+  // Transactions are still pending, receipts are not available.
+  SetReceiptsInterceptor("null");
+
+  // Block tracker ticks every kBlockTrackerDefaultTimeInSeconds, so this is a
+  // minute worth of blocks.
+  const size_t blocks_per_minute =
+      static_cast<size_t>(60 / kBlockTrackerDefaultTimeInSeconds);
+  for (size_t i = 0; i < blocks_per_minute; ++i) {
+    std::set<std::string> pending_chain_ids;
+    EXPECT_TRUE(pending_tx_tracker.UpdatePendingTransactions(
+        mojom::kMainnetChainId, &pending_chain_ids));
+    WaitForResponse();
+  }
+
+  // One request per block regardless of number of pending transactions.
+  EXPECT_EQ(requests_count(), blocks_per_minute);
+  EXPECT_EQ(tx_state_manager
+                .GetTransactionsByStatus(mojom::kMainnetChainId,
+                                         mojom::TransactionStatus::Submitted,
+                                         absl::nullopt)
+                .size(),
+            kPendingTxCount);
+}
+
+TEST_F(EthPendingTxTrackerUnitTest, FallsBackToSingleReceiptRequests) {
+  JsonRpcService service(shared_url_loader_factory(), GetPrefs());
+  EthTxStateManager tx_state_manager(GetPrefs());
+  EthNonceTracker nonce_tracker(&tx_state_manager, &service);
+  EthPendingTxTracker pending_tx_tracker(&tx_state_manager, &service,
+                                         &nonce_tracker);
+  WaitForResponse();
+
+  constexpr size_t kPendingTxCount = 3;
+  for (size_t i = 0; i < kPendingTxCount; ++i) {
+    EthTxMeta meta;
+    meta.set_id(base::NumberToString(i));
+    meta.set_chain_id(mojom::kMainnetChainId);
+    meta.set_from(
+        EthAddress::FromHex("0x2f015c60e0be116b1f0cd534704db9c92118fb6a")
+            .ToChecksumAddress());
+    meta.tx()->set_nonce(uint256_t(i));
+    meta.set_status(mojom::TransactionStatus::Submitted);
+    tx_state_manager.AddOrUpdateTx(meta);
+  }
+
+  SetNoBatchReceiptsInterceptor(
+      R"({"transactionHash":)"
+      R"("0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238",)"
+      R"("transactionIndex":"0x1","blockNumber":"0xb",)"
+      R"("blockHash":)"
+      R"("0xc6ef2fc5426d6ad6fd9e2a26abeab0aa2411b7ab17f30a99d3cb96aed1d1055b",)"
+      R"("cumulativeGasUsed":"0x33bc","gasUsed":"0x4dc",)"
+      R"("contractAddress":"0xb60e8dd61c5d32be8058bb8eb970870f07233155",)"
+      R"("logs":[],"logsBloom":"0x00...0","status":"0x1"})");
+
+  std::set<std::string> pending_chain_ids;
+  EXPECT_TRUE(pending_tx_tracker.UpdatePendingTransactions(
+      mojom::kMainnetChainId, &pending_chain_ids));
+  WaitForResponse();
+
+  // The rejected batch is followed by one request per pending transaction.
+  EXPECT_EQ(batch_requests_count(), 1u);
+  EXPECT_EQ(requests_count(), kPendingTxCount + 1);
+  for (size_t i = 0; i < kPendingTxCount; ++i) {
+    auto meta = tx_state_manager.GetEthTx(mojom::kMainnetChainId,
+                                          base::NumberToString(i));
+    ASSERT_NE(meta, nullptr);
+    EXPECT_EQ(meta->status(), mojom::TransactionStatus::Confirmed);
+    EXPECT_EQ(meta->tx_receipt().contract_address,
+              "0xb60e8dd61c5d32be8058bb8eb970870f07233155");
+  }
+}
+
 }  // namespace brave_wallet
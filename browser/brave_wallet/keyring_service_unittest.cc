@@ -15,6 +15,7 @@
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/test/values_test_util.h"
+#include "base/time/time.h"
 #include "brave/browser/brave_wallet/json_rpc_service_factory.h"
 #include "brave/components/brave_wallet/browser/blockchain_registry.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
@@ -24,6 +25,7 @@
 #include "brave/components/brave_wallet/browser/filecoin_keyring.h"
 #include "brave/components/brave_wallet/browser/hd_keyring.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
+#include "brave/components/brave_wallet/browser/password_encryptor.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/features.h"
@@ -1208,6 +1210,138 @@ TEST_F(KeyringServiceUnitTest, UnlockResumesDefaultKeyring) {
   }
 }
 
+TEST_F(KeyringServiceUnitTest, UnlockDerivesKeysOffUIThread) {
+  if (!base::ThreadTicks::IsSupported()) {
+    return;
+  }
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitWithFeatures({features::kBraveWalletFilecoinFeature,
+                                 features::kBraveWalletSolanaFeature},
+                                {});
+  {
+    KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+    ASSERT_TRUE(CreateWallet(&service, "brave"));
+  }
+
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  ASSERT_TRUE(service.IsLockedSync());
+
+  // Cost of a single key derivation with production iterations count.
+  base::ThreadTicks start = base::ThreadTicks::Now();
+  ASSERT_TRUE(PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
+      "brave", std::vector<uint8_t>(32), 310000, 256));
+  const base::TimeDelta single_derivation = base::ThreadTicks::Now() - start;
+
+  bool callback_called = false;
+  bool success = false;
+  base::RunLoop run_loop;
+  start = base::ThreadTicks::Now();
+  service.Unlock("brave", base::BindLambdaForTesting([&](bool v) {
+                   callback_called = true;
+                   success = v;
+                   run_loop.Quit();
+                 }));
+  const base::TimeDelta ui_thread_time = base::ThreadTicks::Now() - start;
+
+  // Derivation for every keyring happens on the thread pool so Unlock returns
+  // before any key is ready and UI thread doesn't pay for PBKDF2.
+  EXPECT_FALSE(callback_called);
+  EXPECT_TRUE(service.IsLockedSync());
+  EXPECT_LT(ui_thread_time, single_derivation / 2);
+
+  run_loop.Run();
+  EXPECT_TRUE(success);
+  EXPECT_FALSE(service.IsLocked(mojom::kDefaultKeyringId));
+  EXPECT_FALSE(service.IsLocked(mojom::kSolanaKeyringId));
+}
+
+TEST_F(KeyringServiceUnitTest, UnlockWithWrongPasswordKeepsAllKeyringsLocked) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitWithFeatures({features::kBraveWalletFilecoinFeature,
+                                 features::kBraveWalletSolanaFeature},
+                                {});
+  {
+    KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+    ASSERT_TRUE(CreateWallet(&service, "brave"));
+  }
+
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  ASSERT_TRUE(service.IsKeyringCreated(mojom::kSolanaKeyringId));
+  ASSERT_TRUE(service.IsLockedSync());
+
+  EXPECT_FALSE(Unlock(&service, "brave123"));
+  EXPECT_TRUE(service.IsLockedSync());
+  EXPECT_TRUE(service.IsLocked(mojom::kDefaultKeyringId));
+  EXPECT_TRUE(service.IsLocked(mojom::kSolanaKeyringId));
+  // Encryptors derived from the wrong password are not kept for keyrings
+  // which are created lazily either.
+  EXPECT_TRUE(service.encryptors_.empty());
+
+  EXPECT_TRUE(Unlock(&service, "brave"));
+  EXPECT_FALSE(service.IsLocked(mojom::kDefaultKeyringId));
+  EXPECT_FALSE(service.IsLocked(mojom::kSolanaKeyringId));
+  EXPECT_TRUE(service.encryptors_.contains(mojom::kFilecoinKeyringId));
+}
+
+TEST_F(KeyringServiceUnitTest, LockDuringPendingUnlock) {
+  {
+    KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+    ASSERT_TRUE(CreateWallet(&service, "brave"));
+  }
+
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  ASSERT_TRUE(service.IsLockedSync());
+
+  int callback_count = 0;
+  bool success = true;
+  service.Unlock("brave", base::BindLambdaForTesting([&](bool v) {
+                   ++callback_count;
+                   success = v;
+                 }));
+  EXPECT_EQ(callback_count, 0);
+
+  // Locking fails the pending unlock right away.
+  service.Lock();
+  EXPECT_EQ(callback_count, 1);
+  EXPECT_FALSE(success);
+
+  // Keys derived for it don't unlock the wallet.
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(callback_count, 1);
+  EXPECT_TRUE(service.IsLockedSync());
+
+  EXPECT_TRUE(Unlock(&service, "brave"));
+  EXPECT_FALSE(service.IsLockedSync());
+}
+
+TEST_F(KeyringServiceUnitTest, UnlockWhileUnlockPending) {
+  {
+    KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+    ASSERT_TRUE(CreateWallet(&service, "brave"));
+  }
+
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  ASSERT_TRUE(service.IsLockedSync());
+
+  absl::optional<bool> first_result;
+  base::RunLoop run_loop;
+  service.Unlock("brave", base::BindLambdaForTesting([&](bool v) {
+                   first_result = v;
+                   run_loop.Quit();
+                 }));
+
+  // The second attempt is rejected while the first one derives keys.
+  absl::optional<bool> second_result;
+  service.Unlock("brave", base::BindLambdaForTesting(
+                              [&](bool v) { second_result = v; }));
+  EXPECT_EQ(second_result, false);
+  EXPECT_FALSE(first_result);
+
+  run_loop.Run();
+  EXPECT_EQ(first_result, true);
+  EXPECT_FALSE(service.IsLockedSync());
+}
+
 TEST_F(KeyringServiceUnitTest, GetMnemonicForDefaultKeyring) {
   // Needed to skip unnecessary migration in CreateEncryptorForKeyring.
   GetPrefs()->SetBoolean(kBraveWalletKeyringEncryptionKeysMigrated, true);
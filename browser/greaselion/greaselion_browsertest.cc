@@ -29,7 +29,6 @@
 #include "components/prefs/pref_service.h"
 #include "content/public/test/browser_test.h"
 #include "content/public/test/browser_test_utils.h"
-#include "extensions/common/file_util.h"
 #include "ui/base/ui_base_switches.h"
 
 using brave_rewards::RewardsService;
@@ -513,7 +512,10 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, FoldersAreRemovedOnUpdate) {
   auto io_runner = base::ThreadPool::CreateSequencedTaskRunner(
       {base::MayBlock(), base::TaskShutdownBehavior::BLOCK_SHUTDOWN});
 
-  auto count_folders_on_io_runner = [&io_runner]() {
+  const base::FilePath install_dir =
+      GreaselionServiceFactory::GetInstallDirectory(profile());
+
+  auto count_folders_on_io_runner = [&io_runner, &install_dir]() {
     base::RunLoop run_loop;
     size_t folder_count;
 
@@ -522,12 +524,9 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, FoldersAreRemovedOnUpdate) {
       run_loop.Quit();
     };
 
-    auto count_folders = []() {
-      base::FilePath install_dir =
-          GreaselionServiceFactory::GetInstallDirectory();
-
-      base::FilePath extensions_dir =
-          extensions::file_util::GetInstallTempDir(install_dir);
+    auto count_folders = [](const base::FilePath& install_dir) {
+      // Generated extensions are cached by the hash of their rule.
+      base::FilePath extensions_dir = install_dir.AppendASCII("Cache");
 
       base::FileEnumerator enumerator(extensions_dir, false,
                                       base::FileEnumerator::DIRECTORIES);
@@ -540,7 +539,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, FoldersAreRemovedOnUpdate) {
     };
 
     io_runner->PostTaskAndReplyWithResult(
-        FROM_HERE, base::BindOnce(count_folders),
+        FROM_HERE, base::BindOnce(count_folders, install_dir),
         base::BindLambdaForTesting(set_folder_count));
 
     run_loop.Run();
@@ -9,13 +9,12 @@
 #include <string>
 
 #include "base/memory/singleton.h"
-#include "base/path_service.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/components/greaselion/browser/greaselion_service.h"
 #include "brave/components/greaselion/browser/greaselion_service_impl.h"
-#include "chrome/common/chrome_paths.h"
 #include "components/keyed_service/content/browser_context_dependency_manager.h"
 #include "components/keyed_service/core/keyed_service.h"
+#include "content/public/browser/browser_context.h"
 #include "extensions/browser/extension_file_task_runner.h"
 #include "extensions/browser/extension_registry.h"
 #include "extensions/browser/extension_registry_factory.h"
@@ -36,10 +35,9 @@ GreaselionService* GreaselionServiceFactory::GetForBrowserContext(
       GetInstance()->GetServiceForBrowserContext(context, true));
 }
 
-base::FilePath GreaselionServiceFactory::GetInstallDirectory() {
-  base::FilePath install_directory;
-  base::PathService::Get(chrome::DIR_USER_DATA, &install_directory);
-  return install_directory.AppendASCII("Greaselion");
+base::FilePath GreaselionServiceFactory::GetInstallDirectory(
+    content::BrowserContext* context) {
+  return context->GetPath().AppendASCII("Greaselion");
 }
 
 GreaselionServiceFactory::GreaselionServiceFactory()
@@ -68,7 +66,7 @@ KeyedService* GreaselionServiceFactory::BuildServiceInstanceFor(
   if (g_brave_browser_process)
     download_service = g_brave_browser_process->greaselion_download_service();
   std::unique_ptr<GreaselionServiceImpl> greaselion_service(
-      new GreaselionServiceImpl(download_service, GetInstallDirectory(),
+      new GreaselionServiceImpl(download_service, GetInstallDirectory(context),
                                 extension_system, extension_registry,
                                 task_runner));
   return greaselion_service.release();
@@ -24,7 +24,9 @@ class GreaselionServiceFactory : public BrowserContextKeyedServiceFactory {
       content::BrowserContext* context);
   static GreaselionServiceFactory* GetInstance();
 
-  static base::FilePath GetInstallDirectory();
+  // Generated extensions are kept per profile, so that a profile only ever
+  // removes its own.
+  static base::FilePath GetInstallDirectory(content::BrowserContext* context);
 
  private:
   friend struct base::DefaultSingletonTraits<GreaselionServiceFactory>;
@@ -0,0 +1,68 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <vector>
+
+#include "base/time/time.h"
+#include "base/timer/lap_timer.h"
+#include "brave/browser/net/brave_query_filter.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
+
+namespace {
+
+constexpr char kMetricPrefixQueryFilter[] = "BraveQueryFilter.";
+constexpr char kMetricFilterTime[] = "filter_time";
+
+constexpr int kWarmupRuns = 5;
+constexpr int kTimeCheckInterval = 10;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixQueryFilter, story);
+  reporter.RegisterImportantMetric(kMetricFilterTime, "us");
+  return reporter;
+}
+
+}  // namespace
+
+// Filters a corpus of navigation URLs, most of them with trackers.
+TEST(BraveQueryFilterPerfTest, FilterCorpusOfNavigationURLs) {
+  const std::vector<GURL> urls = {
+      GURL("https://www.google.com/search?q=brave+browser&oq=brave&sourceid="
+           "chrome&ie=UTF-8"),
+      GURL("https://www.example.com/landing?utm_source=newsletter&utm_medium="
+           "email&fbclid=IwAR2x9mK3&ref=home"),
+      GURL("https://shop.example.co.uk/product/123?gclid=Cj0KCQjw&color=red&"
+           "size=m"),
+      GURL("https://www.instagram.com/p/Cabc123/?igshid=YmMyMTA2M2Y="),
+      GURL("https://twitter.com/brave/status/1?ref_src=twsrc%5Etfw&ref_url="
+           "https%3A%2F%2Fexample.com%2F"),
+      GURL("https://news.example.org/2023/01/article.html"),
+      GURL("https://go.example.com/unsubscribe?mkt_tok=MTM4LUVaTS0wNDIAAAGA"),
+      GURL("https://www.example.net/?_hsenc=p2ANqtz&_hsmi=2&__hssc=1.2.3&"
+           "__hstc=4.5.6&__hsfp=7"),
+      GURL("https://video.example.com/watch?v=dQw4w9WgXcQ&t=42s&list=PL1"),
+      GURL("https://mail.example.com/track?mc_eid=abc&mc_cid=def&vero_id=1&"
+           "vero_conv=2&yclid=3&msclkid=4&dclid=5&wbraid=6&gbraid=7"),
+  };
+
+  size_t filtered = 0;
+  base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    for (const GURL& url : urls) {
+      if (ApplyQueryFilter(url))
+        ++filtered;
+    }
+    timer.NextLap();
+  } while (!timer.HasTimeLimitExpired());
+  EXPECT_GT(filtered, 0u);
+
+  auto reporter = SetUpReporter("navigation_urls");
+  reporter.AddResult(kMetricFilterTime,
+                     timer.TimePerLap() / static_cast<int>(urls.size()));
+}
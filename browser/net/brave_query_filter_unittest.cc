@@ -5,6 +5,8 @@
 
 #include "brave/browser/net/brave_query_filter.h"
 
+#include <vector>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
@@ -25,3 +27,69 @@ TEST(BraveQueryFilter, FilterQueryTrackers) {
   EXPECT_FALSE(ApplyQueryFilter(GURL("https://test.com/")));
   EXPECT_FALSE(ApplyQueryFilter(GURL()));
 }
+
+TEST(BraveQueryFilter, FilterScopedQueryTrackers) {
+  EXPECT_EQ(ApplyQueryFilter(GURL("https://instagram.com/p/1/?igshid=123")),
+            GURL("https://instagram.com/p/1/"));
+  EXPECT_EQ(
+      ApplyQueryFilter(GURL("https://www.instagram.com/p/1/?igshid=123&a=b")),
+      GURL("https://www.instagram.com/p/1/?a=b"));
+  EXPECT_FALSE(ApplyQueryFilter(GURL("https://test.com/?igshid=123")));
+  EXPECT_FALSE(ApplyQueryFilter(GURL("https://notinstagram.com/?igshid=1")));
+  EXPECT_EQ(
+      ApplyQueryFilter(GURL("https://twitter.com/a/status/1?ref_src=twsrc")),
+      GURL("https://twitter.com/a/status/1"));
+  EXPECT_FALSE(ApplyQueryFilter(GURL("https://test.com/?ref_src=twsrc")));
+}
+
+TEST(BraveQueryFilter, FilterConditionalQueryTrackers) {
+  EXPECT_FALSE(
+      ApplyQueryFilter(GURL("https://test.com/unsubscribe?mkt_tok=123")));
+  EXPECT_FALSE(
+      ApplyQueryFilter(GURL("https://test.com/?mkt_tok=123&emailWebview=1")));
+  EXPECT_EQ(
+      ApplyQueryFilter(GURL("https://test.com/?mkt_tok=123&gclid=123&Un=1")),
+      GURL("https://test.com/?Un=1"));
+}
+
+TEST(BraveQueryFilter, KeepsOtherParametersUntouched) {
+  EXPECT_EQ(ApplyQueryFilter(GURL("https://test.com/?a=1&gclid=123&b=2")),
+            GURL("https://test.com/?a=1&b=2"));
+  EXPECT_EQ(ApplyQueryFilter(GURL("https://test.com/?a=1&&gclid=1&=x&b")),
+            GURL("https://test.com/?a=1&&=x&b"));
+  EXPECT_EQ(ApplyQueryFilter(GURL("https://test.com/?gclid=1&fbclid=2#f")),
+            GURL("https://test.com/#f"));
+  EXPECT_EQ(ApplyQueryFilter(GURL("https://test.com/?=gclid=1&a")),
+            GURL("https://test.com/?a"));
+  // Parameters without a value are not stripped.
+  EXPECT_FALSE(ApplyQueryFilter(GURL("https://test.com/?gclid&gclid=")));
+  EXPECT_FALSE(ApplyQueryFilter(GURL("https://test.com/?")));
+}
+
+TEST(BraveQueryFilter, FilterCorpusOfNavigationURLs) {
+  const std::vector<GURL> urls = {
+      GURL("https://www.google.com/search?q=brave+browser&oq=brave&sourceid="
+           "chrome&ie=UTF-8"),
+      GURL("https://www.example.com/landing?utm_source=newsletter&utm_medium="
+           "email&fbclid=IwAR2x9mK3&ref=home"),
+      GURL("https://shop.example.co.uk/product/123?gclid=Cj0KCQjw&color=red&"
+           "size=m"),
+      GURL("https://www.instagram.com/p/Cabc123/?igshid=YmMyMTA2M2Y="),
+      GURL("https://twitter.com/brave/status/1?ref_src=twsrc%5Etfw&ref_url="
+           "https%3A%2F%2Fexample.com%2F"),
+      GURL("https://news.example.org/2023/01/article.html"),
+      GURL("https://go.example.com/unsubscribe?mkt_tok=MTM4LUVaTS0wNDIAAAGA"),
+      GURL("https://www.example.net/?_hsenc=p2ANqtz&_hsmi=2&__hssc=1.2.3&"
+           "__hstc=4.5.6&__hsfp=7"),
+      GURL("https://video.example.com/watch?v=dQw4w9WgXcQ&t=42s&list=PL1"),
+      GURL("https://mail.example.com/track?mc_eid=abc&mc_cid=def&vero_id=1&"
+           "vero_conv=2&yclid=3&msclkid=4&dclid=5&wbraid=6&gbraid=7"),
+  };
+
+  size_t filtered = 0;
+  for (const GURL& url : urls) {
+    if (ApplyQueryFilter(url))
+      ++filtered;
+  }
+  EXPECT_EQ(filtered, 6u);
+}
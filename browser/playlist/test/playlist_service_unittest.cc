@@ -7,13 +7,19 @@
 
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
+#include "base/json/json_writer.h"
 #include "base/run_loop.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/timer/timer.h"
 #include "brave/browser/playlist/playlist_service_factory.h"
 #include "brave/components/playlist/browser/media_detector_component_manager.h"
 #include "brave/components/playlist/browser/playlist_constants.h"
+#include "brave/components/playlist/browser/playlist_data_url_loader_factory.h"
+#include "brave/components/playlist/browser/playlist_media_file_download_manager.h"
 #include "brave/components/playlist/browser/playlist_service_observer.h"
 #include "brave/components/playlist/browser/pref_names.h"
 #include "brave/components/playlist/browser/type_converter.h"
@@ -32,20 +38,66 @@
 #include "content/public/browser/browser_thread.h"
 #include "content/public/test/browser_task_environment.h"
 #include "content/public/test/test_host_resolver.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe_utils.h"
+#include "net/base/net_errors.h"
 #include "net/dns/mock_host_resolver.h"
 #include "net/test/embedded_test_server/embedded_test_server.h"
 #include "net/test/embedded_test_server/http_request.h"
 #include "net/test/embedded_test_server/http_response.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/test/test_url_loader_client.h"
 #include "testing/gmock/include/gmock/gmock-matchers.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace {
 
+constexpr char kResumableMediaFileContent[] =
+    "0123456789abcdefghijklmnopqrstuvwxyz";
+constexpr char kResumableMediaFileETag[] = "\"resumable\"";
+
+// Serves "bytes=N-" ranges when "If-Range" matches the ETag, and the whole
+// file otherwise.
+void HandleResumableMediaFileRequest(
+    const net::test_server::HttpRequest& request,
+    net::test_server::BasicHttpResponse* http_response) {
+  const std::string content = kResumableMediaFileContent;
+  http_response->set_content_type("video/mp4");
+  http_response->AddCustomHeader("Accept-Ranges", "bytes");
+  http_response->AddCustomHeader("ETag", kResumableMediaFileETag);
+
+  size_t offset = 0;
+  auto range = request.headers.find("Range");
+  auto if_range = request.headers.find("If-Range");
+  if (range != request.headers.end() && if_range != request.headers.end() &&
+      if_range->second == kResumableMediaFileETag &&
+      base::StartsWith(range->second, "bytes=") &&
+      base::EndsWith(range->second, "-") &&
+      base::StringToSizeT(base::StringPiece(range->second)
+                              .substr(6, range->second.size() - 7),
+                          &offset) &&
+      offset < content.size()) {
+    http_response->set_code(net::HTTP_PARTIAL_CONTENT);
+    http_response->AddCustomHeader(
+        "Content-Range", base::StringPrintf("bytes %zu-%zu/%zu", offset,
+                                            content.size() - 1,
+                                            content.size()));
+    http_response->set_content(content.substr(offset));
+    return;
+  }
+
+  http_response->set_code(net::HTTP_OK);
+  http_response->set_content(content);
+}
+
 std::unique_ptr<net::test_server::HttpResponse> HandleRequest(
     const net::test_server::HttpRequest& request) {
   auto http_response = std::make_unique<net::test_server::BasicHttpResponse>();
-  if (request.relative_url == "/valid_thumbnail" ||
+  if (request.relative_url == "/resumable_media_file") {
+    HandleResumableMediaFileRequest(request, http_response.get());
+  } else if (request.relative_url == "/valid_thumbnail" ||
       request.relative_url == "/valid_media_file_1" ||
       request.relative_url == "/valid_media_file_2") {
     http_response->set_code(net::HTTP_OK);
@@ -1300,6 +1352,100 @@ TEST_F(PlaylistServiceUnitTest, ResetAll) {
       service->GetPlaylistItemDirPath(item->id)));
 }
 
+TEST_F(PlaylistServiceUnitTest, MediaDownloadsAreLimitedPerHost) {
+  auto* service = playlist_service();
+  service->thumbnail_downloader_->pause_download_for_testing_ = true;
+  auto* download_manager = service->media_file_download_manager_.get();
+  download_manager->pause_download_for_testing_ = true;
+
+  std::vector<mojom::PlaylistItemPtr> items;
+  for (int i = 0; i < 5; i++) {
+    auto item = mojom::PlaylistItem::New();
+    item->id = base::Token::CreateRandom().ToString();
+    item->name = base::NumberToString(i + 1);
+    item->page_source = GURL("https://foo.com/");
+    item->thumbnail_source = item->thumbnail_path =
+        GURL("https://thumbnail.src/");
+    // All but the last one come from the same host.
+    item->media_source = item->media_path =
+        GURL((i < 4 ? "https://media.src/" : "https://other.src/") + item->id);
+    items.push_back(std::move(item));
+  }
+  service->AddMediaFilesFromItems(kDefaultPlaylistID, /* cache = */ true,
+                                  std::move(items));
+
+  WaitUntil(base::BindLambdaForTesting([&]() {
+    return download_manager->current_jobs_.size() +
+               download_manager->pending_media_file_creation_jobs_.size() ==
+           5u;
+  }));
+
+  // Two from media.src and one from other.src run, the others wait.
+  EXPECT_EQ(PlaylistMediaFileDownloadManager::kMaxConcurrentDownloadsPerHost +
+                1,
+            download_manager->current_jobs_.size());
+  EXPECT_EQ(2u, download_manager->pending_media_file_creation_jobs_.size());
+  for (const auto& job : download_manager->pending_media_file_creation_jobs_) {
+    EXPECT_EQ("media.src", job->item->media_source.host());
+  }
+}
+
+TEST_F(PlaylistServiceUnitTest, ResumeMediaFileDownload) {
+  auto* service = playlist_service();
+
+  // Leaves a partial file behind as if an earlier download was interrupted,
+  // then downloads the item and returns what ends up on disk. The partial
+  // bytes differ from the server's so that we can tell whether the download
+  // continued from them.
+  const std::string partial_content = "XXXXXXXXXX";
+  auto download_with_partial_file = [&](const std::string& etag) {
+    auto item = GetValidCreateParams();
+    item->id = base::Token::CreateRandom().ToString();
+    item->media_source = item->media_path =
+        https_server()->GetURL("/resumable_media_file");
+
+    const auto media_file_path =
+        service->GetPlaylistItemDirPath(item->id).Append(
+            PlaylistMediaFileDownloadManager::kMediaFileName);
+    const auto resume_info_path =
+        media_file_path.AddExtension(FILE_PATH_LITERAL(".resume"));
+    base::Value::Dict resume_info;
+    resume_info.Set("etag", etag);
+    std::string resume_info_json;
+    EXPECT_TRUE(base::JSONWriter::Write(resume_info, &resume_info_json));
+    EXPECT_TRUE(base::CreateDirectory(media_file_path.DirName()));
+    EXPECT_TRUE(base::WriteFile(media_file_path, partial_content));
+    EXPECT_TRUE(base::WriteFile(resume_info_path, resume_info_json));
+
+    bool cached = false;
+    testing::NiceMock<MockObserver> observer;
+    EXPECT_CALL(observer, OnPlaylistStatusChanged(testing::_))
+        .Times(testing::AnyNumber());
+    EXPECT_CALL(observer,
+                OnPlaylistStatusChanged(PlaylistChangeParams(
+                    mojom::PlaylistEvent::kItemCached, item->id)))
+        .WillOnce([&]() { cached = true; });
+    service->AddObserverForTest(&observer);
+    service->CreatePlaylistItem(std::move(item), /* cache = */ true);
+    WaitUntil(base::BindLambdaForTesting([&]() { return cached; }));
+    service->RemoveObserverForTest(&observer);
+
+    EXPECT_FALSE(base::PathExists(resume_info_path));
+    std::string content;
+    EXPECT_TRUE(base::ReadFileToString(media_file_path, &content));
+    return content;
+  };
+
+  // The partial file is still valid, so only the rest is requested.
+  const std::string content = kResumableMediaFileContent;
+  EXPECT_EQ(partial_content + content.substr(partial_content.size()),
+            download_with_partial_file(kResumableMediaFileETag));
+
+  // The file has changed on the server since then, so it's downloaded again
+  // from the start.
+  EXPECT_EQ(content, download_with_partial_file("\"stale\""));
+}
+
 TEST_F(PlaylistServiceUnitTest, CleanUpOrphanedPlaylistItemDirs) {
   // Pre-condition: There's orphaned dirs. -------------------------------------
   auto* service = playlist_service();
@@ -1339,6 +1485,60 @@ TEST_F(PlaylistServiceUnitTest, CleanUpOrphanedPlaylistItemDirs) {
       service->GetPlaylistItemDirPath(item.id)));
 }
 
+TEST_F(PlaylistServiceUnitTest, DataURLLoaderFactory) {
+  auto* service = playlist_service();
+
+  const std::string id = base::Token::CreateRandom().ToString();
+  base::FilePath media_path;
+  ASSERT_TRUE(service->GetMediaPath(id, &media_path));
+  ASSERT_TRUE(base::CreateDirectory(media_path.DirName()));
+  ASSERT_TRUE(base::WriteFile(media_path, kResumableMediaFileContent));
+
+  mojo::Remote<network::mojom::URLLoaderFactory> factory(
+      PlaylistDataURLLoaderFactory::Create(service->GetWeakPtr(), {}));
+
+  auto load = [&factory](const GURL& url, const std::string& range,
+                         std::string* body) {
+    network::ResourceRequest request;
+    request.url = url;
+    if (!range.empty())
+      request.headers.SetHeader(net::HttpRequestHeaders::kRange, range);
+
+    mojo::PendingRemote<network::mojom::URLLoader> loader;
+    network::TestURLLoaderClient client;
+    factory->CreateLoaderAndStart(
+        loader.InitWithNewPipeAndPassReceiver(), /*request_id=*/0,
+        network::mojom::kURLLoadOptionNone, request, client.CreateRemote(),
+        net::MutableNetworkTrafficAnnotationTag(TRAFFIC_ANNOTATION_FOR_TESTS));
+    client.RunUntilComplete();
+    if (client.completion_status().error_code == net::OK) {
+      EXPECT_TRUE(mojo::BlockingCopyToString(client.response_body_release(),
+                                             body));
+    }
+    return client.completion_status().error_code;
+  };
+
+  const GURL media_url("chrome-untrusted://playlist-data/" + id + "/media/");
+  std::string body;
+  EXPECT_EQ(net::OK, load(media_url, std::string(), &body));
+  EXPECT_EQ(kResumableMediaFileContent, body);
+
+  // Only the requested bytes are sent back.
+  body.clear();
+  EXPECT_EQ(net::OK, load(media_url, "bytes=10-15", &body));
+  EXPECT_EQ("abcdef", body);
+
+  EXPECT_NE(net::OK,
+            load(GURL("chrome-untrusted://playlist-data/" + id + "/thumbnail/"),
+                 std::string(), &body));
+  EXPECT_NE(net::OK,
+            load(GURL("chrome-untrusted://playlist-data/" + id + "/other/"),
+                 std::string(), &body));
+  // Other hosts go to the fallback factory, of which there is none here.
+  EXPECT_EQ(net::ERR_INVALID_URL,
+            load(GURL("chrome-untrusted://playlist/"), std::string(), &body));
+}
+
 class PlaylistServiceWithFakeUAUnitTest : public PlaylistServiceUnitTest {
  public:
   PlaylistServiceWithFakeUAUnitTest()
@@ -440,6 +440,27 @@ bool BraveShieldsDataController::IsForgetFirstPartyStorageFeatureEnabled()
 void BraveShieldsDataController::HandleItemBlocked(
     const std::string& block_type,
     const std::string& subresource) {
+  AddBlockedItem(block_type, subresource);
+
+  for (Observer& obs : observer_list_)
+    obs.OnResourcesChanged();
+}
+
+void BraveShieldsDataController::HandleItemsBlocked(
+    const std::vector<std::pair<std::string, std::string>>& items) {
+  if (items.empty())
+    return;
+
+  for (const auto& [block_type, subresource] : items)
+    AddBlockedItem(block_type, subresource);
+
+  for (Observer& obs : observer_list_)
+    obs.OnResourcesChanged();
+}
+
+void BraveShieldsDataController::AddBlockedItem(
+    const std::string& block_type,
+    const std::string& subresource) {
   auto subres = GURL(subresource);
 
   if (block_type == kAds) {
@@ -451,9 +472,6 @@ void BraveShieldsDataController::HandleItemBlocked(
   } else if (block_type == kFingerprintingV2) {
     resource_list_blocked_fingerprints_.insert(subres);
   }
-
-  for (Observer& obs : observer_list_)
-    obs.OnResourcesChanged();
 }
 
 void BraveShieldsDataController::HandleItemAllowedOnce(
@@ -8,6 +8,7 @@
 
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/observer_list.h"
@@ -50,6 +51,10 @@ class BraveShieldsDataController
 
   void HandleItemBlocked(const std::string& block_type,
                          const std::string& subresource);
+  // Same as HandleItemBlocked() for a batch of (block type, subresource)
+  // pairs, notifying observers only once.
+  void HandleItemsBlocked(
+      const std::vector<std::pair<std::string, std::string>>& items);
   void HandleItemAllowedOnce(const std::string& allowed_once_type,
                              const std::string& subresource);
   void ClearAllResourcesList();
@@ -90,6 +95,9 @@ class BraveShieldsDataController
 
   explicit BraveShieldsDataController(content::WebContents* web_contents);
 
+  void AddBlockedItem(const std::string& block_type,
+                      const std::string& subresource);
+
   // content::WebContentsObserver
   void DidFinishNavigation(
       content::NavigationHandle* navigation_handle) override;
@@ -7,6 +7,7 @@
 
 #include <string>
 
+#include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
 #include "brave/app/brave_command_ids.h"
 #include "brave/browser/debounce/debounce_service_factory.h"
@@ -213,7 +214,9 @@ void CopyLinkWithStrictCleaning(Browser* browser, const GURL& url) {
   auto* debounce_service =
       debounce::DebounceServiceFactory::GetForBrowserContext(
           browser->profile());
-  if (debounce_service && !debounce_service->Debounce(url, &final_url)) {
+  base::flat_set<std::string> visited_hosts;
+  if (debounce_service &&
+      !debounce_service->Debounce(url, &final_url, &visited_hosts)) {
     VLOG(1) << "Unable to apply debounce rules";
     final_url = url;
   }
@@ -0,0 +1,145 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
+#include "base/test/task_environment.h"
+#include "base/test/test_future.h"
+#include "base/time/time.h"
+#include "base/timer/elapsed_timer.h"
+#include "base/timer/lap_timer.h"
+#include "net/cookies/canonical_cookie.h"
+#include "net/cookies/cookie_access_result.h"
+#include "net/cookies/cookie_deletion_info.h"
+#include "net/cookies/cookie_monster.h"
+#include "net/cookies/cookie_options.h"
+#include "net/log/net_log.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+namespace net {
+
+namespace {
+
+constexpr char kMetricPrefixCookieMonster[] = "BraveCookieMonster.";
+constexpr char kMetricSetCookiesTime[] = "set_cookies_time";
+constexpr char kMetricDeleteDomainTime[] = "delete_domain_time";
+constexpr char kMetricDeleteSharedDomainTime[] = "delete_shared_domain_time";
+
+constexpr int kWarmupRuns = 1;
+constexpr int kTimeCheckInterval = 1;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixCookieMonster, story);
+  reporter.RegisterImportantMetric(kMetricSetCookiesTime, "ms");
+  reporter.RegisterImportantMetric(kMetricDeleteDomainTime, "us");
+  reporter.RegisterImportantMetric(kMetricDeleteSharedDomainTime, "us");
+  return reporter;
+}
+
+std::string GetSiteHost(int index) {
+  return base::StringPrintf("site%d.com", index);
+}
+
+GURL GetTrackerURL(int index) {
+  return GURL(base::StringPrintf("https://tracker%d.com/", index));
+}
+
+const GURL& GetSharedURL() {
+  static const GURL url("https://shared.com/");
+  return url;
+}
+
+}  // namespace
+
+class BraveCookieMonsterPerfTest : public testing::Test {
+ public:
+  BraveCookieMonsterPerfTest()
+      : cookie_monster_(std::make_unique<CookieMonster>(nullptr,
+                                                        NetLog::Get())) {}
+
+ protected:
+  void SetEphemeralCookie(const GURL& url,
+                          const std::string& cookie_line,
+                          const std::string& top_frame_host) {
+    CookieOptions options = CookieOptions::MakeAllInclusive();
+    options.set_should_use_ephemeral_storage(true);
+    options.set_top_frame_origin(
+        url::Origin::Create(GURL("https://" + top_frame_host)));
+    auto cookie =
+        CanonicalCookie::Create(url, cookie_line, base::Time::Now(),
+                                /*server_time=*/absl::nullopt,
+                                /*cookie_partition_key=*/absl::nullopt);
+    base::test::TestFuture<CookieAccessResult> future;
+    cookie_monster_->SetCanonicalCookieAsync(std::move(cookie), url, options,
+                                             future.GetCallback());
+    ASSERT_TRUE(future.Get().status.IsInclude());
+  }
+
+  void DeleteDomain(const std::string& domain) {
+    CookieDeletionInfo delete_info;
+    delete_info.domains_and_ips_to_delete = std::set<std::string>{domain};
+    base::test::TestFuture<uint32_t> future;
+    cookie_monster_->DeleteAllMatchingInfoAsync(std::move(delete_info),
+                                                future.GetCallback());
+    ASSERT_TRUE(future.Wait());
+  }
+
+  // Sets a cookie of its own tracker and one of a tracker present everywhere
+  // in each of |partitions_count| partitions, then deletes the cookies of a
+  // single partition's tracker and of the shared one.
+  void RunDeleteTest(int partitions_count) {
+    base::ElapsedTimer set_timer;
+    for (int i = 0; i < partitions_count; ++i) {
+      SetEphemeralCookie(GetTrackerURL(i), "a=b", GetSiteHost(i));
+      SetEphemeralCookie(GetSharedURL(), "c=d", GetSiteHost(i));
+    }
+    const base::TimeDelta set_time = set_timer.Elapsed();
+
+    // Deleted cookies stay indexed, so later laps visit the same stores as
+    // the first one.
+    base::LapTimer delete_timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+    do {
+      DeleteDomain("tracker5.com");
+      delete_timer.NextLap();
+    } while (!delete_timer.HasTimeLimitExpired());
+
+    base::LapTimer delete_shared_timer(kWarmupRuns, kTimeLimit,
+                                       kTimeCheckInterval);
+    do {
+      DeleteDomain("shared.com");
+      delete_shared_timer.NextLap();
+    } while (!delete_shared_timer.HasTimeLimitExpired());
+
+    auto reporter =
+        SetUpReporter(base::NumberToString(partitions_count) + "_partitions");
+    reporter.AddResult(kMetricSetCookiesTime, set_time);
+    reporter.AddResult(kMetricDeleteDomainTime, delete_timer.TimePerLap());
+    reporter.AddResult(kMetricDeleteSharedDomainTime,
+                       delete_shared_timer.TimePerLap());
+  }
+
+ private:
+  base::test::TaskEnvironment task_environment_;
+  std::unique_ptr<CookieMonster> cookie_monster_;
+};
+
+TEST_F(BraveCookieMonsterPerfTest, Partitions100) {
+  RunDeleteTest(100);
+}
+
+TEST_F(BraveCookieMonsterPerfTest, Partitions1000) {
+  RunDeleteTest(1000);
+}
+
+}  // namespace net
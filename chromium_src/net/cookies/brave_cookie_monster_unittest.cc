@@ -0,0 +1,228 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "net/cookies/cookie_monster.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/strings/stringprintf.h"
+#include "base/test/task_environment.h"
+#include "base/test/test_future.h"
+#include "base/time/time.h"
+#include "net/cookies/canonical_cookie.h"
+#include "net/cookies/cookie_access_result.h"
+#include "net/cookies/cookie_deletion_info.h"
+#include "net/cookies/cookie_options.h"
+#include "net/cookies/cookie_partition_key_collection.h"
+#include "net/log/net_log.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+namespace net {
+
+namespace {
+
+constexpr int kNumPartitions = 20;
+
+std::string GetSiteHost(int index) {
+  return base::StringPrintf("site%d.com", index);
+}
+
+GURL GetTrackerURL(int index) {
+  return GURL(base::StringPrintf("https://tracker%d.com/", index));
+}
+
+const GURL& GetSharedURL() {
+  static const GURL url("https://shared.com/");
+  return url;
+}
+
+}  // namespace
+
+class BraveCookieMonsterTest : public testing::Test {
+ public:
+  BraveCookieMonsterTest()
+      : cookie_monster_(std::make_unique<CookieMonster>(nullptr,
+                                                        NetLog::Get())) {
+    cookie_monster_->SetEphemeralCookieStoreVisitCallbackForTesting(
+        base::BindRepeating(
+            [](std::multiset<std::string>* visited_stores,
+               const std::string& ephemeral_storage_domain) {
+              visited_stores->insert(ephemeral_storage_domain);
+            },
+            &visited_stores_));
+  }
+
+ protected:
+  CookieOptions GetEphemeralOptions(const std::string& top_frame_host) {
+    CookieOptions options = CookieOptions::MakeAllInclusive();
+    options.set_should_use_ephemeral_storage(true);
+    options.set_top_frame_origin(
+        url::Origin::Create(GURL("https://" + top_frame_host)));
+    return options;
+  }
+
+  bool SetEphemeralCookie(const GURL& url,
+                          const std::string& cookie_line,
+                          const std::string& top_frame_host) {
+    auto cookie =
+        CanonicalCookie::Create(url, cookie_line, base::Time::Now(),
+                                /*server_time=*/absl::nullopt,
+                                /*cookie_partition_key=*/absl::nullopt);
+    base::test::TestFuture<CookieAccessResult> future;
+    cookie_monster_->SetCanonicalCookieAsync(
+        std::move(cookie), url, GetEphemeralOptions(top_frame_host),
+        future.GetCallback());
+    return future.Get().status.IsInclude();
+  }
+
+  size_t CountEphemeralCookies(const GURL& url,
+                               const std::string& top_frame_host) {
+    base::test::TestFuture<CookieAccessResultList, CookieAccessResultList>
+        future;
+    cookie_monster_->GetCookieListWithOptionsAsync(
+        url, GetEphemeralOptions(top_frame_host),
+        CookiePartitionKeyCollection(),
+        future.GetCallback<const CookieAccessResultList&,
+                           const CookieAccessResultList&>());
+    return future.Get<0>().size();
+  }
+
+  // Returns the ephemeral stores visited by the delete.
+  std::multiset<std::string> DeleteAllMatchingInfo(
+      CookieDeletionInfo delete_info) {
+    visited_stores_.clear();
+    base::test::TestFuture<uint32_t> future;
+    cookie_monster_->DeleteAllMatchingInfoAsync(std::move(delete_info),
+                                                future.GetCallback());
+    EXPECT_TRUE(future.Wait());
+    return std::move(visited_stores_);
+  }
+
+  void FillPartitions() {
+    for (int i = 0; i < kNumPartitions; ++i) {
+      ASSERT_TRUE(SetEphemeralCookie(GetTrackerURL(i), "a=b", GetSiteHost(i)));
+      ASSERT_TRUE(SetEphemeralCookie(GetSharedURL(), "c=d", GetSiteHost(i)));
+    }
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  std::unique_ptr<CookieMonster> cookie_monster_;
+  std::multiset<std::string> visited_stores_;
+};
+
+TEST_F(BraveCookieMonsterTest, DeleteDomainTouchesOnlyItsPartitions) {
+  FillPartitions();
+
+  CookieDeletionInfo delete_info;
+  delete_info.domains_and_ips_to_delete = std::set<std::string>{"tracker5.com"};
+  EXPECT_EQ(std::multiset<std::string>{GetSiteHost(5)},
+            DeleteAllMatchingInfo(std::move(delete_info)));
+
+  EXPECT_EQ(0u, CountEphemeralCookies(GetTrackerURL(5), GetSiteHost(5)));
+  EXPECT_EQ(1u, CountEphemeralCookies(GetSharedURL(), GetSiteHost(5)));
+  EXPECT_EQ(1u, CountEphemeralCookies(GetTrackerURL(6), GetSiteHost(6)));
+}
+
+TEST_F(BraveCookieMonsterTest, DeleteSharedDomainTouchesAllPartitions) {
+  FillPartitions();
+
+  CookieDeletionInfo delete_info;
+  delete_info.domains_and_ips_to_delete = std::set<std::string>{"shared.com"};
+  std::multiset<std::string> expected_stores;
+  for (int i = 0; i < kNumPartitions; ++i)
+    expected_stores.insert(GetSiteHost(i));
+  EXPECT_EQ(expected_stores, DeleteAllMatchingInfo(std::move(delete_info)));
+
+  for (int i = 0; i < kNumPartitions; ++i) {
+    EXPECT_EQ(0u, CountEphemeralCookies(GetSharedURL(), GetSiteHost(i)));
+    EXPECT_EQ(1u, CountEphemeralCookies(GetTrackerURL(i), GetSiteHost(i)));
+  }
+}
+
+TEST_F(BraveCookieMonsterTest, DeleteByHostTouchesOnlyItsPartitions) {
+  FillPartitions();
+
+  CookieDeletionInfo delete_info;
+  delete_info.host = "tracker3.com";
+  EXPECT_EQ(std::multiset<std::string>{GetSiteHost(3)},
+            DeleteAllMatchingInfo(std::move(delete_info)));
+
+  EXPECT_EQ(0u, CountEphemeralCookies(GetTrackerURL(3), GetSiteHost(3)));
+  EXPECT_EQ(1u, CountEphemeralCookies(GetSharedURL(), GetSiteHost(3)));
+  EXPECT_EQ(1u, CountEphemeralCookies(GetTrackerURL(4), GetSiteHost(4)));
+}
+
+TEST_F(BraveCookieMonsterTest, DeleteByURLTouchesOnlyItsPartitions) {
+  FillPartitions();
+
+  CookieDeletionInfo delete_info;
+  delete_info.url = GetTrackerURL(4);
+  EXPECT_EQ(std::multiset<std::string>{GetSiteHost(4)},
+            DeleteAllMatchingInfo(std::move(delete_info)));
+
+  EXPECT_EQ(0u, CountEphemeralCookies(GetTrackerURL(4), GetSiteHost(4)));
+  EXPECT_EQ(1u, CountEphemeralCookies(GetSharedURL(), GetSiteHost(4)));
+  EXPECT_EQ(1u, CountEphemeralCookies(GetTrackerURL(3), GetSiteHost(3)));
+}
+
+TEST_F(BraveCookieMonsterTest, DeleteParentDomainCookie) {
+  FillPartitions();
+
+  // A cookie set by a subdomain on its parent domain is indexed under the
+  // registrable domain, so deletes through another subdomain find it.
+  const GURL sub_url("https://sub.tracker2.com/");
+  const GURL other_sub_url("https://other.tracker2.com/");
+  ASSERT_TRUE(
+      SetEphemeralCookie(sub_url, "e=f; Domain=tracker2.com", GetSiteHost(2)));
+  ASSERT_TRUE(SetEphemeralCookie(sub_url, "g=h", GetSiteHost(9)));
+  EXPECT_EQ(2u, CountEphemeralCookies(GetTrackerURL(2), GetSiteHost(2)));
+  EXPECT_EQ(1u, CountEphemeralCookies(other_sub_url, GetSiteHost(2)));
+
+  CookieDeletionInfo url_delete_info;
+  url_delete_info.url = other_sub_url;
+  EXPECT_EQ((std::multiset<std::string>{GetSiteHost(2), GetSiteHost(9)}),
+            DeleteAllMatchingInfo(std::move(url_delete_info)));
+  EXPECT_EQ(0u, CountEphemeralCookies(other_sub_url, GetSiteHost(2)));
+  // The host cookies of other hosts under the same domain are kept.
+  EXPECT_EQ(1u, CountEphemeralCookies(GetTrackerURL(2), GetSiteHost(2)));
+  EXPECT_EQ(1u, CountEphemeralCookies(sub_url, GetSiteHost(9)));
+
+  CookieDeletionInfo domain_delete_info;
+  domain_delete_info.domains_and_ips_to_delete =
+      std::set<std::string>{"tracker2.com"};
+  EXPECT_EQ((std::multiset<std::string>{GetSiteHost(2), GetSiteHost(9)}),
+            DeleteAllMatchingInfo(std::move(domain_delete_info)));
+  EXPECT_EQ(0u, CountEphemeralCookies(GetTrackerURL(2), GetSiteHost(2)));
+  EXPECT_EQ(0u, CountEphemeralCookies(sub_url, GetSiteHost(9)));
+  EXPECT_EQ(1u, CountEphemeralCookies(GetSharedURL(), GetSiteHost(9)));
+}
+
+TEST_F(BraveCookieMonsterTest, DeletePartitionDropsItFromIndex) {
+  FillPartitions();
+
+  CookieDeletionInfo delete_info;
+  delete_info.ephemeral_storage_domain = GetSiteHost(7);
+  EXPECT_TRUE(DeleteAllMatchingInfo(std::move(delete_info)).empty());
+  EXPECT_EQ(0u, CountEphemeralCookies(GetSharedURL(), GetSiteHost(7)));
+
+  // Deleting by domain afterwards must not touch the destroyed partition.
+  CookieDeletionInfo shared_delete_info;
+  shared_delete_info.domains_and_ips_to_delete =
+      std::set<std::string>{"shared.com"};
+  const std::multiset<std::string> visited_stores =
+      DeleteAllMatchingInfo(std::move(shared_delete_info));
+  EXPECT_EQ(static_cast<size_t>(kNumPartitions - 1), visited_stores.size());
+  EXPECT_EQ(0u, visited_stores.count(GetSiteHost(7)));
+  EXPECT_EQ(0u, CountEphemeralCookies(GetSharedURL(), GetSiteHost(8)));
+  EXPECT_EQ(1u, CountEphemeralCookies(GetTrackerURL(8), GetSiteHost(8)));
+}
+
+}  // namespace net
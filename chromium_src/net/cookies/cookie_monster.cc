@@ -6,6 +6,8 @@
 #include "net/cookies/cookie_monster.h"
 
 #include <memory>
+
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "net/base/url_util.h"
 
 #define CookieMonster ChromiumCookieMonster
@@ -14,6 +16,18 @@
 
 namespace net {
 
+namespace {
+
+// Same effective domain CookieDeletionInfo matches |domains_and_ips_to_delete|
+// against.
+std::string GetEphemeralIndexDomain(const std::string& host) {
+  std::string domain = registry_controlled_domains::GetDomainAndRegistry(
+      host, registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+  return domain.empty() ? host : domain;
+}
+
+}  // namespace
+
 CookieMonster::CookieMonster(scoped_refptr<PersistentCookieStore> store,
                              NetLog* net_log)
     : ChromiumCookieMonster(store, net_log),
@@ -43,10 +57,92 @@ CookieMonster::GetOrCreateEphemeralCookieStoreForTopFrameURL(
       .first->second.get();
 }
 
+void CookieMonster::AddToEphemeralIndex(
+    const std::string& ephemeral_storage_domain,
+    const std::string& cookie_domain) {
+  ephemeral_storage_domains_by_cookie_domain_[cookie_domain].insert(
+      ephemeral_storage_domain);
+  cookie_domains_by_ephemeral_storage_domain_[ephemeral_storage_domain].insert(
+      cookie_domain);
+}
+
+void CookieMonster::RemoveFromEphemeralIndex(
+    const std::string& ephemeral_storage_domain) {
+  auto it = cookie_domains_by_ephemeral_storage_domain_.find(
+      ephemeral_storage_domain);
+  if (it == cookie_domains_by_ephemeral_storage_domain_.end())
+    return;
+
+  for (const auto& cookie_domain : it->second) {
+    auto domain_it =
+        ephemeral_storage_domains_by_cookie_domain_.find(cookie_domain);
+    if (domain_it == ephemeral_storage_domains_by_cookie_domain_.end())
+      continue;
+    domain_it->second.erase(ephemeral_storage_domain);
+    if (domain_it->second.empty())
+      ephemeral_storage_domains_by_cookie_domain_.erase(domain_it);
+  }
+  cookie_domains_by_ephemeral_storage_domain_.erase(it);
+}
+
+std::set<std::string> CookieMonster::GetEphemeralStorageDomainsForCookieDomain(
+    const std::string& cookie_domain) {
+  auto it = ephemeral_storage_domains_by_cookie_domain_.find(cookie_domain);
+  if (it == ephemeral_storage_domains_by_cookie_domain_.end())
+    return {};
+  return it->second;
+}
+
+std::set<std::string> CookieMonster::GetEphemeralStorageDomainsForDeletion(
+    const CookieDeletionInfo& delete_info) {
+  std::vector<std::string> cookie_domains;
+  if (delete_info.domains_and_ips_to_delete.has_value()) {
+    for (const auto& domain : *delete_info.domains_and_ips_to_delete)
+      cookie_domains.push_back(GetEphemeralIndexDomain(domain));
+  } else if (delete_info.host.has_value()) {
+    cookie_domains.push_back(GetEphemeralIndexDomain(*delete_info.host));
+  } else if (delete_info.url.has_value()) {
+    cookie_domains.push_back(GetEphemeralIndexDomain(delete_info.url->host()));
+  } else {
+    std::set<std::string> ephemeral_storage_domains;
+    for (const auto& it : ephemeral_cookie_stores_)
+      ephemeral_storage_domains.insert(it.first);
+    return ephemeral_storage_domains;
+  }
+
+  std::set<std::string> ephemeral_storage_domains;
+  for (const auto& cookie_domain : cookie_domains) {
+    auto it = ephemeral_storage_domains_by_cookie_domain_.find(cookie_domain);
+    if (it != ephemeral_storage_domains_by_cookie_domain_.end()) {
+      ephemeral_storage_domains.insert(it->second.begin(), it->second.end());
+    }
+  }
+  return ephemeral_storage_domains;
+}
+
+ChromiumCookieMonster* CookieMonster::VisitEphemeralCookieStore(
+    const std::string& ephemeral_storage_domain) {
+  auto it = ephemeral_cookie_stores_.find(ephemeral_storage_domain);
+  if (it == ephemeral_cookie_stores_.end())
+    return nullptr;
+
+  if (ephemeral_cookie_store_visit_callback_for_testing_)
+    ephemeral_cookie_store_visit_callback_for_testing_.Run(it->first);
+  return it->second.get();
+}
+
+void CookieMonster::SetEphemeralCookieStoreVisitCallbackForTesting(
+    base::RepeatingCallback<void(const std::string&)> callback) {
+  ephemeral_cookie_store_visit_callback_for_testing_ = std::move(callback);
+}
+
 void CookieMonster::DeleteCanonicalCookieAsync(const CanonicalCookie& cookie,
                                                DeleteCallback callback) {
-  for (auto& it : ephemeral_cookie_stores_) {
-    it.second->DeleteCanonicalCookieAsync(cookie, DeleteCallback());
+  for (const auto& ephemeral_storage_domain :
+       GetEphemeralStorageDomainsForCookieDomain(
+           GetEphemeralIndexDomain(cookie.DomainWithoutDot()))) {
+    if (auto* store = VisitEphemeralCookieStore(ephemeral_storage_domain))
+      store->DeleteCanonicalCookieAsync(cookie, DeleteCallback());
   }
   ChromiumCookieMonster::DeleteCanonicalCookieAsync(cookie,
                                                     std::move(callback));
@@ -67,12 +163,15 @@ void CookieMonster::DeleteAllMatchingInfoAsync(CookieDeletionInfo delete_info,
                                                DeleteCallback callback) {
   if (delete_info.ephemeral_storage_domain.has_value()) {
     ephemeral_cookie_stores_.erase(*delete_info.ephemeral_storage_domain);
+    RemoveFromEphemeralIndex(*delete_info.ephemeral_storage_domain);
     std::move(callback).Run(0);
     return;
   }
 
-  for (auto& it : ephemeral_cookie_stores_) {
-    it.second->DeleteAllMatchingInfoAsync(delete_info, DeleteCallback());
+  for (const auto& ephemeral_storage_domain :
+       GetEphemeralStorageDomainsForDeletion(delete_info)) {
+    if (auto* store = VisitEphemeralCookieStore(ephemeral_storage_domain))
+      store->DeleteAllMatchingInfoAsync(delete_info, DeleteCallback());
   }
   ChromiumCookieMonster::DeleteAllMatchingInfoAsync(delete_info,
                                                     std::move(callback));
@@ -110,9 +209,13 @@ void CookieMonster::SetCanonicalCookieAsync(
               CookieInclusionStatus::EXCLUDE_UNKNOWN_ERROR)));
       return;
     }
+    const GURL top_frame_url = options.top_frame_origin()->GetURL();
+    if (cookie) {
+      AddToEphemeralIndex(URLToEphemeralStorageDomain(top_frame_url),
+                          GetEphemeralIndexDomain(cookie->DomainWithoutDot()));
+    }
     ChromiumCookieMonster* ephemeral_monster =
-        GetOrCreateEphemeralCookieStoreForTopFrameURL(
-            options.top_frame_origin()->GetURL());
+        GetOrCreateEphemeralCookieStoreForTopFrameURL(top_frame_url);
     ephemeral_monster->SetCanonicalCookieAsync(std::move(cookie), source_url,
                                                options, std::move(callback),
                                                std::move(cookie_access_result));
@@ -6,6 +6,14 @@
 #ifndef BRAVE_CHROMIUM_SRC_NET_COOKIES_COOKIE_MONSTER_H_
 #define BRAVE_CHROMIUM_SRC_NET_COOKIES_COOKIE_MONSTER_H_
 
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "base/functional/callback.h"
+
 #define CookieMonster ChromiumCookieMonster
 #include "src/net/cookies/cookie_monster.h"  // IWYU pragma: export
 #undef CookieMonster
@@ -50,12 +58,45 @@ class NET_EXPORT CookieMonster : public ChromiumCookieMonster {
       const CookiePartitionKeyCollection& cookie_partition_key_collection,
       GetCookieListCallback callback) override;
 
+  // Runs |callback| with the ephemeral storage domain of every ephemeral
+  // store a targeted delete visits.
+  void SetEphemeralCookieStoreVisitCallbackForTesting(
+      base::RepeatingCallback<void(const std::string&)> callback);
+
  private:
+  ChromiumCookieMonster* GetOrCreateEphemeralCookieStoreForTopFrameURL(
+      const GURL& top_frame_url);
+
+  // Keeps track of which ephemeral stores may hold cookies for a given
+  // registrable domain, so that targeted deletes don't have to visit every
+  // store. The index may list stores whose cookies are already gone, but it
+  // never misses one holding a matching cookie.
+  void AddToEphemeralIndex(const std::string& ephemeral_storage_domain,
+                           const std::string& cookie_domain);
+  void RemoveFromEphemeralIndex(const std::string& ephemeral_storage_domain);
+  // Returns the ephemeral storage domains whose stores may hold cookies
+  // matching |delete_info|, or all of them if the deletion isn't limited to
+  // domains.
+  std::set<std::string> GetEphemeralStorageDomainsForDeletion(
+      const CookieDeletionInfo& delete_info);
+  std::set<std::string> GetEphemeralStorageDomainsForCookieDomain(
+      const std::string& cookie_domain);
+  // Returns the ephemeral store for |ephemeral_storage_domain|, if it still
+  // exists.
+  ChromiumCookieMonster* VisitEphemeralCookieStore(
+      const std::string& ephemeral_storage_domain);
+
   NetLogWithSource net_log_;
   std::map<std::string, std::unique_ptr<ChromiumCookieMonster>>
       ephemeral_cookie_stores_;
-  ChromiumCookieMonster* GetOrCreateEphemeralCookieStoreForTopFrameURL(
-      const GURL& top_frame_url);
+  // Registrable cookie domain -> ephemeral storage domains.
+  std::map<std::string, std::set<std::string>>
+      ephemeral_storage_domains_by_cookie_domain_;
+  // Ephemeral storage domain -> registrable cookie domains.
+  std::map<std::string, std::set<std::string>>
+      cookie_domains_by_ephemeral_storage_domain_;
+  base::RepeatingCallback<void(const std::string&)>
+      ephemeral_cookie_store_visit_callback_for_testing_;
 };
 
 }  // namespace net
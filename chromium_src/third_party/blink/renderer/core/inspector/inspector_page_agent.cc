@@ -32,6 +32,25 @@ Response InspectorPageAgent::generatePageGraph(String* data) {
 #endif  // BUILDFLAG(ENABLE_BRAVE_PAGE_GRAPH)
 }
 
+Response InspectorPageAgent::generatePageGraphBinary(protocol::Binary* data) {
+#if BUILDFLAG(ENABLE_BRAVE_PAGE_GRAPH)
+  LocalFrame* main_frame = inspected_frames_->Root();
+  if (!main_frame) {
+    return Response::ServerError("No main frame found");
+  }
+
+  PageGraph* page_graph = blink::PageGraph::From(*main_frame);
+  if (!page_graph) {
+    return Response::ServerError("No Page Graph for main frame");
+  }
+
+  *data = protocol::Binary::fromVector(page_graph->ToBinary());
+  return Response::Success();
+#else
+  return Response::ServerError("Page Graph buildflag is disabled");
+#endif  // BUILDFLAG(ENABLE_BRAVE_PAGE_GRAPH)
+}
+
 Response InspectorPageAgent::generatePageGraphNodeReport(
     int node_id,
     std::unique_ptr<protocol::Array<String>>* report) {
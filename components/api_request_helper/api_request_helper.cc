@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "net/base/load_flags.h"
 #include "net/http/http_status_code.h"
@@ -20,7 +21,7 @@ namespace api_request_helper {
 
 namespace {
 
-void OnParseJsonIsolated(
+void OnParseJson(
     int http_code,
     const base::flat_map<std::string, std::string>& headers,
     int error_code,
@@ -57,6 +58,34 @@ void OnParseJsonIsolated(
                             std::move(headers), error_code, final_url));
 }
 
+// Parses and sanitizes |json| in the calling process. The Rust JSON parser
+// is memory safe, so trusted responses can skip the data decoder service
+// when base is built with it. It uses the options the service parses with,
+// so responses are accepted the same way in and out of process.
+bool ParseJsonInProcess(
+    const std::string& json,
+    int http_code,
+    const base::flat_map<std::string, std::string>& headers,
+    int error_code,
+    const GURL& final_url,
+    APIRequestHelper::ResultCallback& result_callback) {
+  if (!base::JSONReader::UsingRust())
+    return false;
+
+  auto result = base::JSONReader::ReadAndReturnValueWithError(
+      json,
+      base::JSON_PARSE_CHROMIUM_EXTENSIONS | base::JSON_ALLOW_TRAILING_COMMAS);
+  if (!result.has_value()) {
+    OnParseJson(http_code, headers, error_code, final_url,
+                std::move(result_callback),
+                base::unexpected(std::move(result.error().message)));
+  } else {
+    OnParseJson(http_code, headers, error_code, final_url,
+                std::move(result_callback), std::move(result.value()));
+  }
+  return true;
+}
+
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
 }  // namespace
@@ -148,13 +177,15 @@ APIRequestHelper::Ticket APIRequestHelper::Request(
         url_loader_factory_.get(),
         base::BindOnce(&APIRequestHelper::OnResponse,
                        weak_ptr_factory_.GetWeakPtr(), iter,
-                       std::move(callback), std::move(conversion_callback)));
+                       std::move(callback), std::move(conversion_callback),
+                       request_options.parse_json_in_process));
   } else {
     iter->get()->DownloadToString(
         url_loader_factory_.get(),
         base::BindOnce(&APIRequestHelper::OnResponse,
                        weak_ptr_factory_.GetWeakPtr(), iter,
-                       std::move(callback), std::move(conversion_callback)),
+                       std::move(callback), std::move(conversion_callback),
+                       request_options.parse_json_in_process),
         request_options.max_body_size);
   }
 
@@ -231,6 +262,7 @@ void APIRequestHelper::OnResponse(
     SimpleURLLoaderList::iterator iter,
     ResultCallback callback,
     ResponseConversionCallback conversion_callback,
+    bool parse_json_in_process,
     const std::unique_ptr<std::string> response_body) {
   auto* loader = iter->get();
   auto response_code = -1;
@@ -266,12 +298,18 @@ void APIRequestHelper::OnResponse(
           422, "", base::Value(), std::move(headers), error_code, final_url));
       return;
     }
-    raw_body = converted_body.value();
+    raw_body = std::move(converted_body.value());
+  }
+
+  if (parse_json_in_process && raw_body.size() <= kMaxInProcessJsonSize &&
+      ParseJsonInProcess(raw_body, response_code, headers, error_code,
+                         final_url, callback)) {
+    return;
   }
 
   data_decoder::DataDecoder::ParseJsonIsolated(
       raw_body,
-      base::BindOnce(&OnParseJsonIsolated, response_code, std::move(headers),
+      base::BindOnce(&OnParseJson, response_code, std::move(headers),
                      error_code, final_url, std::move(callback)));
 }
 
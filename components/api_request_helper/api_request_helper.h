@@ -78,6 +78,13 @@ struct APIRequestOptions {
   bool enable_cache = false;
   size_t max_body_size = -1u;
   absl::optional<base::TimeDelta> timeout;
+  // Parse the response in the calling process with the Rust backed
+  // base::JSONReader instead of in the data decoder service, which saves a
+  // process hop and a copy of the body. Only meant for trusted endpoints
+  // returning small responses. Bodies over kMaxInProcessJsonSize, and every
+  // body when base is built without the Rust parser, are still parsed out of
+  // process.
+  bool parse_json_in_process = false;
 };
 
 // Anyone is welcome to use APIRequestHelper to reduce boilerplate
@@ -85,6 +92,8 @@ class APIRequestHelper {
  public:
   using Ticket = std::list<std::unique_ptr<network::SimpleURLLoader>>::iterator;
 
+  static constexpr size_t kMaxInProcessJsonSize = 64 * 1024;
+
   APIRequestHelper(
       net::NetworkTrafficAnnotationTag annotation_tag,
       scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
@@ -157,6 +166,7 @@ class APIRequestHelper {
   void OnResponse(SimpleURLLoaderList::iterator iter,
                   ResultCallback callback,
                   ResponseConversionCallback conversion_callback,
+                  bool parse_json_in_process,
                   const std::unique_ptr<std::string> response_body);
   void OnDownload(SimpleURLLoaderList::iterator iter,
                   DownloadCallback callback,
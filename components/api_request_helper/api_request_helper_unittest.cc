@@ -95,7 +95,8 @@ class ApiRequestHelperUnitTest : public testing::Test {
                    const int expected_error_code = net::OK,
                    APIRequestHelper::ResponseConversionCallback
                        conversion_callback = base::NullCallback(),
-                   bool enable_cache = false) {
+                   bool enable_cache = false,
+                   bool parse_json_in_process = false) {
     GURL network_url("http://localhost/");
 
     APIRequestResult expected_result(
@@ -105,10 +106,11 @@ class ApiRequestHelperUnitTest : public testing::Test {
     EXPECT_CALL(callback, Run(MatchesAPIRequestResult(&expected_result)));
 
     SetInterceptor("POST", network_url, server_raw_response, enable_cache);
-    api_request_helper_->Request(
-        "POST", network_url, "", "application/json", callback.Get(),
-        APIRequestOptions(false, enable_cache, -1u, absl::nullopt), {},
-        std::move(conversion_callback));
+    APIRequestOptions options(false, enable_cache, -1u, absl::nullopt);
+    options.parse_json_in_process = parse_json_in_process;
+    api_request_helper_->Request("POST", network_url, "", "application/json",
+                                 callback.Get(), options, {},
+                                 std::move(conversion_callback));
     base::RunLoop().RunUntilIdle();
   }
 
@@ -140,6 +142,52 @@ TEST_F(ApiRequestHelperUnitTest, SanitizedRequest) {
 #endif
 }
 
+// Falls back to the data decoder service when base is built without the
+// Rust JSON parser, so the results are the same either way.
+TEST_F(ApiRequestHelperUnitTest, SanitizedRequestInProcess) {
+  auto send_request = [this](const std::string& server_raw_response,
+                             const std::string& expected_body,
+                             const base::Value& expected_value_body) {
+    SendRequest(server_raw_response, expected_body, expected_value_body, 200,
+                net::OK, base::NullCallback(), false, true);
+  };
+  std::string expected_sanitized_response =
+      "{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":1.8446744073709552e+19}";
+  std::string server_raw_response =
+      "{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":18446744073709551615}";
+  send_request(server_raw_response, expected_sanitized_response,
+               ParseJson(expected_sanitized_response));
+  send_request("", "", base::Value());
+  send_request("{}", "{}", base::Value(base::Value::Type::DICT));
+  send_request("{", "", base::Value());
+  send_request("0", "", base::Value());
+  send_request("a", "", base::Value());
+#if !BUILDFLAG(IS_ANDROID)
+  send_request("{\"a\":1,}", "{\"a\":1}", ParseJson("{\"a\":1}"));
+#endif
+
+  // Large bodies are still parsed out of process, with the same result.
+  std::string large_value(APIRequestHelper::kMaxInProcessJsonSize, 'a');
+  std::string large_response = "{\"a\":\"" + large_value + "\"}";
+  send_request(large_response, large_response, ParseJson(large_response));
+}
+
+TEST_F(ApiRequestHelperUnitTest, RequestWithConversionInProcess) {
+  std::string expected_sanitized_response =
+      "{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":\"18446744073709551615\"}";
+  std::string server_raw_response =
+      "{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":18446744073709551615}";
+  SendRequest(server_raw_response, expected_sanitized_response,
+              ParseJson(expected_sanitized_response), 200, net::OK,
+              base::BindOnce(&ConversionCallback, server_raw_response,
+                             expected_sanitized_response),
+              false, true);
+  SendRequest(
+      server_raw_response, "", base::Value(), 200, net::OK,
+      base::BindOnce(&ConversionCallback, server_raw_response, "broken json"),
+      false, true);
+}
+
 TEST_F(ApiRequestHelperUnitTest, RequestWithConversion) {
   std::string expected_sanitized_response =
       "{\"id\":1,\"jsonrpc\":\"2.0\",\"result\":\"18446744073709551615\"}";
@@ -57,6 +57,7 @@ void AdsService::RegisterProfilePrefs(
   registry->RegisterIntegerPref(prefs::kCatalogVersion, 0);
   registry->RegisterInt64Pref(prefs::kCatalogPing, 0);
   registry->RegisterTimePref(prefs::kCatalogLastUpdated, base::Time());
+  registry->RegisterDictionaryPref(prefs::kCatalogCampaignDigests);
 
   registry->RegisterIntegerPref(prefs::kIssuerPing, 7'200'000);
   registry->RegisterListPref(prefs::kIssuers);
@@ -84,6 +84,10 @@ const char kCatalogPing[] = "brave.brave_ads.catalog_ping";
 // Stores catalog last updated
 const char kCatalogLastUpdated[] = "brave.brave_ads.catalog_last_updated";
 
+// Stores a digest of each saved catalog campaign by campaign id
+const char kCatalogCampaignDigests[] =
+    "brave.brave_ads.catalog_campaign_digests";
+
 // Stores issuers
 const char kIssuerPing[] = "brave.brave_ads.issuer_ping";
 const char kIssuers[] = "brave.brave_ads.issuers";
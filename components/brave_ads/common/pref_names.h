@@ -52,6 +52,7 @@ extern const char kCatalogId[];
 extern const char kCatalogVersion[];
 extern const char kCatalogPing[];
 extern const char kCatalogLastUpdated[];
+extern const char kCatalogCampaignDigests[];
 
 // Issuer prefs
 extern const char kIssuerPing[];
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "base/containers/flat_map.h"
 #include "base/time/time.h"
 #include "brave/components/brave_ads/core/internal/catalog/campaign/catalog_campaign_info.h"
 
@@ -31,6 +32,10 @@ struct CatalogInfo final {
   int version = 0;
   base::TimeDelta ping;
   CatalogCampaignList campaigns;
+  // Digest of the JSON of each campaign, so that only campaigns that changed
+  // are saved again. Not compared by operator==.
+  base::flat_map</*campaign_id*/ std::string, /*digest*/ std::string>
+      campaign_digests;
 };
 
 }  // namespace brave_ads
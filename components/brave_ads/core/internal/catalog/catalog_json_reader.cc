@@ -6,32 +6,73 @@
 #include "brave/components/brave_ads/core/internal/catalog/catalog_json_reader.h"
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "base/check.h"
+#include "base/no_destructor.h"
 #include "base/notreached.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/time/time.h"
 #include "brave/components/brave_ads/core/ad_constants.h"
 #include "brave/components/brave_ads/core/internal/ads_client_helper.h"
 #include "brave/components/brave_ads/core/internal/catalog/campaign/catalog_campaign_info.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_info.h"
+#include "brave/components/brave_ads/core/internal/common/crypto/crypto_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/common/url/url_util.h"
 #include "brave/components/brave_ads/core/internal/deprecated/json/json_helper.h"
+#include "brave/third_party/rapidjson/src/include/rapidjson/stringbuffer.h"
+#include "brave/third_party/rapidjson/src/include/rapidjson/writer.h"
 #include "url/gurl.h"
 
 namespace brave_ads::json::reader {
 
+namespace {
+
+struct CatalogSchema {
+  rapidjson::Document document;
+  std::unique_ptr<rapidjson::SchemaDocument> schema;
+};
+
+// The schema ships with the browser, so it is loaded and compiled once rather
+// than for every catalog.
+const rapidjson::SchemaDocument* GetCatalogSchema() {
+  static base::NoDestructor<CatalogSchema> catalog_schema;
+  if (!catalog_schema->schema) {
+    const std::string json_schema =
+        AdsClientHelper::GetInstance()->LoadDataResource(
+            data::resource::kCatalogJsonSchemaFilename);
+    catalog_schema->document.Parse(json_schema.c_str());
+    if (catalog_schema->document.HasParseError()) {
+      return nullptr;
+    }
+    catalog_schema->schema = std::make_unique<rapidjson::SchemaDocument>(
+        catalog_schema->document);
+  }
+
+  return catalog_schema->schema.get();
+}
+
+std::string BuildCampaignDigest(const rapidjson::Value& campaign_node) {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  campaign_node.Accept(writer);
+  const std::vector<uint8_t> sha256 =
+      crypto::Sha256(std::string(buffer.GetString(), buffer.GetSize()));
+  return base::HexEncode(sha256.data(), sha256.size());
+}
+
+}  // namespace
+
 // TODO(https://github.com/brave/brave-browser/issues/25987): Reduce cognitive
 // complexity.
 absl::optional<CatalogInfo> ReadCatalog(const std::string& json) {
   rapidjson::Document document;
   document.Parse(json.c_str());
 
-  const std::string json_schema =
-      AdsClientHelper::GetInstance()->LoadDataResource(
-          data::resource::kCatalogJsonSchemaFilename);
-
-  if (!helper::json::Validate(&document, json_schema)) {
+  const rapidjson::SchemaDocument* const schema = GetCatalogSchema();
+  if (!schema || !helper::json::Validate(&document, *schema)) {
     BLOG(1, helper::json::GetLastError(&document));
     return absl::nullopt;
   }
@@ -55,6 +96,8 @@ absl::optional<CatalogInfo> ReadCatalog(const std::string& json) {
     campaign.end_at = campaign_node["endAt"].GetString();
     campaign.daily_cap = campaign_node["dailyCap"].GetUint();
     campaign.advertiser_id = campaign_node["advertiserId"].GetString();
+    catalog.campaign_digests[campaign.campaign_id] =
+        BuildCampaignDigest(campaign_node);
 
     // Geo targets
     for (const auto& geo_target_node : campaign_node["geoTargets"].GetArray()) {
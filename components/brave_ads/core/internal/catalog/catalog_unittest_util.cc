@@ -0,0 +1,112 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/catalog/catalog_unittest_util.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "base/functional/bind.h"
+#include "base/json/json_writer.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/test/values_test_util.h"
+#include "brave/components/brave_ads/core/internal/catalog/catalog_info.h"
+#include "brave/components/brave_ads/core/internal/catalog/catalog_json_reader.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_file_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_database_table.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_ads {
+
+namespace {
+
+constexpr char kCatalogWithSingleCampaign[] =
+    "catalog_with_single_campaign.json";
+
+const base::Value::Dict& GetCampaign(const base::Value::Dict& catalog) {
+  const base::Value::List* const campaigns = catalog.FindList("campaigns");
+  CHECK(campaigns && !campaigns->empty());
+  return campaigns->front().GetDict();
+}
+
+std::string GetSuffix(const int index) {
+  return "-" + base::NumberToString(index);
+}
+
+}  // namespace
+
+base::Value::Dict ReadCatalogTemplate() {
+  const absl::optional<std::string> json =
+      ReadFileFromTestPathAndParseTagsToString(kCatalogWithSingleCampaign);
+  CHECK(json);
+  return base::test::ParseJsonDict(*json);
+}
+
+base::Value::Dict BuildCatalogCampaign(const base::Value::Dict& catalog,
+                                       const int index) {
+  base::Value::Dict campaign = GetCampaign(catalog).Clone();
+
+  const std::string suffix = GetSuffix(index);
+  campaign.Set("campaignId", GetCatalogCampaignId(catalog, index));
+  for (auto& creative_set : *campaign.FindList("creativeSets")) {
+    base::Value::Dict& creative_set_dict = creative_set.GetDict();
+    creative_set_dict.Set(
+        "creativeSetId",
+        *creative_set_dict.FindString("creativeSetId") + suffix);
+    for (auto& creative : *creative_set_dict.FindList("creatives")) {
+      base::Value::Dict& creative_dict = creative.GetDict();
+      creative_dict.Set(
+          "creativeInstanceId",
+          *creative_dict.FindString("creativeInstanceId") + suffix);
+    }
+  }
+
+  return campaign;
+}
+
+std::string GetCatalogCampaignId(const base::Value::Dict& catalog,
+                                 const int index) {
+  const std::string* const campaign_id =
+      GetCampaign(catalog).FindString("campaignId");
+  CHECK(campaign_id);
+  return *campaign_id + GetSuffix(index);
+}
+
+void SetCatalogCampaignNotificationAdTitle(base::Value::Dict& campaign,
+                                           const std::string& title) {
+  base::Value::Dict& creative = campaign.FindList("creativeSets")
+                                    ->front()
+                                    .GetDict()
+                                    .FindList("creatives")
+                                    ->front()
+                                    .GetDict();
+  creative.FindDict("payload")->Set("title", title);
+}
+
+CatalogInfo BuildCatalog(base::Value::Dict catalog,
+                         base::Value::List campaigns) {
+  catalog.Set("campaigns", std::move(campaigns));
+  std::string json;
+  CHECK(base::JSONWriter::Write(catalog, &json));
+  absl::optional<CatalogInfo> catalog_info = json::reader::ReadCatalog(json);
+  CHECK(catalog_info);
+  return std::move(*catalog_info);
+}
+
+size_t GetCreativeNotificationAdCount() {
+  size_t count = 0;
+  const database::table::CreativeNotificationAds database_table;
+  database_table.GetAll(base::BindOnce(
+      [](size_t* count, const bool success, const SegmentList& /*segments*/,
+         const CreativeNotificationAdList& creative_ads) {
+        EXPECT_TRUE(success);
+        *count = creative_ads.size();
+      },
+      &count));
+  return count;
+}
+
+}  // namespace brave_ads
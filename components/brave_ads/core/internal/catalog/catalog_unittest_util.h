@@ -0,0 +1,36 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CATALOG_CATALOG_UNITTEST_UTIL_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CATALOG_CATALOG_UNITTEST_UTIL_H_
+
+#include <cstddef>
+#include <string>
+
+#include "base/values.h"
+
+namespace brave_ads {
+
+struct CatalogInfo;
+
+// Returns the parsed "catalog_with_single_campaign.json" test catalog.
+base::Value::Dict ReadCatalogTemplate();
+
+// Returns a copy of the campaign in |catalog| with ids made unique by |index|.
+base::Value::Dict BuildCatalogCampaign(const base::Value::Dict& catalog,
+                                       int index);
+std::string GetCatalogCampaignId(const base::Value::Dict& catalog, int index);
+
+void SetCatalogCampaignNotificationAdTitle(base::Value::Dict& campaign,
+                                           const std::string& title);
+
+CatalogInfo BuildCatalog(base::Value::Dict catalog,
+                         base::Value::List campaigns);
+
+size_t GetCreativeNotificationAdCount();
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CATALOG_CATALOG_UNITTEST_UTIL_H_
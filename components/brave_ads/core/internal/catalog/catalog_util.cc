@@ -6,12 +6,17 @@
 #include "brave/components/brave_ads/core/internal/catalog/catalog_util.h"
 
 #include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "base/time/time.h"
+#include "base/values.h"
 #include "brave/components/brave_ads/common/pref_names.h"
 #include "brave/components/brave_ads/core/internal/account/deposits/deposits_database_util.h"
 #include "brave/components/brave_ads/core/internal/ads_client_helper.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_info.h"
+#include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/conversions/conversions_database_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/campaigns_database_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ads_database_util.h"
@@ -24,6 +29,7 @@
 #include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_database_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/promoted_content_ads/creative_promoted_content_ads_database_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/segments_database_util.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_ads {
 
@@ -31,6 +37,10 @@ namespace {
 
 constexpr base::TimeDelta kCatalogLifespan = base::Days(1);
 
+// Above this many changed or removed campaigns the catalog is saved again from
+// scratch, which also keeps the number of bound SQL parameters in check.
+constexpr size_t kMaximumChangedCampaigns = 100;
+
 void Delete() {
   database::DeleteCampaigns();
   database::DeleteCreativeNotificationAds();
@@ -49,18 +59,87 @@ void PurgeExpired() {
   database::PurgeExpiredDeposits();
 }
 
+base::Value::Dict GetCatalogCampaignDigests() {
+  absl::optional<base::Value::Dict> digests =
+      AdsClientHelper::GetInstance()->GetDictPref(
+          prefs::kCatalogCampaignDigests);
+  return digests ? std::move(*digests) : base::Value::Dict();
+}
+
+void SetCatalogCampaignDigests(const CatalogInfo& catalog) {
+  base::Value::Dict digests;
+  for (const auto& [campaign_id, digest] : catalog.campaign_digests) {
+    digests.Set(campaign_id, digest);
+  }
+  AdsClientHelper::GetInstance()->SetDictPref(prefs::kCatalogCampaignDigests,
+                                              std::move(digests));
+}
+
+bool HasCampaignChanged(const CatalogInfo& catalog,
+                        const std::string& campaign_id,
+                        const base::Value::Dict& saved_digests) {
+  const std::string* const saved_digest = saved_digests.FindString(campaign_id);
+  if (!saved_digest) {
+    return true;
+  }
+
+  const auto iter = catalog.campaign_digests.find(campaign_id);
+  return iter == catalog.campaign_digests.cend() ||
+         iter->second != *saved_digest;
+}
+
+// Returns the campaigns that have to be saved. Rows of campaigns that changed
+// or are no longer in the catalog are deleted, unchanged campaigns are left
+// alone.
+CatalogInfo DeleteChangedCampaigns(const CatalogInfo& catalog) {
+  const base::Value::Dict saved_digests = GetCatalogCampaignDigests();
+
+  std::vector<std::string> changed_campaign_ids;
+  for (const auto [campaign_id, digest] : saved_digests) {
+    if (HasCampaignChanged(catalog, campaign_id, saved_digests)) {
+      changed_campaign_ids.push_back(campaign_id);
+    }
+  }
+
+  CatalogInfo changed_catalog;
+  changed_catalog.id = catalog.id;
+  changed_catalog.version = catalog.version;
+  changed_catalog.ping = catalog.ping;
+
+  if (saved_digests.empty() ||
+      changed_campaign_ids.size() > kMaximumChangedCampaigns) {
+    Delete();
+    changed_catalog.campaigns = catalog.campaigns;
+    return changed_catalog;
+  }
+
+  database::DeleteCampaignsAndCreatives(changed_campaign_ids);
+
+  for (const auto& campaign : catalog.campaigns) {
+    if (HasCampaignChanged(catalog, campaign.campaign_id, saved_digests)) {
+      changed_catalog.campaigns.push_back(campaign);
+    }
+  }
+
+  BLOG(1, "Saving " << changed_catalog.campaigns.size() << " of "
+                    << catalog.campaigns.size() << " catalog campaigns");
+
+  return changed_catalog;
+}
+
 }  // namespace
 
 void SaveCatalog(const CatalogInfo& catalog) {
-  Delete();
+  const CatalogInfo changed_catalog = DeleteChangedCampaigns(catalog);
 
   PurgeExpired();
 
   SetCatalogId(catalog.id);
   SetCatalogVersion(catalog.version);
   SetCatalogPing(catalog.ping);
+  SetCatalogCampaignDigests(catalog);
 
-  const CreativesInfo creatives = BuildCreatives(catalog);
+  const CreativesInfo creatives = BuildCreatives(changed_catalog);
   database::SaveCreativeNotificationAds(creatives.notification_ads);
   database::SaveCreativeInlineContentAds(creatives.inline_content_ads);
   database::SaveCreativeNewTabPageAds(creatives.new_tab_page_ads);
@@ -73,6 +152,7 @@ void ResetCatalog() {
   AdsClientHelper::GetInstance()->ClearPref(prefs::kCatalogVersion);
   AdsClientHelper::GetInstance()->ClearPref(prefs::kCatalogPing);
   AdsClientHelper::GetInstance()->ClearPref(prefs::kCatalogLastUpdated);
+  AdsClientHelper::GetInstance()->ClearPref(prefs::kCatalogCampaignDigests);
 }
 
 std::string GetCatalogId() {
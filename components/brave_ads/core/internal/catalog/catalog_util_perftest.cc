@@ -0,0 +1,114 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/catalog/catalog_util.h"
+
+#include <string>
+#include <utility>
+
+#include "base/json/json_writer.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
+#include "base/timer/lap_timer.h"
+#include "base/values.h"
+#include "brave/components/brave_ads/core/internal/catalog/catalog_info.h"
+#include "brave/components/brave_ads/core/internal/catalog/catalog_json_reader.h"
+#include "brave/components/brave_ads/core/internal/catalog/catalog_unittest_util.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_ads {
+
+namespace {
+
+constexpr char kMetricPrefixCatalog[] = "Catalog.";
+constexpr char kMetricSaveCatalogTime[] = "save_catalog_time";
+constexpr char kMetricSaveChangedCampaignTime[] = "save_changed_campaign_time";
+
+constexpr int kWarmupRuns = 1;
+constexpr int kTimeCheckInterval = 1;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixCatalog, story);
+  reporter.RegisterImportantMetric(kMetricSaveCatalogTime, "us");
+  reporter.RegisterImportantMetric(kMetricSaveChangedCampaignTime, "us");
+  return reporter;
+}
+
+}  // namespace
+
+class BraveAdsCatalogUtilPerfTest : public UnitTestBase {
+ protected:
+  // Reads and saves a catalog with |campaign_count| campaigns until ads can be
+  // served from it, then saves it again with one changed campaign.
+  void RunSaveCatalogTest(const int campaign_count) {
+    const base::Value::Dict catalog = ReadCatalogTemplate();
+
+    base::Value::List campaigns;
+    for (int i = 0; i < campaign_count; ++i) {
+      campaigns.Append(BuildCatalogCampaign(catalog, i));
+    }
+    base::Value::Dict catalog_with_campaigns = catalog.Clone();
+    catalog_with_campaigns.Set("campaigns", campaigns.Clone());
+    std::string json;
+    ASSERT_TRUE(base::JSONWriter::Write(catalog_with_campaigns, &json));
+
+    // UnitTestBase mocks the clock, thread ticks keep running.
+    base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval,
+                         base::LapTimer::TimerMethod::kUseThreadTicks);
+    do {
+      // Saved digests would turn every lap after the first one into a no-op.
+      ResetCatalog();
+      const absl::optional<CatalogInfo> catalog_info =
+          json::reader::ReadCatalog(json);
+      ASSERT_TRUE(catalog_info);
+      SaveCatalog(*catalog_info);
+      ASSERT_EQ(static_cast<size_t>(campaign_count),
+                GetCreativeNotificationAdCount());
+      timer.NextLap();
+    } while (!timer.HasTimeLimitExpired());
+
+    // Alternates between two titles, so that every lap saves a changed
+    // campaign.
+    base::Value::Dict changed_campaign = campaigns.front().GetDict().Clone();
+    SetCatalogCampaignNotificationAdTitle(changed_campaign, "Changed title");
+    base::Value::List changed_campaigns = campaigns.Clone();
+    changed_campaigns.front() = base::Value(std::move(changed_campaign));
+    const CatalogInfo changed_catalog_info =
+        BuildCatalog(catalog.Clone(), std::move(changed_campaigns));
+    const CatalogInfo catalog_info =
+        BuildCatalog(catalog.Clone(), std::move(campaigns));
+
+    bool is_changed = false;
+    base::LapTimer changed_timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval,
+                                 base::LapTimer::TimerMethod::kUseThreadTicks);
+    do {
+      is_changed = !is_changed;
+      SaveCatalog(is_changed ? changed_catalog_info : catalog_info);
+      ASSERT_EQ(static_cast<size_t>(campaign_count),
+                GetCreativeNotificationAdCount());
+      changed_timer.NextLap();
+    } while (!changed_timer.HasTimeLimitExpired());
+
+    auto reporter =
+        SetUpReporter(base::NumberToString(campaign_count) + "_campaigns");
+    reporter.AddResult(kMetricSaveCatalogTime, timer.TimePerLap());
+    reporter.AddResult(kMetricSaveChangedCampaignTime,
+                       changed_timer.TimePerLap());
+  }
+};
+
+TEST_F(BraveAdsCatalogUtilPerfTest, SaveCatalog100) {
+  RunSaveCatalogTest(100);
+}
+
+TEST_F(BraveAdsCatalogUtilPerfTest, SaveCatalog500) {
+  RunSaveCatalogTest(500);
+}
+
+}  // namespace brave_ads
@@ -5,15 +5,52 @@
 
 #include "brave/components/brave_ads/core/internal/catalog/catalog_util.h"
 
+#include <string>
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/strings/string_util.h"
+#include "base/values.h"
+#include "brave/components/brave_ads/common/interfaces/ads.mojom.h"
 #include "brave/components/brave_ads/common/pref_names.h"
+#include "brave/components/brave_ads/core/internal/ads_client_mock.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_unittest_constants.h"
+#include "brave/components/brave_ads/core/internal/catalog/catalog_unittest_util.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_database_table.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 // npm run test -- brave_unit_tests --filter=BraveAds*
 
 namespace brave_ads {
 
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::AtLeast;
+
+namespace {
+
+// Matches transactions which insert, update or delete rows bound to |value|.
+MATCHER_P(WritesRowsFor, value, "") {
+  for (const auto& command : arg->commands) {
+    if (command->type == mojom::DBCommandInfo::Type::READ) {
+      continue;
+    }
+
+    for (const auto& binding : command->bindings) {
+      if (binding->value->is_string_value() &&
+          binding->value->get_string_value() == value) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
 class BraveAdsCatalogUtilTest : public UnitTestBase {};
 
 TEST_F(BraveAdsCatalogUtilTest, ResetCatalog) {
@@ -30,7 +67,108 @@ TEST_F(BraveAdsCatalogUtilTest, ResetCatalog) {
   EXPECT_TRUE(!ads_client_mock_->HasPrefPath(prefs::kCatalogId) &&
               !ads_client_mock_->HasPrefPath(prefs::kCatalogVersion) &&
               !ads_client_mock_->HasPrefPath(prefs::kCatalogPing) &&
-              !ads_client_mock_->HasPrefPath(prefs::kCatalogLastUpdated));
+              !ads_client_mock_->HasPrefPath(prefs::kCatalogLastUpdated) &&
+              !ads_client_mock_->HasPrefPath(prefs::kCatalogCampaignDigests));
+}
+
+TEST_F(BraveAdsCatalogUtilTest, SaveOnlyChangedCatalogCampaigns) {
+  // Arrange
+  const base::Value::Dict catalog = ReadCatalogTemplate();
+
+  base::Value::List campaigns;
+  for (int i = 0; i < 3; ++i) {
+    campaigns.Append(BuildCatalogCampaign(catalog, i));
+  }
+  SaveCatalog(BuildCatalog(catalog.Clone(), std::move(campaigns)));
+
+  base::Value::List changed_campaigns;
+  changed_campaigns.Append(BuildCatalogCampaign(catalog, 0));
+  base::Value::Dict changed_campaign = BuildCatalogCampaign(catalog, 1);
+  SetCatalogCampaignNotificationAdTitle(changed_campaign, "Changed title");
+  changed_campaigns.Append(std::move(changed_campaign));
+  changed_campaigns.Append(BuildCatalogCampaign(catalog, 3));
+  const CatalogInfo changed_catalog =
+      BuildCatalog(catalog.Clone(), std::move(changed_campaigns));
+
+  EXPECT_CALL(*ads_client_mock_, RunDBTransaction(_, _)).Times(AnyNumber());
+  // The removed campaign is deleted, the unchanged one is left alone.
+  EXPECT_CALL(*ads_client_mock_,
+              RunDBTransaction(
+                  WritesRowsFor(GetCatalogCampaignId(catalog, /*index*/ 2)), _))
+      .Times(1);
+  EXPECT_CALL(*ads_client_mock_,
+              RunDBTransaction(
+                  WritesRowsFor(GetCatalogCampaignId(catalog, /*index*/ 0)), _))
+      .Times(0);
+
+  // Act
+  SaveCatalog(changed_catalog);
+
+  // Assert
+  const database::table::CreativeNotificationAds database_table;
+  database_table.GetAll(base::BindOnce(
+      [](const bool success, const SegmentList& /*segments*/,
+         const CreativeNotificationAdList& creative_ads) {
+        EXPECT_TRUE(success);
+        ASSERT_EQ(3U, creative_ads.size());
+        for (const auto& creative_ad : creative_ads) {
+          EXPECT_FALSE(base::EndsWith(creative_ad.campaign_id, "-2"));
+          EXPECT_EQ(base::EndsWith(creative_ad.campaign_id, "-1"),
+                    creative_ad.title == "Changed title");
+        }
+      }));
+
+  const absl::optional<base::Value::Dict> digests =
+      ads_client_mock_->GetDictPref(prefs::kCatalogCampaignDigests);
+  ASSERT_TRUE(digests);
+  EXPECT_EQ(3U, digests->size());
+}
+
+TEST_F(BraveAdsCatalogUtilTest, SaveWholeCatalogIfTooManyCampaignsChanged) {
+  // Arrange
+  constexpr int kCampaignCount = 102;
+
+  const base::Value::Dict catalog = ReadCatalogTemplate();
+
+  base::Value::List campaigns;
+  for (int i = 0; i < kCampaignCount; ++i) {
+    campaigns.Append(BuildCatalogCampaign(catalog, i));
+  }
+  SaveCatalog(BuildCatalog(catalog.Clone(), std::move(campaigns)));
+
+  // Every campaign but the first one changed, which is more than are deleted
+  // one by one.
+  base::Value::List changed_campaigns;
+  changed_campaigns.Append(BuildCatalogCampaign(catalog, 0));
+  for (int i = 1; i < kCampaignCount; ++i) {
+    base::Value::Dict changed_campaign = BuildCatalogCampaign(catalog, i);
+    SetCatalogCampaignNotificationAdTitle(changed_campaign, "Changed title");
+    changed_campaigns.Append(std::move(changed_campaign));
+  }
+  const CatalogInfo changed_catalog =
+      BuildCatalog(catalog.Clone(), std::move(changed_campaigns));
+
+  EXPECT_CALL(*ads_client_mock_, RunDBTransaction(_, _)).Times(AnyNumber());
+  EXPECT_CALL(*ads_client_mock_,
+              RunDBTransaction(
+                  WritesRowsFor(GetCatalogCampaignId(catalog, /*index*/ 0)), _))
+      .Times(AtLeast(1));
+
+  // Act
+  SaveCatalog(changed_catalog);
+
+  // Assert
+  const database::table::CreativeNotificationAds database_table;
+  database_table.GetAll(base::BindOnce(
+      [](const bool success, const SegmentList& /*segments*/,
+         const CreativeNotificationAdList& creative_ads) {
+        EXPECT_TRUE(success);
+        ASSERT_EQ(static_cast<size_t>(kCampaignCount), creative_ads.size());
+        for (const auto& creative_ad : creative_ads) {
+          EXPECT_EQ(base::EndsWith(creative_ad.campaign_id, "-0"),
+                    creative_ad.title != "Changed title");
+        }
+      }));
 }
 
 TEST_F(BraveAdsCatalogUtilTest, CatalogExists) {
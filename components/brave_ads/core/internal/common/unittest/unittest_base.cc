@@ -388,6 +388,8 @@ void UnitTestBase::MockDefaultPrefs() {
   ads_client_mock_->SetIntegerPref(prefs::kCatalogVersion, 1);
   ads_client_mock_->SetInt64Pref(prefs::kCatalogPing, 7'200'000);
   ads_client_mock_->SetTimePref(prefs::kCatalogLastUpdated, DistantPast());
+  ads_client_mock_->SetDictPref(prefs::kCatalogCampaignDigests,
+                                base::Value::Dict());
 
   ads_client_mock_->SetInt64Pref(prefs::kIssuerPing, 0);
   ads_client_mock_->SetListPref(prefs::kIssuers, base::Value::List());
@@ -6,6 +6,7 @@
 #include "brave/components/brave_ads/core/internal/creatives/campaigns_database_table.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
 #include "base/functional/bind.h"
@@ -15,6 +16,9 @@
 #include "brave/components/brave_ads/core/internal/common/database/database_bind_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_table_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/inline_content_ads/creative_inline_content_ads_snapshot.h"
+#include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ads_snapshot.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_snapshot.h"
 
 namespace brave_ads::database::table {
 
@@ -22,6 +26,10 @@ namespace {
 
 constexpr char kTableName[] = "campaigns";
 
+constexpr const char* kCreativeAdTableNames[] = {
+    "creative_ad_notifications", "creative_inline_content_ads",
+    "creative_new_tab_page_ads", "creative_promoted_content_ads"};
+
 int BindParameters(mojom::DBCommandInfo* command,
                    const CreativeAdList& creative_ads) {
   DCHECK(command);
@@ -44,6 +52,57 @@ int BindParameters(mojom::DBCommandInfo* command,
   return count;
 }
 
+// Deletes the rows of |table_name| whose |column| is in the rows of the
+// creative ad tables that belong to |campaign_ids|.
+void DeleteFromCreativeAdTables(mojom::DBTransactionInfo* transaction,
+                                const std::string& table_name,
+                                const std::string& column,
+                                const std::vector<std::string>& campaign_ids) {
+  DCHECK(transaction);
+
+  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+  command->type = mojom::DBCommandInfo::Type::RUN;
+
+  const std::string placeholder =
+      BuildBindingParameterPlaceholder(campaign_ids.size());
+  std::vector<std::string> selects;
+  int index = 0;
+  for (const char* const creative_ad_table_name : kCreativeAdTableNames) {
+    selects.push_back(base::ReplaceStringPlaceholders(
+        "SELECT $1 FROM $2 WHERE campaign_id IN $3",
+        {column, creative_ad_table_name, placeholder}, nullptr));
+    for (const auto& campaign_id : campaign_ids) {
+      BindString(command.get(), index++, campaign_id);
+    }
+  }
+
+  command->command = base::ReplaceStringPlaceholders(
+      "DELETE FROM $1 WHERE $2 IN ($3)",
+      {table_name, column, base::JoinString(selects, " UNION ")}, nullptr);
+
+  transaction->commands.push_back(std::move(command));
+}
+
+void DeleteWithCampaignIds(mojom::DBTransactionInfo* transaction,
+                           const std::string& table_name,
+                           const std::vector<std::string>& campaign_ids) {
+  DCHECK(transaction);
+
+  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+  command->type = mojom::DBCommandInfo::Type::RUN;
+  command->command = base::ReplaceStringPlaceholders(
+      "DELETE FROM $1 WHERE campaign_id IN $2",
+      {table_name, BuildBindingParameterPlaceholder(campaign_ids.size())},
+      nullptr);
+
+  int index = 0;
+  for (const auto& campaign_id : campaign_ids) {
+    BindString(command.get(), index++, campaign_id);
+  }
+
+  transaction->commands.push_back(std::move(command));
+}
+
 void MigrateToV24(mojom::DBTransactionInfo* transaction) {
   DCHECK(transaction);
 
@@ -78,6 +137,44 @@ void Campaigns::Delete(ResultCallback callback) const {
       base::BindOnce(&OnResultCallback, std::move(callback)));
 }
 
+void Campaigns::DeleteCampaignsAndCreatives(
+    const std::vector<std::string>& campaign_ids,
+    ResultCallback callback) const {
+  if (campaign_ids.empty()) {
+    return std::move(callback).Run(/*success*/ true);
+  }
+
+  CreativeInlineContentAdsSnapshot::GetInstance()->Invalidate();
+  CreativeNewTabPageAdsSnapshot::GetInstance()->Invalidate();
+  CreativeNotificationAdsSnapshot::GetInstance()->Invalidate();
+
+  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+
+  // Rows keyed by creative instance or creative set are found through the
+  // creative ad tables, so they go first.
+  DeleteFromCreativeAdTables(transaction.get(), "creative_ads",
+                             "creative_instance_id", campaign_ids);
+  DeleteFromCreativeAdTables(transaction.get(),
+                             "creative_new_tab_page_ad_wallpapers",
+                             "creative_instance_id", campaign_ids);
+  DeleteFromCreativeAdTables(transaction.get(), "segments", "creative_set_id",
+                             campaign_ids);
+  DeleteFromCreativeAdTables(transaction.get(), "embeddings", "creative_set_id",
+                             campaign_ids);
+
+  for (const char* const creative_ad_table_name : kCreativeAdTableNames) {
+    DeleteWithCampaignIds(transaction.get(), creative_ad_table_name,
+                          campaign_ids);
+  }
+  DeleteWithCampaignIds(transaction.get(), "geo_targets", campaign_ids);
+  DeleteWithCampaignIds(transaction.get(), "dayparts", campaign_ids);
+  DeleteWithCampaignIds(transaction.get(), GetTableName(), campaign_ids);
+
+  AdsClientHelper::GetInstance()->RunDBTransaction(
+      std::move(transaction),
+      base::BindOnce(&OnResultCallback, std::move(callback)));
+}
+
 void Campaigns::InsertOrUpdate(mojom::DBTransactionInfo* transaction,
                                const CreativeAdList& creative_ads) {
   DCHECK(transaction);
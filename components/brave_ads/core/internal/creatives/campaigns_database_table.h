@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_CAMPAIGNS_DATABASE_TABLE_H_
 
 #include <string>
+#include <vector>
 
 #include "brave/components/brave_ads/common/interfaces/ads.mojom-forward.h"
 #include "brave/components/brave_ads/core/ads_client_callback.h"
@@ -22,6 +23,11 @@ class Campaigns final : public TableInterface {
 
   void Delete(ResultCallback callback) const;
 
+  // Deletes the given campaigns together with their creative ads, creative
+  // sets, segments, embeddings, geo targets and dayparts.
+  void DeleteCampaignsAndCreatives(const std::vector<std::string>& campaign_ids,
+                                   ResultCallback callback) const;
+
   std::string GetTableName() const override;
 
   void Migrate(mojom::DBTransactionInfo* transaction, int to_version) override;
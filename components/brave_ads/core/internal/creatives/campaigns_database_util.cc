@@ -23,4 +23,17 @@ void DeleteCampaigns() {
   }));
 }
 
+void DeleteCampaignsAndCreatives(const std::vector<std::string>& campaign_ids) {
+  const table::Campaigns database_table;
+  database_table.DeleteCampaignsAndCreatives(
+      campaign_ids, base::BindOnce([](const bool success) {
+        if (!success) {
+          BLOG(0, "Failed to delete campaigns and creatives");
+          return;
+        }
+
+        BLOG(3, "Successfully deleted campaigns and creatives");
+      }));
+}
+
 }  // namespace brave_ads::database
@@ -6,9 +6,13 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_CAMPAIGNS_DATABASE_UTIL_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_CAMPAIGNS_DATABASE_UTIL_H_
 
+#include <string>
+#include <vector>
+
 namespace brave_ads::database {
 
 void DeleteCampaigns();
+void DeleteCampaignsAndCreatives(const std::vector<std::string>& campaign_ids);
 
 }  // namespace brave_ads::database
 
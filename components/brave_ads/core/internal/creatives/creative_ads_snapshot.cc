@@ -0,0 +1,32 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/creatives/creative_ads_snapshot.h"
+
+#include "base/containers/contains.h"
+
+namespace brave_ads {
+
+void MergeCreativeAdRow(const CreativeAdInfo& row,
+                        CreativeAdInfo& creative_ad) {
+  creative_ad.geo_targets.insert(row.geo_targets.cbegin(),
+                                 row.geo_targets.cend());
+
+  for (const auto& daypart : row.dayparts) {
+    if (!base::Contains(creative_ad.dayparts, daypart)) {
+      creative_ad.dayparts.push_back(daypart);
+    }
+  }
+}
+
+bool IsCreativeAdActive(const CreativeAdInfo& creative_ad,
+                        const base::Time time) {
+  // Compare the same double timestamps as the database does.
+  const double timestamp = time.ToDoubleT();
+  return timestamp >= creative_ad.start_at.ToDoubleT() &&
+         timestamp <= creative_ad.end_at.ToDoubleT();
+}
+
+}  // namespace brave_ads
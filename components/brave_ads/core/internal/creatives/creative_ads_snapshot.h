@@ -0,0 +1,129 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_CREATIVE_ADS_SNAPSHOT_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_CREATIVE_ADS_SNAPSHOT_H_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+#include "base/containers/flat_map.h"
+#include "base/strings/string_util.h"
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
+#include "brave/components/brave_ads/core/internal/segments/segment_alias.h"
+
+namespace brave_ads {
+
+// Appends the geo targets and dayparts of |row|, another row of the joined
+// tables for the same creative instance, to |creative_ad|. Creative ad types
+// with more joined details overload this in their snapshot header.
+void MergeCreativeAdRow(const CreativeAdInfo& row, CreativeAdInfo& creative_ad);
+
+bool IsCreativeAdActive(const CreativeAdInfo& creative_ad, base::Time time);
+
+// Denormalized, in-memory copy of creative ads of type |T| joined with their
+// campaigns, segments, geo targets and dayparts, indexed by segment, so that
+// ad serving does not have to query the database on every attempt. The
+// snapshot holds scheduled and expired campaigns too and filters them when
+// read, so it stays valid until the creatives are written again.
+template <typename T>
+class CreativeAdsSnapshot {
+ public:
+  CreativeAdsSnapshot() = default;
+
+  CreativeAdsSnapshot(const CreativeAdsSnapshot&) = delete;
+  CreativeAdsSnapshot& operator=(const CreativeAdsSnapshot&) = delete;
+
+  CreativeAdsSnapshot(CreativeAdsSnapshot&&) noexcept = delete;
+  CreativeAdsSnapshot& operator=(CreativeAdsSnapshot&&) noexcept = delete;
+
+  ~CreativeAdsSnapshot() = default;
+
+  bool IsBuilt() const { return is_built_; }
+
+  // Incremented whenever the snapshot is invalidated, so that a snapshot
+  // loaded before the creatives were written can be told apart.
+  int GetGeneration() const { return generation_; }
+
+  // |creative_ads| holds one creative ad for each row of the joined tables,
+  // i.e. with a single segment, geo target and daypart.
+  void Build(const std::vector<T>& creative_ads) {
+    creative_ads_.clear();
+
+    for (const auto& creative_ad : creative_ads) {
+      CreativeAdMap& segment_creative_ads = creative_ads_[creative_ad.segment];
+
+      const auto [iter, inserted] = segment_creative_ads.insert(
+          {creative_ad.creative_instance_id, creative_ad});
+      if (!inserted) {
+        MergeCreativeAdRow(creative_ad, iter->second);
+      }
+    }
+
+    is_built_ = true;
+  }
+
+  void Invalidate() {
+    generation_++;
+    is_built_ = false;
+    creative_ads_.clear();
+  }
+
+  std::vector<T> GetForSegments(const SegmentList& segments,
+                                const base::Time time) const {
+    DCHECK(is_built_);
+
+    // Segments are stored in lowercase, see |database::table::Segments|.
+    CreativeAdMap eligible_creative_ads;
+    for (const auto& segment : segments) {
+      const auto iter = creative_ads_.find(base::ToLowerASCII(segment));
+      if (iter == creative_ads_.cend()) {
+        continue;
+      }
+
+      for (const auto& [creative_instance_id, creative_ad] : iter->second) {
+        if (IsCreativeAdActive(creative_ad, time)) {
+          eligible_creative_ads.insert({creative_instance_id, creative_ad});
+        }
+      }
+    }
+
+    std::vector<T> creative_ads;
+    creative_ads.reserve(eligible_creative_ads.size());
+    for (auto& [creative_instance_id, creative_ad] : eligible_creative_ads) {
+      creative_ads.push_back(std::move(creative_ad));
+    }
+
+    return creative_ads;
+  }
+
+  std::vector<T> GetAll(const base::Time time) const {
+    DCHECK(is_built_);
+
+    SegmentList segments;
+    segments.reserve(creative_ads_.size());
+    for (const auto& [segment, segment_creative_ads] : creative_ads_) {
+      segments.push_back(segment);
+    }
+
+    return GetForSegments(segments, time);
+  }
+
+ private:
+  using CreativeAdMap = std::map</*creative_instance_id*/ std::string, T>;
+
+  bool is_built_ = false;
+  int generation_ = 0;
+
+  base::flat_map</*segment*/ std::string, CreativeAdMap> creative_ads_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_CREATIVE_ADS_SNAPSHOT_H_
@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/creatives/inline_content_ads/creative_inline_content_ads_database_table.h"
 
+#include <iterator>
 #include <map>
 #include <utility>
 #include <vector>
@@ -12,6 +13,7 @@
 #include "base/containers/contains.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/string_util.h"
 #include "base/time/time.h"
 #include "brave/components/brave_ads/common/interfaces/ads.mojom.h"
@@ -23,12 +25,12 @@
 #include "brave/components/brave_ads/core/internal/common/database/database_table_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
-#include "brave/components/brave_ads/core/internal/common/time/time_formatting_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/campaigns_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ads_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/dayparts_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/geo_targets_database_table.h"
+#include "brave/components/brave_ads/core/internal/creatives/inline_content_ads/creative_inline_content_ads_snapshot.h"
 #include "brave/components/brave_ads/core/internal/creatives/segments_database_table.h"
 #include "brave/components/brave_ads/core/internal/segments/segment_util.h"
 #include "url/gurl.h"
@@ -40,6 +42,10 @@ using CreativeInlineContentAdMap =
 
 namespace {
 
+using GetSnapshotCallback =
+    base::OnceCallback<void(bool success,
+                            const CreativeInlineContentAdsSnapshot& snapshot)>;
+
 constexpr char kTableName[] = "creative_inline_content_ads";
 
 constexpr int kDefaultBatchSize = 50;
@@ -155,6 +161,128 @@ CreativeInlineContentAdList GetCreativeAdsFromResponse(
   return creative_ads;
 }
 
+CreativeInlineContentAdList GetRowsFromResponse(
+    mojom::DBCommandResponseInfoPtr command_response) {
+  DCHECK(command_response);
+
+  CreativeInlineContentAdList creative_ads;
+  for (const auto& record : command_response->result->get_records()) {
+    creative_ads.push_back(GetFromRecord(record.get()));
+  }
+
+  return creative_ads;
+}
+
+CreativeInlineContentAdList FilterCreativeAdsForDimensions(
+    const CreativeInlineContentAdList& creative_ads,
+    const std::string& dimensions) {
+  CreativeInlineContentAdList filtered_creative_ads;
+  base::ranges::copy_if(
+      creative_ads, std::back_inserter(filtered_creative_ads),
+      [&dimensions](const CreativeInlineContentAdInfo& creative_ad) {
+        return creative_ad.dimensions == dimensions;
+      });
+
+  return filtered_creative_ads;
+}
+
+void OnGetSnapshot(const int generation,
+                   GetSnapshotCallback callback,
+                   mojom::DBCommandResponseInfoPtr command_response) {
+  if (!command_response ||
+      command_response->status !=
+          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+    const CreativeInlineContentAdsSnapshot snapshot;
+    return std::move(callback).Run(/*success*/ false, snapshot);
+  }
+
+  const CreativeInlineContentAdList creative_ads =
+      GetRowsFromResponse(std::move(command_response));
+
+  CreativeInlineContentAdsSnapshot* const snapshot =
+      CreativeInlineContentAdsSnapshot::GetInstance();
+  if (snapshot->GetGeneration() == generation) {
+    snapshot->Build(creative_ads);
+    return std::move(callback).Run(/*success*/ true, *snapshot);
+  }
+
+  // The creative ads were written while they were being read, so answer this
+  // request without keeping the outdated snapshot.
+  CreativeInlineContentAdsSnapshot outdated_snapshot;
+  outdated_snapshot.Build(creative_ads);
+  std::move(callback).Run(/*success*/ true, outdated_snapshot);
+}
+
+void GetSnapshot(GetSnapshotCallback callback) {
+  const CreativeInlineContentAdsSnapshot* const snapshot =
+      CreativeInlineContentAdsSnapshot::GetInstance();
+  if (snapshot->IsBuilt()) {
+    return std::move(callback).Run(/*success*/ true, *snapshot);
+  }
+
+  // Scheduled and expired campaigns are included, the snapshot filters them
+  // when read.
+  const std::string query = base::ReplaceStringPlaceholders(
+      "SELECT cbna.creative_instance_id, cbna.creative_set_id, "
+      "cbna.campaign_id, cam.start_at_timestamp, cam.end_at_timestamp, "
+      "cam.daily_cap, cam.advertiser_id, cam.priority, ca.conversion, "
+      "ca.per_day, ca.per_week, ca.per_month, ca.total_max, ca.value, "
+      "ca.split_test_group, s.segment, gt.geo_target, ca.target_url, "
+      "cbna.title, cbna.description, cbna.image_url, cbna.dimensions, "
+      "cbna.cta_text, cam.ptr, dp.dow, dp.start_minute, dp.end_minute FROM $1 "
+      "AS cbna INNER JOIN campaigns AS cam ON cam.campaign_id = "
+      "cbna.campaign_id INNER JOIN segments AS s ON s.creative_set_id = "
+      "cbna.creative_set_id INNER JOIN creative_ads AS ca ON "
+      "ca.creative_instance_id = cbna.creative_instance_id INNER JOIN "
+      "geo_targets AS gt ON gt.campaign_id = cbna.campaign_id INNER JOIN "
+      "dayparts AS dp ON dp.campaign_id = cbna.campaign_id",
+      {kTableName}, nullptr);
+
+  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+  command->type = mojom::DBCommandInfo::Type::READ;
+  command->command = query;
+
+  command->record_bindings = {
+      mojom::DBCommandInfo::RecordBindingType::
+          STRING_TYPE,  // creative_instance_id
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
+      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // split_test_group
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // title
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // description
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // image_url
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dimensions
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // cta_text
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
+      mojom::DBCommandInfo::RecordBindingType::
+          INT_TYPE,  // dayparts->start_minute
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE  // dayparts->end_minute
+  };
+
+  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+  transaction->commands.push_back(std::move(command));
+
+  AdsClientHelper::GetInstance()->RunDBTransaction(
+      std::move(transaction),
+      base::BindOnce(&OnGetSnapshot, snapshot->GetGeneration(),
+                     std::move(callback)));
+}
+
 void OnGetForCreativeInstanceId(
     const std::string& creative_instance_id,
     GetCreativeInlineContentAdCallback callback,
@@ -183,50 +311,51 @@ void OnGetForCreativeInstanceId(
 
 void OnGetForSegmentsAndDimensions(
     const SegmentList& segments,
+    const std::string& dimensions,
     GetCreativeInlineContentAdsCallback callback,
-    mojom::DBCommandResponseInfoPtr command_response) {
-  if (!command_response ||
-      command_response->status !=
-          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+    const bool success,
+    const CreativeInlineContentAdsSnapshot& snapshot) {
+  if (!success) {
     BLOG(0, "Failed to get creative inline content ads");
     return std::move(callback).Run(/*success*/ false, segments,
                                    /*creative_ad*/ {});
   }
 
   const CreativeInlineContentAdList creative_ads =
-      GetCreativeAdsFromResponse(std::move(command_response));
+      FilterCreativeAdsForDimensions(
+          snapshot.GetForSegments(segments, base::Time::Now()), dimensions);
 
   std::move(callback).Run(/*success*/ true, segments, creative_ads);
 }
 
 void OnGetForDimensions(
+    const std::string& dimensions,
     GetCreativeInlineContentAdsForDimensionsCallback callback,
-    mojom::DBCommandResponseInfoPtr command_response) {
-  if (!command_response ||
-      command_response->status !=
-          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+    const bool success,
+    const CreativeInlineContentAdsSnapshot& snapshot) {
+  if (!success) {
     BLOG(0, "Failed to get creative inline content ads");
     return std::move(callback).Run(/*success*/ false, /*creative_ad*/ {});
   }
 
   const CreativeInlineContentAdList creative_ads =
-      GetCreativeAdsFromResponse(std::move(command_response));
+      FilterCreativeAdsForDimensions(snapshot.GetAll(base::Time::Now()),
+                                     dimensions);
 
   std::move(callback).Run(/*success*/ true, creative_ads);
 }
 
 void OnGetAll(GetCreativeInlineContentAdsCallback callback,
-              mojom::DBCommandResponseInfoPtr command_response) {
-  if (!command_response ||
-      command_response->status !=
-          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+              const bool success,
+              const CreativeInlineContentAdsSnapshot& snapshot) {
+  if (!success) {
     BLOG(0, "Failed to get all creative inline content ads");
     return std::move(callback).Run(/*success*/ false, /*segments*/ {},
                                    /*creative_ads*/ {});
   }
 
   const CreativeInlineContentAdList creative_ads =
-      GetCreativeAdsFromResponse(std::move(command_response));
+      snapshot.GetAll(base::Time::Now());
 
   const SegmentList segments = GetSegments(creative_ads);
 
@@ -276,6 +405,8 @@ void CreativeInlineContentAds::Save(
     return std::move(callback).Run(/*success*/ true);
   }
 
+  CreativeInlineContentAdsSnapshot::GetInstance()->Invalidate();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   const std::vector<CreativeInlineContentAdList> batches =
@@ -305,6 +436,8 @@ void CreativeInlineContentAds::Save(
 }
 
 void CreativeInlineContentAds::Delete(ResultCallback callback) const {
+  CreativeInlineContentAdsSnapshot::GetInstance()->Invalidate();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   DeleteTable(transaction.get(), GetTableName());
@@ -393,74 +526,8 @@ void CreativeInlineContentAds::GetForSegmentsAndDimensions(
                                    /*creative_ads*/ {});
   }
 
-  const std::string query = base::ReplaceStringPlaceholders(
-      "SELECT cbna.creative_instance_id, cbna.creative_set_id, "
-      "cbna.campaign_id, cam.start_at_timestamp, cam.end_at_timestamp, "
-      "cam.daily_cap, cam.advertiser_id, cam.priority, ca.conversion, "
-      "ca.per_day, ca.per_week, ca.per_month, ca.total_max, ca.value, "
-      "ca.split_test_group, s.segment, gt.geo_target, ca.target_url, "
-      "cbna.title, cbna.description, cbna.image_url, cbna.dimensions, "
-      "cbna.cta_text, cam.ptr, dp.dow, dp.start_minute, dp.end_minute FROM $1 "
-      "AS cbna INNER JOIN campaigns AS cam ON cam.campaign_id = "
-      "cbna.campaign_id INNER JOIN segments AS s ON s.creative_set_id = "
-      "cbna.creative_set_id INNER JOIN creative_ads AS ca ON "
-      "ca.creative_instance_id = cbna.creative_instance_id INNER JOIN "
-      "geo_targets AS gt ON gt.campaign_id = cbna.campaign_id INNER JOIN "
-      "dayparts AS dp ON dp.campaign_id = cbna.campaign_id WHERE s.segment IN "
-      "$2 AND cbna.dimensions = '$3' AND $4 BETWEEN cam.start_at_timestamp AND "
-      "cam.end_at_timestamp",
-      {GetTableName(), BuildBindingParameterPlaceholder(segments.size()),
-       dimensions, TimeAsTimestampString(base::Time::Now())},
-      nullptr);
-
-  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
-  command->type = mojom::DBCommandInfo::Type::READ;
-  command->command = query;
-
-  int index = 0;
-  for (const auto& segment : segments) {
-    BindString(command.get(), index, base::ToLowerASCII(segment));
-    index++;
-  }
-
-  command->record_bindings = {
-      mojom::DBCommandInfo::RecordBindingType::
-          STRING_TYPE,  // creative_instance_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
-      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // split_test_group
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // title
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // description
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // image_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dimensions
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // cta_text
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // dayparts->start_minute
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE  // dayparts->end_minute
-  };
-
-  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
-  transaction->commands.push_back(std::move(command));
-
-  AdsClientHelper::GetInstance()->RunDBTransaction(
-      std::move(transaction), base::BindOnce(&OnGetForSegmentsAndDimensions,
-                                             segments, std::move(callback)));
+  GetSnapshot(base::BindOnce(&OnGetForSegmentsAndDimensions, segments,
+                             dimensions, std::move(callback)));
 }
 
 void CreativeInlineContentAds::GetForDimensions(
@@ -470,128 +537,13 @@ void CreativeInlineContentAds::GetForDimensions(
     return std::move(callback).Run(/*success*/ true, /*creative_ads*/ {});
   }
 
-  const std::string query = base::ReplaceStringPlaceholders(
-      "SELECT cbna.creative_instance_id, cbna.creative_set_id, "
-      "cbna.campaign_id, cam.start_at_timestamp, cam.end_at_timestamp, "
-      "cam.daily_cap, cam.advertiser_id, cam.priority, ca.conversion, "
-      "ca.per_day, ca.per_week, ca.per_month, ca.total_max, ca.value, "
-      "ca.split_test_group, s.segment, gt.geo_target, ca.target_url, "
-      "cbna.title, cbna.description, cbna.image_url, cbna.dimensions, "
-      "cbna.cta_text, cam.ptr, dp.dow, dp.start_minute, dp.end_minute FROM $1 "
-      "AS cbna INNER JOIN campaigns AS cam ON cam.campaign_id = "
-      "cbna.campaign_id INNER JOIN segments AS s ON s.creative_set_id = "
-      "cbna.creative_set_id INNER JOIN creative_ads AS ca ON "
-      "ca.creative_instance_id = cbna.creative_instance_id INNER JOIN "
-      "geo_targets AS gt ON gt.campaign_id = cbna.campaign_id INNER JOIN "
-      "dayparts AS dp ON dp.campaign_id = cbna.campaign_id AND cbna.dimensions "
-      "= '$2' AND $3 BETWEEN cam.start_at_timestamp AND cam.end_at_timestamp",
-      {GetTableName(), dimensions, TimeAsTimestampString(base::Time::Now())},
-      nullptr);
-
-  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
-  command->type = mojom::DBCommandInfo::Type::READ;
-  command->command = query;
-
-  command->record_bindings = {
-      mojom::DBCommandInfo::RecordBindingType::
-          STRING_TYPE,  // creative_instance_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
-      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // split_test_group
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // title
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // description
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // image_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dimensions
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // cta_text
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // dayparts->start_minute
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE  // dayparts->end_minute
-  };
-
-  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
-  transaction->commands.push_back(std::move(command));
-
-  AdsClientHelper::GetInstance()->RunDBTransaction(
-      std::move(transaction),
-      base::BindOnce(&OnGetForDimensions, std::move(callback)));
+  GetSnapshot(
+      base::BindOnce(&OnGetForDimensions, dimensions, std::move(callback)));
 }
 
 void CreativeInlineContentAds::GetAll(
     GetCreativeInlineContentAdsCallback callback) const {
-  const std::string query = base::ReplaceStringPlaceholders(
-      "SELECT cbna.creative_instance_id, cbna.creative_set_id, "
-      "cbna.campaign_id, cam.start_at_timestamp, cam.end_at_timestamp, "
-      "cam.daily_cap, cam.advertiser_id, cam.priority, ca.conversion, "
-      "ca.per_day, ca.per_week, ca.per_month, ca.total_max, ca.value, "
-      "ca.split_test_group, s.segment, gt.geo_target, ca.target_url, "
-      "cbna.title, cbna.description, cbna.image_url, cbna.dimensions, "
-      "cbna.cta_text, cam.ptr, dp.dow, dp.start_minute, dp.end_minute FROM $1 "
-      "AS cbna INNER JOIN campaigns AS cam ON cam.campaign_id = "
-      "cbna.campaign_id INNER JOIN segments AS s ON s.creative_set_id = "
-      "cbna.creative_set_id INNER JOIN creative_ads AS ca ON "
-      "ca.creative_instance_id = cbna.creative_instance_id INNER JOIN "
-      "geo_targets AS gt ON gt.campaign_id = cbna.campaign_id INNER JOIN "
-      "dayparts AS dp ON dp.campaign_id = cbna.campaign_id WHERE $2 BETWEEN "
-      "cam.start_at_timestamp AND cam.end_at_timestamp",
-      {GetTableName(), TimeAsTimestampString(base::Time::Now())}, nullptr);
-
-  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
-  command->type = mojom::DBCommandInfo::Type::READ;
-  command->command = query;
-
-  command->record_bindings = {
-      mojom::DBCommandInfo::RecordBindingType::
-          STRING_TYPE,  // creative_instance_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
-      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // split_test_group
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // title
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // description
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // image_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dimensions
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // cta_text
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // dayparts->start_minute
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE  // dayparts->end_minute
-  };
-
-  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
-  transaction->commands.push_back(std::move(command));
-
-  AdsClientHelper::GetInstance()->RunDBTransaction(
-      std::move(transaction), base::BindOnce(&OnGetAll, std::move(callback)));
+  GetSnapshot(base::BindOnce(&OnGetAll, std::move(callback)));
 }
 
 std::string CreativeInlineContentAds::GetTableName() const {
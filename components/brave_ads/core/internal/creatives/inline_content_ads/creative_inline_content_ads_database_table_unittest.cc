@@ -8,11 +8,13 @@
 #include <utility>
 
 #include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
 #include "brave/components/brave_ads/core/internal/ads/ad_unittest_constants.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_container_util.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/inline_content_ads/creative_inline_content_ad_unittest_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/inline_content_ads/creative_inline_content_ads_snapshot.h"
 
 // npm run test -- brave_unit_tests --filter=BraveAds*
 
@@ -344,6 +346,42 @@ TEST_F(BraveAdsCreativeInlineContentAdsDatabaseTableTest,
           std::move(expected_creative_ads)));
 }
 
+TEST_F(BraveAdsCreativeInlineContentAdsDatabaseTableTest,
+       GetCreativeInlineContentAdsForDimensionsSavedAfterSnapshotWasBuilt) {
+  // Arrange
+  const CreativeInlineContentAdInfo creative_ad_1 =
+      BuildCreativeInlineContentAd(/*should_use_random_guids*/ true);
+  SaveCreativeAds({creative_ad_1});
+
+  database_table_.GetAll(base::DoNothing());
+  ASSERT_TRUE(CreativeInlineContentAdsSnapshot::GetInstance()->IsBuilt());
+
+  // Act
+  const CreativeInlineContentAdInfo creative_ad_2 =
+      BuildCreativeInlineContentAd(/*should_use_random_guids*/ true);
+
+  CreativeInlineContentAdInfo creative_ad_3 =
+      BuildCreativeInlineContentAd(/*should_use_random_guids*/ true);
+  creative_ad_3.dimensions = "150x150";
+
+  SaveCreativeAds({creative_ad_2, creative_ad_3});
+
+  // Assert
+  const CreativeInlineContentAdList expected_creative_ads = {creative_ad_1,
+                                                             creative_ad_2};
+
+  database_table_.GetForDimensions(
+      "200x100",
+      base::BindOnce(
+          [](const CreativeInlineContentAdList& expected_creative_ads,
+             const bool success,
+             const CreativeInlineContentAdList& creative_ads) {
+            EXPECT_TRUE(success);
+            EXPECT_TRUE(ContainersEq(expected_creative_ads, creative_ads));
+          },
+          expected_creative_ads));
+}
+
 TEST_F(BraveAdsCreativeInlineContentAdsDatabaseTableTest, TableName) {
   // Arrange
 
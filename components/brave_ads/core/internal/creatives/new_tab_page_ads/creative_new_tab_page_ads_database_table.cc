@@ -21,13 +21,13 @@
 #include "brave/components/brave_ads/core/internal/common/database/database_table_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
-#include "brave/components/brave_ads/core/internal/common/time/time_formatting_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/campaigns_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ads_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/dayparts_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/geo_targets_database_table.h"
 #include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ad_wallpapers_database_table.h"
+#include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ads_snapshot.h"
 #include "brave/components/brave_ads/core/internal/creatives/segments_database_table.h"
 #include "brave/components/brave_ads/core/internal/segments/segment_util.h"
 #include "url/gurl.h"
@@ -39,6 +39,10 @@ using CreativeNewTabPageAdMap =
 
 namespace {
 
+using GetSnapshotCallback =
+    base::OnceCallback<void(bool success,
+                            const CreativeNewTabPageAdsSnapshot& snapshot)>;
+
 constexpr char kTableName[] = "creative_new_tab_page_ads";
 
 constexpr int kDefaultBatchSize = 50;
@@ -161,6 +165,121 @@ CreativeNewTabPageAdList GetCreativeAdsFromResponse(
   return creative_ads;
 }
 
+CreativeNewTabPageAdList GetRowsFromResponse(
+    mojom::DBCommandResponseInfoPtr command_response) {
+  DCHECK(command_response);
+
+  CreativeNewTabPageAdList creative_ads;
+  for (const auto& record : command_response->result->get_records()) {
+    creative_ads.push_back(GetFromRecord(record.get()));
+  }
+
+  return creative_ads;
+}
+
+void OnGetSnapshot(const int generation,
+                   GetSnapshotCallback callback,
+                   mojom::DBCommandResponseInfoPtr command_response) {
+  if (!command_response ||
+      command_response->status !=
+          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+    const CreativeNewTabPageAdsSnapshot snapshot;
+    return std::move(callback).Run(/*success*/ false, snapshot);
+  }
+
+  const CreativeNewTabPageAdList creative_ads =
+      GetRowsFromResponse(std::move(command_response));
+
+  CreativeNewTabPageAdsSnapshot* const snapshot =
+      CreativeNewTabPageAdsSnapshot::GetInstance();
+  if (snapshot->GetGeneration() == generation) {
+    snapshot->Build(creative_ads);
+    return std::move(callback).Run(/*success*/ true, *snapshot);
+  }
+
+  // The creative ads were written while they were being read, so answer this
+  // request without keeping the outdated snapshot.
+  CreativeNewTabPageAdsSnapshot outdated_snapshot;
+  outdated_snapshot.Build(creative_ads);
+  std::move(callback).Run(/*success*/ true, outdated_snapshot);
+}
+
+void GetSnapshot(GetSnapshotCallback callback) {
+  const CreativeNewTabPageAdsSnapshot* const snapshot =
+      CreativeNewTabPageAdsSnapshot::GetInstance();
+  if (snapshot->IsBuilt()) {
+    return std::move(callback).Run(/*success*/ true, *snapshot);
+  }
+
+  // Scheduled and expired campaigns are included, the snapshot filters them
+  // when read.
+  const std::string query = base::ReplaceStringPlaceholders(
+      "SELECT cntpa.creative_instance_id, cntpa.creative_set_id, "
+      "cntpa.campaign_id, cam.start_at_timestamp, cam.end_at_timestamp, "
+      "cam.daily_cap, cam.advertiser_id, cam.priority, ca.conversion, "
+      "ca.per_day, ca.per_week, ca.per_month, ca.total_max, ca.value, "
+      "s.segment, gt.geo_target, ca.target_url, cntpa.company_name, "
+      "cntpa.image_url, cntpa.alt, cam.ptr, dp.dow, dp.start_minute, "
+      "dp.end_minute, wp.image_url, wp.focal_point_x, wp.focal_point_y FROM $1 "
+      "AS cntpa INNER JOIN campaigns AS cam ON cam.campaign_id = "
+      "cntpa.campaign_id INNER JOIN segments AS s ON s.creative_set_id = "
+      "cntpa.creative_set_id INNER JOIN creative_ads AS ca ON "
+      "ca.creative_instance_id = cntpa.creative_instance_id INNER JOIN "
+      "geo_targets AS gt ON gt.campaign_id = cntpa.campaign_id INNER JOIN "
+      "dayparts AS dp ON dp.campaign_id = cntpa.campaign_id INNER JOIN "
+      "creative_new_tab_page_ad_wallpapers AS wp ON wp.creative_instance_id = "
+      "cntpa.creative_instance_id",
+      {kTableName}, nullptr);
+
+  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+  command->type = mojom::DBCommandInfo::Type::READ;
+  command->command = query;
+
+  command->record_bindings = {
+      mojom::DBCommandInfo::RecordBindingType::
+          STRING_TYPE,  // creative_instance_id
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
+      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
+      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // company_name
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // image_url
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // alt
+      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
+      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
+      mojom::DBCommandInfo::RecordBindingType::
+          INT_TYPE,  // dayparts->start_minute
+      mojom::DBCommandInfo::RecordBindingType::
+          INT_TYPE,  // dayparts->end_minute
+      mojom::DBCommandInfo::RecordBindingType::
+          STRING_TYPE,  // creative_new_tab_page_ad_wallpapers->image_url
+      mojom::DBCommandInfo::RecordBindingType::
+          INT_TYPE,  // creative_new_tab_page_ad_wallpapers->focal_point->x
+      mojom::DBCommandInfo::RecordBindingType::
+          INT_TYPE  // creative_new_tab_page_ad_wallpapers->focal_point->y
+  };
+
+  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
+  transaction->commands.push_back(std::move(command));
+
+  AdsClientHelper::GetInstance()->RunDBTransaction(
+      std::move(transaction),
+      base::BindOnce(&OnGetSnapshot, snapshot->GetGeneration(),
+                     std::move(callback)));
+}
+
 void OnGetForCreativeInstanceId(
     const std::string& creative_instance_id,
     GetCreativeNewTabPageAdCallback callback,
@@ -189,33 +308,31 @@ void OnGetForCreativeInstanceId(
 
 void OnGetForSegments(const SegmentList& segments,
                       GetCreativeNewTabPageAdsCallback callback,
-                      mojom::DBCommandResponseInfoPtr command_response) {
-  if (!command_response ||
-      command_response->status !=
-          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+                      const bool success,
+                      const CreativeNewTabPageAdsSnapshot& snapshot) {
+  if (!success) {
     BLOG(0, "Failed to get creative new tab page ads");
     return std::move(callback).Run(/*success*/ false, segments,
                                    /*creative_ads*/ {});
   }
 
   const CreativeNewTabPageAdList creative_ads =
-      GetCreativeAdsFromResponse(std::move(command_response));
+      snapshot.GetForSegments(segments, base::Time::Now());
 
   std::move(callback).Run(/*success*/ true, segments, creative_ads);
 }
 
 void OnGetAll(GetCreativeNewTabPageAdsCallback callback,
-              mojom::DBCommandResponseInfoPtr command_response) {
-  if (!command_response ||
-      command_response->status !=
-          mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
+              const bool success,
+              const CreativeNewTabPageAdsSnapshot& snapshot) {
+  if (!success) {
     BLOG(0, "Failed to get all creative new tab page ads");
     return std::move(callback).Run(/*success*/ false, /*segments*/ {},
                                    /*creative_ads*/ {});
   }
 
   const CreativeNewTabPageAdList creative_ads =
-      GetCreativeAdsFromResponse(std::move(command_response));
+      snapshot.GetAll(base::Time::Now());
 
   const SegmentList segments = GetSegments(creative_ads);
 
@@ -264,6 +381,8 @@ void CreativeNewTabPageAds::Save(const CreativeNewTabPageAdList& creative_ads,
     return std::move(callback).Run(/*success*/ true);
   }
 
+  CreativeNewTabPageAdsSnapshot::GetInstance()->Invalidate();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   const std::vector<CreativeNewTabPageAdList> batches =
@@ -295,6 +414,8 @@ void CreativeNewTabPageAds::Save(const CreativeNewTabPageAdList& creative_ads,
 }
 
 void CreativeNewTabPageAds::Delete(ResultCallback callback) const {
+  CreativeNewTabPageAdsSnapshot::GetInstance()->Invalidate();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   DeleteTable(transaction.get(), GetTableName());
@@ -387,147 +508,12 @@ void CreativeNewTabPageAds::GetForSegments(
                                    /*creative_ads*/ {});
   }
 
-  const std::string query = base::ReplaceStringPlaceholders(
-      "SELECT cntpa.creative_instance_id, cntpa.creative_set_id, "
-      "cntpa.campaign_id, cam.start_at_timestamp, cam.end_at_timestamp, "
-      "cam.daily_cap, cam.advertiser_id, cam.priority, ca.conversion, "
-      "ca.per_day, ca.per_week, ca.per_month, ca.total_max, ca.value, "
-      "s.segment, gt.geo_target, ca.target_url, cntpa.company_name, "
-      "cntpa.image_url, cntpa.alt, cam.ptr, dp.dow, dp.start_minute, "
-      "dp.end_minute, wp.image_url, wp.focal_point_x, wp.focal_point_y FROM $1 "
-      "AS cntpa INNER JOIN campaigns AS cam ON cam.campaign_id = "
-      "cntpa.campaign_id INNER JOIN segments AS s ON s.creative_set_id = "
-      "cntpa.creative_set_id INNER JOIN creative_ads AS ca ON "
-      "ca.creative_instance_id = cntpa.creative_instance_id INNER JOIN "
-      "geo_targets AS gt ON gt.campaign_id = cntpa.campaign_id INNER JOIN "
-      "dayparts AS dp ON dp.campaign_id = cntpa.campaign_id INNER JOIN "
-      "creative_new_tab_page_ad_wallpapers AS wp ON wp.creative_instance_id = "
-      "cntpa.creative_instance_id WHERE s.segment IN $2 AND $3 BETWEEN "
-      "cam.start_at_timestamp AND cam.end_at_timestamp",
-      {GetTableName(), BuildBindingParameterPlaceholder(segments.size()),
-       TimeAsTimestampString(base::Time::Now())},
-      nullptr);
-
-  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
-  command->type = mojom::DBCommandInfo::Type::READ;
-  command->command = query;
-
-  int index = 0;
-  for (const auto& segment : segments) {
-    BindString(command.get(), index, base::ToLowerASCII(segment));
-    index++;
-  }
-
-  command->record_bindings = {
-      mojom::DBCommandInfo::RecordBindingType::
-          STRING_TYPE,  // creative_instance_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
-      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // company_name
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // image_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // alt
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // dayparts->start_minute
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // dayparts->end_minute
-      mojom::DBCommandInfo::RecordBindingType::
-          STRING_TYPE,  // creative_new_tab_page_ad_wallpapers->image_url
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // creative_new_tab_page_ad_wallpapers->focal_point->x
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE  // creative_new_tab_page_ad_wallpapers->focal_point->y
-  };
-
-  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
-  transaction->commands.push_back(std::move(command));
-
-  AdsClientHelper::GetInstance()->RunDBTransaction(
-      std::move(transaction),
-      base::BindOnce(&OnGetForSegments, segments, std::move(callback)));
+  GetSnapshot(base::BindOnce(&OnGetForSegments, segments, std::move(callback)));
 }
 
 void CreativeNewTabPageAds::GetAll(
     GetCreativeNewTabPageAdsCallback callback) const {
-  const std::string query = base::ReplaceStringPlaceholders(
-      "SELECT cntpa.creative_instance_id, cntpa.creative_set_id, "
-      "cntpa.campaign_id, cam.start_at_timestamp, cam.end_at_timestamp, "
-      "cam.daily_cap, cam.advertiser_id, cam.priority, ca.conversion, "
-      "ca.per_day, ca.per_week, ca.per_month, ca.total_max, ca.value, "
-      "s.segment, gt.geo_target, ca.target_url, cntpa.company_name, "
-      "cntpa.image_url, cntpa.alt, cam.ptr, dp.dow, dp.start_minute, "
-      "dp.end_minute, wp.image_url, wp.focal_point_x, wp.focal_point_y FROM $1 "
-      "AS cntpa INNER JOIN campaigns AS cam ON cam.campaign_id = "
-      "cntpa.campaign_id INNER JOIN segments AS s ON s.creative_set_id = "
-      "cntpa.creative_set_id INNER JOIN creative_ads AS ca ON "
-      "ca.creative_instance_id = cntpa.creative_instance_id INNER JOIN "
-      "geo_targets AS gt ON gt.campaign_id = cntpa.campaign_id INNER JOIN "
-      "dayparts AS dp ON dp.campaign_id = cntpa.campaign_id INNER JOIN "
-      "creative_new_tab_page_ad_wallpapers AS wp ON wp.creative_instance_id = "
-      "cntpa.creative_instance_id WHERE $2 BETWEEN cam.start_at_timestamp AND "
-      "cam.end_at_timestamp",
-      {GetTableName(), TimeAsTimestampString(base::Time::Now())}, nullptr);
-
-  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
-  command->type = mojom::DBCommandInfo::Type::READ;
-  command->command = query;
-
-  command->record_bindings = {
-      mojom::DBCommandInfo::RecordBindingType::
-          STRING_TYPE,  // creative_instance_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // creative_set_id
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // campaign_id
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // start_at
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // end_at
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // daily_cap
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // advertiser_id
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // priority
-      mojom::DBCommandInfo::RecordBindingType::BOOL_TYPE,    // conversion
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_day
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_week
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // per_month
-      mojom::DBCommandInfo::RecordBindingType::INT_TYPE,     // total_max
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // value
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // segment
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // geo_target
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // target_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // company_name
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // image_url
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // alt
-      mojom::DBCommandInfo::RecordBindingType::DOUBLE_TYPE,  // ptr
-      mojom::DBCommandInfo::RecordBindingType::STRING_TYPE,  // dayparts->dow
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // dayparts->start_minute
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // dayparts->end_minute
-      mojom::DBCommandInfo::RecordBindingType::
-          STRING_TYPE,  // creative_new_tab_page_ad_wallpapers->image_url
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE,  // creative_new_tab_page_ad_wallpapers->focal_point->x
-      mojom::DBCommandInfo::RecordBindingType::
-          INT_TYPE  // creative_new_tab_page_ad_wallpapers->focal_point->y
-  };
-
-  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
-  transaction->commands.push_back(std::move(command));
-
-  AdsClientHelper::GetInstance()->RunDBTransaction(
-      std::move(transaction), base::BindOnce(&OnGetAll, std::move(callback)));
+  GetSnapshot(base::BindOnce(&OnGetAll, std::move(callback)));
 }
 
 std::string CreativeNewTabPageAds::GetTableName() const {
@@ -8,11 +8,13 @@
 #include <utility>
 
 #include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
 #include "brave/components/brave_ads/core/internal/ads/ad_unittest_constants.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_container_util.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ad_unittest_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ads_snapshot.h"
 
 // npm run test -- brave_unit_tests --filter=BraveAds*
 
@@ -340,6 +342,30 @@ TEST_F(BraveAdsCreativeNewTabPageAdsDatabaseTableTest,
           std::move(expected_creative_ads)));
 }
 
+TEST_F(BraveAdsCreativeNewTabPageAdsDatabaseTableTest,
+       GetCreativeNewTabPageAdsSavedAfterSnapshotWasBuilt) {
+  // Arrange
+  const CreativeNewTabPageAdList creative_ads =
+      BuildCreativeNewTabPageAds(/*count*/ 2);
+
+  SaveCreativeAds({creative_ads.front()});
+  database_table_.GetAll(base::DoNothing());
+  ASSERT_TRUE(CreativeNewTabPageAdsSnapshot::GetInstance()->IsBuilt());
+
+  // Act
+  SaveCreativeAds({creative_ads.back()});
+
+  // Assert
+  database_table_.GetAll(base::BindOnce(
+      [](const CreativeNewTabPageAdList& expected_creative_ads,
+         const bool success, const SegmentList& /*segments*/,
+         const CreativeNewTabPageAdList& creative_ads) {
+        EXPECT_TRUE(success);
+        EXPECT_TRUE(ContainersEq(expected_creative_ads, creative_ads));
+      },
+      creative_ads));
+}
+
 TEST_F(BraveAdsCreativeNewTabPageAdsDatabaseTableTest, TableName) {
   // Arrange
 
@@ -0,0 +1,39 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ads_snapshot.h"
+
+#include "base/check.h"
+#include "base/containers/contains.h"
+#include "brave/components/brave_ads/core/internal/global_state/global_state.h"
+
+namespace brave_ads {
+
+void MergeCreativeAdRow(const CreativeNewTabPageAdInfo& row,
+                        CreativeNewTabPageAdInfo& creative_ad) {
+  MergeCreativeAdRow(static_cast<const CreativeAdInfo&>(row),
+                     static_cast<CreativeAdInfo&>(creative_ad));
+
+  for (const auto& wallpaper : row.wallpapers) {
+    if (!base::Contains(creative_ad.wallpapers, wallpaper)) {
+      creative_ad.wallpapers.push_back(wallpaper);
+    }
+  }
+}
+
+CreativeNewTabPageAdsSnapshot::CreativeNewTabPageAdsSnapshot() = default;
+
+CreativeNewTabPageAdsSnapshot::~CreativeNewTabPageAdsSnapshot() = default;
+
+// static
+CreativeNewTabPageAdsSnapshot*
+CreativeNewTabPageAdsSnapshot::GetInstance() {
+  auto* creative_new_tab_page_ads_snapshot =
+      GlobalState::GetInstance()->GetCreativeNewTabPageAdsSnapshot();
+  DCHECK(creative_new_tab_page_ads_snapshot);
+  return creative_new_tab_page_ads_snapshot;
+}
+
+}  // namespace brave_ads
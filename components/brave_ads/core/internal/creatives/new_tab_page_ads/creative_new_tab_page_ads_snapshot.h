@@ -0,0 +1,29 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_NEW_TAB_PAGE_ADS_CREATIVE_NEW_TAB_PAGE_ADS_SNAPSHOT_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_NEW_TAB_PAGE_ADS_CREATIVE_NEW_TAB_PAGE_ADS_SNAPSHOT_H_
+
+#include "brave/components/brave_ads/core/internal/creatives/creative_ads_snapshot.h"
+#include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ad_info.h"
+
+namespace brave_ads {
+
+// Also appends the wallpapers of |row| to |creative_ad|.
+void MergeCreativeAdRow(const CreativeNewTabPageAdInfo& row,
+                        CreativeNewTabPageAdInfo& creative_ad);
+
+class CreativeNewTabPageAdsSnapshot final
+    : public CreativeAdsSnapshot<CreativeNewTabPageAdInfo> {
+ public:
+  CreativeNewTabPageAdsSnapshot();
+  ~CreativeNewTabPageAdsSnapshot();
+
+  static CreativeNewTabPageAdsSnapshot* GetInstance();
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_NEW_TAB_PAGE_ADS_CREATIVE_NEW_TAB_PAGE_ADS_SNAPSHOT_H_
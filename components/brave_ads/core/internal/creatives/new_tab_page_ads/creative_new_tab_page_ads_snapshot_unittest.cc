@@ -0,0 +1,50 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ads_snapshot.h"
+
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ad_unittest_util.h"
+#include "url/gurl.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+class BraveAdsCreativeNewTabPageAdsSnapshotTest : public UnitTestBase {
+ protected:
+  CreativeNewTabPageAdsSnapshot snapshot_;
+};
+
+TEST_F(BraveAdsCreativeNewTabPageAdsSnapshotTest,
+       GetForSegmentsMergesGeoTargetsDaypartsAndWallpapers) {
+  // Arrange
+  CreativeNewTabPageAdInfo creative_ad =
+      BuildCreativeNewTabPageAd(/*should_use_random_guids*/ true);
+  creative_ad.geo_targets = {"US"};
+
+  CreativeNewTabPageAdInfo creative_ad_row = creative_ad;
+  creative_ad_row.geo_targets = {"GB"};
+  CreativeNewTabPageAdWallpaperInfo wallpaper;
+  wallpaper.image_url = GURL("https://brave.com/another_wallpaper_image");
+  creative_ad_row.wallpapers = {wallpaper};
+
+  snapshot_.Build({creative_ad, creative_ad_row});
+
+  // Act
+  const CreativeNewTabPageAdList creative_ads =
+      snapshot_.GetForSegments({creative_ad.segment}, Now());
+
+  // Assert
+  CreativeNewTabPageAdInfo expected_creative_ad = creative_ad;
+  expected_creative_ad.geo_targets = {"GB", "US"};
+  expected_creative_ad.wallpapers.push_back(wallpaper);
+  const CreativeNewTabPageAdList expected_creative_ads = {
+      expected_creative_ad};
+  EXPECT_EQ(expected_creative_ads, creative_ads);
+}
+
+}  // namespace brave_ads
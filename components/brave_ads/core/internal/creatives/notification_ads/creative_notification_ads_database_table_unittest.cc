@@ -8,10 +8,12 @@
 #include <utility>
 
 #include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_container_util.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ad_unittest_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_snapshot.h"
 
 // npm run test -- brave_unit_tests --filter=BraveAds*
 
@@ -281,6 +283,30 @@ TEST_F(BraveAdsCreativeNotificationAdsDatabaseTableTest,
           std::move(expected_creative_ads)));
 }
 
+TEST_F(BraveAdsCreativeNotificationAdsDatabaseTableTest,
+       GetCreativeNotificationAdsSavedAfterSnapshotWasBuilt) {
+  // Arrange
+  const CreativeNotificationAdList creative_ads =
+      BuildCreativeNotificationAds(/*count*/ 2);
+
+  SaveCreativeAds({creative_ads.front()});
+  database_table_.GetAll(base::DoNothing());
+  ASSERT_TRUE(CreativeNotificationAdsSnapshot::GetInstance()->IsBuilt());
+
+  // Act
+  SaveCreativeAds({creative_ads.back()});
+
+  // Assert
+  database_table_.GetAll(base::BindOnce(
+      [](const CreativeNotificationAdList& expected_creative_ads,
+         const bool success, const SegmentList& /*segments*/,
+         const CreativeNotificationAdList& creative_ads) {
+        EXPECT_TRUE(success);
+        EXPECT_TRUE(ContainersEq(expected_creative_ads, creative_ads));
+      },
+      creative_ads));
+}
+
 TEST_F(BraveAdsCreativeNotificationAdsDatabaseTableTest, TableName) {
   // Arrange
 
@@ -0,0 +1,26 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_snapshot.h"
+
+#include "base/check.h"
+#include "brave/components/brave_ads/core/internal/global_state/global_state.h"
+
+namespace brave_ads {
+
+CreativeNotificationAdsSnapshot::CreativeNotificationAdsSnapshot() = default;
+
+CreativeNotificationAdsSnapshot::~CreativeNotificationAdsSnapshot() = default;
+
+// static
+CreativeNotificationAdsSnapshot*
+CreativeNotificationAdsSnapshot::GetInstance() {
+  auto* creative_notification_ads_snapshot =
+      GlobalState::GetInstance()->GetCreativeNotificationAdsSnapshot();
+  DCHECK(creative_notification_ads_snapshot);
+  return creative_notification_ads_snapshot;
+}
+
+}  // namespace brave_ads
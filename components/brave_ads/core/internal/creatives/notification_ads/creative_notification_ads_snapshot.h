@@ -0,0 +1,25 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_NOTIFICATION_ADS_CREATIVE_NOTIFICATION_ADS_SNAPSHOT_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_NOTIFICATION_ADS_CREATIVE_NOTIFICATION_ADS_SNAPSHOT_H_
+
+#include "brave/components/brave_ads/core/internal/creatives/creative_ads_snapshot.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ad_info.h"
+
+namespace brave_ads {
+
+class CreativeNotificationAdsSnapshot final
+    : public CreativeAdsSnapshot<CreativeNotificationAdInfo> {
+ public:
+  CreativeNotificationAdsSnapshot();
+  ~CreativeNotificationAdsSnapshot();
+
+  static CreativeNotificationAdsSnapshot* GetInstance();
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_NOTIFICATION_ADS_CREATIVE_NOTIFICATION_ADS_SNAPSHOT_H_
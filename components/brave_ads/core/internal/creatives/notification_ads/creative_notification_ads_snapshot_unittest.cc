@@ -0,0 +1,133 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_snapshot.h"
+
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ad_unittest_util.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+class BraveAdsCreativeNotificationAdsSnapshotTest : public UnitTestBase {
+ protected:
+  CreativeNotificationAdsSnapshot snapshot_;
+};
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, IsNotBuilt) {
+  // Arrange
+
+  // Act
+
+  // Assert
+  EXPECT_FALSE(snapshot_.IsBuilt());
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, Build) {
+  // Arrange
+
+  // Act
+  snapshot_.Build(/*creative_ads*/ {});
+
+  // Assert
+  EXPECT_TRUE(snapshot_.IsBuilt());
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, Invalidate) {
+  // Arrange
+  snapshot_.Build(BuildCreativeNotificationAds(/*count*/ 1));
+  const int generation = snapshot_.GetGeneration();
+
+  // Act
+  snapshot_.Invalidate();
+
+  // Assert
+  EXPECT_FALSE(snapshot_.IsBuilt());
+  EXPECT_NE(generation, snapshot_.GetGeneration());
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest, GetForSegments) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad_1 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_1.segment = "technology & computing-software";
+
+  CreativeNotificationAdInfo creative_ad_2 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_2.segment = "food & drink";
+
+  snapshot_.Build({creative_ad_1, creative_ad_2});
+
+  // Act
+  const CreativeNotificationAdList creative_ads =
+      snapshot_.GetForSegments(/*segments*/ {"FoOd & DrInK"}, Now());
+
+  // Assert
+  const CreativeNotificationAdList expected_creative_ads = {creative_ad_2};
+  EXPECT_EQ(expected_creative_ads, creative_ads);
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest,
+       GetForSegmentsMergesGeoTargetsAndDayparts) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad.geo_targets = {"US"};
+  creative_ad.dayparts = {CreativeDaypartInfo{}};
+
+  CreativeNotificationAdInfo creative_ad_row = creative_ad;
+  creative_ad_row.geo_targets = {"GB"};
+  CreativeDaypartInfo daypart;
+  daypart.dow = "1";
+  daypart.start_minute = 60;
+  daypart.end_minute = 120;
+  creative_ad_row.dayparts = {daypart};
+
+  snapshot_.Build({creative_ad, creative_ad_row});
+
+  // Act
+  const CreativeNotificationAdList creative_ads =
+      snapshot_.GetForSegments({creative_ad.segment}, Now());
+
+  // Assert
+  CreativeNotificationAdInfo expected_creative_ad = creative_ad;
+  expected_creative_ad.geo_targets = {"GB", "US"};
+  expected_creative_ad.dayparts = {CreativeDaypartInfo{}, daypart};
+  const CreativeNotificationAdList expected_creative_ads = {
+      expected_creative_ad};
+  EXPECT_EQ(expected_creative_ads, creative_ads);
+}
+
+TEST_F(BraveAdsCreativeNotificationAdsSnapshotTest,
+       DoNotGetScheduledOrExpiredCreativeAds) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad_1 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_1.start_at = DistantPast();
+  creative_ad_1.end_at = Now() - base::Hours(1);
+
+  CreativeNotificationAdInfo creative_ad_2 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_2.start_at = DistantPast();
+  creative_ad_2.end_at = DistantFuture();
+
+  CreativeNotificationAdInfo creative_ad_3 =
+      BuildCreativeNotificationAd(/*should_use_random_guids*/ true);
+  creative_ad_3.start_at = Now() + base::Hours(1);
+  creative_ad_3.end_at = DistantFuture();
+
+  snapshot_.Build({creative_ad_1, creative_ad_2, creative_ad_3});
+
+  // Act
+  const CreativeNotificationAdList creative_ads = snapshot_.GetAll(Now());
+
+  // Assert
+  const CreativeNotificationAdList expected_creative_ads = {creative_ad_2};
+  EXPECT_EQ(expected_creative_ads, creative_ads);
+}
+
+}  // namespace brave_ads
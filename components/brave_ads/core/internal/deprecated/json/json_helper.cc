@@ -8,11 +8,6 @@
 #include "base/strings/string_number_conversions.h"
 #include "brave/third_party/rapidjson/src/include/rapidjson/error/en.h"
 
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wexit-time-destructors"
-#include "brave/third_party/rapidjson/src/include/rapidjson/schema.h"
-#pragma clang diagnostic pop
-
 namespace brave_ads::helper::json {
 
 bool Validate(rapidjson::Document* document, const std::string& json_schema) {
@@ -32,6 +27,19 @@ bool Validate(rapidjson::Document* document, const std::string& json_schema) {
   }
 
   const rapidjson::SchemaDocument schema(document_schema);
+  return Validate(document, schema);
+}
+
+bool Validate(rapidjson::Document* document,
+              const rapidjson::SchemaDocument& schema) {
+  if (!document) {
+    return false;
+  }
+
+  if (document->HasParseError()) {
+    return false;
+  }
+
   rapidjson::SchemaValidator validator(schema);
   return document->Accept(validator);
 }
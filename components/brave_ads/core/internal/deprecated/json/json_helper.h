@@ -16,9 +16,16 @@
 
 #include "brave/third_party/rapidjson/src/include/rapidjson/document.h"
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wexit-time-destructors"
+#include "brave/third_party/rapidjson/src/include/rapidjson/schema.h"
+#pragma clang diagnostic pop
+
 namespace brave_ads::helper::json {
 
 bool Validate(rapidjson::Document* document, const std::string& json_schema);
+bool Validate(rapidjson::Document* document,
+              const rapidjson::SchemaDocument& schema);
 
 std::string GetLastError(rapidjson::Document* document);
 
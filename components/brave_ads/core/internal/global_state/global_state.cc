@@ -8,6 +8,9 @@
 #include "base/check.h"
 #include "brave/components/brave_ads/core/ads_client.h"
 #include "brave/components/brave_ads/core/internal/browser/browser_manager.h"
+#include "brave/components/brave_ads/core/internal/creatives/inline_content_ads/creative_inline_content_ads_snapshot.h"
+#include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ads_snapshot.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_snapshot.h"
 #include "brave/components/brave_ads/core/internal/creatives/notification_ads/notification_ad_manager.h"
 #include "brave/components/brave_ads/core/internal/database/database_manager.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
@@ -30,6 +33,12 @@ GlobalState::GlobalState(AdsClient* ads_client)
   browser_manager_ = std::make_unique<BrowserManager>();
   client_state_manager_ = std::make_unique<ClientStateManager>();
   confirmation_state_manager_ = std::make_unique<ConfirmationStateManager>();
+  creative_inline_content_ads_snapshot_ =
+      std::make_unique<CreativeInlineContentAdsSnapshot>();
+  creative_new_tab_page_ads_snapshot_ =
+      std::make_unique<CreativeNewTabPageAdsSnapshot>();
+  creative_notification_ads_snapshot_ =
+      std::make_unique<CreativeNotificationAdsSnapshot>();
   predictors_manager_ = std::make_unique<PredictorsManager>();
   database_manager_ = std::make_unique<DatabaseManager>();
   diagnostic_manager_ = std::make_unique<DiagnosticManager>();
@@ -70,6 +79,21 @@ ConfirmationStateManager* GlobalState::GetConfirmationStateManager() {
   return confirmation_state_manager_.get();
 }
 
+CreativeInlineContentAdsSnapshot*
+GlobalState::GetCreativeInlineContentAdsSnapshot() {
+  return creative_inline_content_ads_snapshot_.get();
+}
+
+CreativeNewTabPageAdsSnapshot*
+GlobalState::GetCreativeNewTabPageAdsSnapshot() {
+  return creative_new_tab_page_ads_snapshot_.get();
+}
+
+CreativeNotificationAdsSnapshot*
+GlobalState::GetCreativeNotificationAdsSnapshot() {
+  return creative_notification_ads_snapshot_.get();
+}
+
 DatabaseManager* GlobalState::GetDatabaseManager() {
   return database_manager_.get();
 }
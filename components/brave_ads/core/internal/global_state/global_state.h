@@ -18,6 +18,9 @@ class GlobalStateHolder;
 class BrowserManager;
 class ClientStateManager;
 class ConfirmationStateManager;
+class CreativeInlineContentAdsSnapshot;
+class CreativeNewTabPageAdsSnapshot;
+class CreativeNotificationAdsSnapshot;
 class DatabaseManager;
 class DiagnosticManager;
 class HistoryManager;
@@ -51,6 +54,12 @@ class GlobalState final {
 
   ConfirmationStateManager* GetConfirmationStateManager();
 
+  CreativeInlineContentAdsSnapshot* GetCreativeInlineContentAdsSnapshot();
+
+  CreativeNewTabPageAdsSnapshot* GetCreativeNewTabPageAdsSnapshot();
+
+  CreativeNotificationAdsSnapshot* GetCreativeNotificationAdsSnapshot();
+
   DatabaseManager* GetDatabaseManager();
 
   DiagnosticManager* GetDiagnosticManager();
@@ -79,6 +88,12 @@ class GlobalState final {
   std::unique_ptr<BrowserManager> browser_manager_;
   std::unique_ptr<ClientStateManager> client_state_manager_;
   std::unique_ptr<ConfirmationStateManager> confirmation_state_manager_;
+  std::unique_ptr<CreativeInlineContentAdsSnapshot>
+      creative_inline_content_ads_snapshot_;
+  std::unique_ptr<CreativeNewTabPageAdsSnapshot>
+      creative_new_tab_page_ads_snapshot_;
+  std::unique_ptr<CreativeNotificationAdsSnapshot>
+      creative_notification_ads_snapshot_;
   std::unique_ptr<DatabaseManager> database_manager_;
   std::unique_ptr<DiagnosticManager> diagnostic_manager_;
   std::unique_ptr<HistoryManager> history_manager_;
@@ -57,6 +57,11 @@ TEST_F(BraveAdsGlobalStateTest, CheckManagersNotNull) {
   EXPECT_TRUE(GlobalState::GetInstance()->GetBrowserManager());
   EXPECT_TRUE(GlobalState::GetInstance()->GetClientStateManager());
   EXPECT_TRUE(GlobalState::GetInstance()->GetConfirmationStateManager());
+  EXPECT_TRUE(
+      GlobalState::GetInstance()->GetCreativeInlineContentAdsSnapshot());
+  EXPECT_TRUE(GlobalState::GetInstance()->GetCreativeNewTabPageAdsSnapshot());
+  EXPECT_TRUE(
+      GlobalState::GetInstance()->GetCreativeNotificationAdsSnapshot());
   EXPECT_TRUE(GlobalState::GetInstance()->GetDatabaseManager());
   EXPECT_TRUE(GlobalState::GetInstance()->GetDiagnosticManager());
   EXPECT_TRUE(GlobalState::GetInstance()->GetHistoryManager());
@@ -11,6 +11,7 @@
 #include "base/metrics/histogram_macros.h"
 #include "base/time/clock.h"
 #include "base/time/default_clock.h"
+#include "base/time/time.h"
 #include "brave/components/brave_perf_predictor/common/pref_names.h"
 #include "brave/components/time_period_storage/weekly_storage.h"
 #include "components/prefs/pref_registry_simple.h"
@@ -36,6 +37,8 @@ constexpr std::array<uint64_t, 7> kBandwidthSavingsBuckets{
 constexpr char kSavingsDailyUMAHistogramName[] =
     "Brave.Savings.BandwidthSavingsMB";
 
+constexpr base::TimeDelta kSaveDelay = base::Minutes(1);
+
 }  // namespace
 
 P3ABandwidthSavingsTracker::P3ABandwidthSavingsTracker(PrefService* user_prefs)
@@ -45,20 +48,28 @@ P3ABandwidthSavingsTracker::P3ABandwidthSavingsTracker(PrefService* user_prefs)
 P3ABandwidthSavingsTracker::P3ABandwidthSavingsTracker(
     PrefService* user_prefs,
     std::unique_ptr<base::Clock> clock)
-    : user_prefs_(user_prefs), clock_(std::move(clock)) {}
+    : user_prefs_(user_prefs) {
+  if (user_prefs_) {
+    weekly_storage_ = std::make_unique<WeeklyStorage>(
+        user_prefs_, prefs::kBandwidthSavedDailyBytes, std::move(clock));
+    weekly_storage_->SetSaveDelay(kSaveDelay);
+  }
+}
 
 void P3ABandwidthSavingsTracker::RecordSavings(uint64_t savings) {
-  if (savings > 0 && user_prefs_) {
-    // TODO(AndriusA): optimise if needed, loading permanent state on every
-    // record could be costly
-    WeeklyStorage weekly(user_prefs_, prefs::kBandwidthSavedDailyBytes);
-    weekly.AddDelta(savings);
-    StoreSavingsHistogram(weekly.GetWeeklySum());
+  if (savings > 0 && weekly_storage_) {
+    weekly_storage_->AddDelta(savings);
+    StoreSavingsHistogram(weekly_storage_->GetWeeklySum());
   }
 }
 
 P3ABandwidthSavingsTracker::~P3ABandwidthSavingsTracker() = default;
 
+void P3ABandwidthSavingsTracker::Shutdown() {
+  // Prefs are still alive at this point.
+  weekly_storage_.reset();
+}
+
 // static
 void P3ABandwidthSavingsTracker::RegisterProfilePrefs(
     PrefRegistrySimple* registry) {
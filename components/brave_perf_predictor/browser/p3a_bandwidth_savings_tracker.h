@@ -10,9 +10,11 @@
 #include <memory>
 
 #include "base/memory/raw_ptr.h"
+#include "components/keyed_service/core/keyed_service.h"
 
 class PrefRegistrySimple;
 class PrefService;
+class WeeklyStorage;
 
 namespace base {
 class Clock;
@@ -20,13 +22,15 @@ class Clock;
 
 namespace brave_perf_predictor {
 
-class P3ABandwidthSavingsTracker {
+// Profile wide, savings of all tabs are accumulated in one weekly storage
+// which is written to prefs at most once per kSaveDelay.
+class P3ABandwidthSavingsTracker : public KeyedService {
  public:
   explicit P3ABandwidthSavingsTracker(PrefService* user_prefs);
   // Constructor with injected clock for testing
   P3ABandwidthSavingsTracker(PrefService* user_prefs,
                              std::unique_ptr<base::Clock> clock);
-  ~P3ABandwidthSavingsTracker();
+  ~P3ABandwidthSavingsTracker() override;
   P3ABandwidthSavingsTracker(const P3ABandwidthSavingsTracker&) = delete;
   P3ABandwidthSavingsTracker& operator=(const P3ABandwidthSavingsTracker&) =
       delete;
@@ -34,10 +38,14 @@ class P3ABandwidthSavingsTracker {
   static void RegisterProfilePrefs(PrefRegistrySimple* registry);
   void RecordSavings(uint64_t savings);
 
+  // KeyedService:
+  void Shutdown() override;
+
  private:
-  raw_ptr<PrefService> user_prefs_ = nullptr;
-  std::unique_ptr<base::Clock> clock_;  // Injected clock for testing
   void StoreSavingsHistogram(uint64_t savings_bytes);
+
+  raw_ptr<PrefService> user_prefs_ = nullptr;
+  std::unique_ptr<WeeklyStorage> weekly_storage_;
 };
 
 }  // namespace brave_perf_predictor
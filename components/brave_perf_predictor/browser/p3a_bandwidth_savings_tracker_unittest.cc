@@ -11,7 +11,9 @@
 #include "base/memory/raw_ptr.h"
 #include "base/test/metrics/histogram_tester.h"
 #include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
 #include "base/time/time.h"
+#include "brave/components/brave_perf_predictor/common/pref_names.h"
 #include "components/prefs/testing_pref_service.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -30,6 +32,8 @@ class P3ABandwidthSavingsTrackerTest : public ::testing::Test {
   }
 
  protected:
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   raw_ptr<base::SimpleTestClock> clock_ = nullptr;
   TestingPrefServiceSimple pref_service_;
   std::unique_ptr<P3ABandwidthSavingsTracker> tracker_;
@@ -57,4 +61,14 @@ TEST_F(P3ABandwidthSavingsTrackerTest, RecordSavingsHistogramLargeIncrements) {
   tester.ExpectBucketCount(kSavingsDailyUMAHistogramName, 6, 1);
 }
 
+TEST_F(P3ABandwidthSavingsTrackerTest, WritesPrefsOnShutdown) {
+  tracker_->RecordSavings(10 << 20);
+  tracker_->RecordSavings(20 << 20);
+  EXPECT_TRUE(pref_service_.GetList(prefs::kBandwidthSavedDailyBytes).empty());
+
+  tracker_->Shutdown();
+  EXPECT_EQ(pref_service_.GetList(prefs::kBandwidthSavedDailyBytes).size(),
+            1U);
+}
+
 }  // namespace brave_perf_predictor
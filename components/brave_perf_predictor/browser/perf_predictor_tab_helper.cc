@@ -6,6 +6,7 @@
 #include "brave/components/brave_perf_predictor/browser/perf_predictor_tab_helper.h"
 
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry_factory.h"
+#include "brave/components/brave_perf_predictor/browser/p3a_bandwidth_savings_tracker_factory.h"
 #include "brave/components/brave_perf_predictor/common/pref_names.h"
 #include "build/build_config.h"
 #include "components/prefs/pref_registry_simple.h"
@@ -33,8 +34,8 @@ PerfPredictorTabHelper::PerfPredictorTabHelper(
   if (web_contents->GetBrowserContext()->IsOffTheRecord())
     return;
 
-  bandwidth_tracker_ = std::make_unique<P3ABandwidthSavingsTracker>(
-      user_prefs::UserPrefs::Get(web_contents->GetBrowserContext()));
+  bandwidth_tracker_ = P3ABandwidthSavingsTrackerFactory::GetForBrowserContext(
+      web_contents->GetBrowserContext());
 }
 
 PerfPredictorTabHelper::~PerfPredictorTabHelper() = default;
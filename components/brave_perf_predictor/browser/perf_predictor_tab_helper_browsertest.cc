@@ -6,6 +6,7 @@
 #include "base/path_service.h"
 #include "base/test/thread_test_helper.h"
 #include "brave/browser/brave_browser_process.h"
+#include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_service.h"
 #include "brave/components/brave_perf_predictor/common/pref_names.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
@@ -49,6 +50,9 @@ class PerfPredictorTabHelperTest : public InProcessBrowserTest {
   void SetUpOnMainThread() override {
     InProcessBrowserTest::SetUpOnMainThread();
     host_resolver()->AddRule("*", "127.0.0.1");
+    // Report blocked counts right away so that tests can check the prefs.
+    brave_shields::BraveShieldsWebContentsObserver::
+        SetBlockedEventsFlushDelayForTesting(base::TimeDelta());
 
     auto* content_settings =
         HostContentSettingsMapFactory::GetForProfile(browser()->profile());
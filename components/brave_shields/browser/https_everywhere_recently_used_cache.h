@@ -6,40 +6,89 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
 #include <string>
+#include <vector>
 
+#include "base/check_op.h"
 #include "base/containers/lru_cache.h"
+#include "base/hash/hash.h"
 #include "base/synchronization/lock.h"
 
+// An LRU cache that can be used from several threads. Keys are spread over
+// |shard_count| independently locked shards so that lookups for different
+// keys rarely wait for each other. Each shard keeps its own LRU order and
+// holds up to |size| / |shard_count| entries.
 template <class T> class HTTPSERecentlyUsedCache {
  public:
-  explicit HTTPSERecentlyUsedCache(size_t size = 100) : data_(size) {}
+  explicit HTTPSERecentlyUsedCache(size_t size = 100, size_t shard_count = 1) {
+    DCHECK_GT(shard_count, 0u);
+    const size_t shard_size = std::max<size_t>(size / shard_count, 1);
+    shards_.reserve(shard_count);
+    for (size_t i = 0; i < shard_count; ++i)
+      shards_.push_back(std::make_unique<Shard>(shard_size));
+  }
 
   void add(const std::string& key, const T& value) {
-    base::AutoLock create(lock_);
-    data_.Put(key, value);
+    Shard& shard = GetShard(key);
+    base::AutoLock create(shard.lock);
+    shard.data.Put(key, value);
   }
 
   bool get(const std::string& key, T* value) {
-    base::AutoLock create(lock_);
-    auto it = data_.Get(key);
-    if (it != data_.end()) {
+    Shard& shard = GetShard(key);
+    base::AutoLock create(shard.lock);
+    auto it = shard.data.Get(key);
+    if (it != shard.data.end()) {
       *value = it->second;
+      hit_count_.fetch_add(1, std::memory_order_relaxed);
       return true;
     }
+    miss_count_.fetch_add(1, std::memory_order_relaxed);
     return false;
   }
 
   void remove(const std::string& key) {
-    base::AutoLock lock(lock_);
-    auto it = data_.Peek(key);
-    if (it != data_.end())
-      data_.Erase(it);
+    Shard& shard = GetShard(key);
+    base::AutoLock lock(shard.lock);
+    auto it = shard.data.Peek(key);
+    if (it != shard.data.end())
+      shard.data.Erase(it);
+  }
+
+  void clear() {
+    for (auto& shard : shards_) {
+      base::AutoLock lock(shard->lock);
+      shard->data.Clear();
+    }
+  }
+
+  size_t hit_count() const {
+    return hit_count_.load(std::memory_order_relaxed);
+  }
+  size_t miss_count() const {
+    return miss_count_.load(std::memory_order_relaxed);
   }
 
  private:
-  base::LRUCache<std::string, T> data_;
-  base::Lock lock_;
+  struct Shard {
+    explicit Shard(size_t size) : data(size) {}
+
+    base::LRUCache<std::string, T> data;
+    base::Lock lock;
+  };
+
+  Shard& GetShard(const std::string& key) {
+    if (shards_.size() == 1)
+      return *shards_[0];
+    return *shards_[base::FastHash(key) % shards_.size()];
+  }
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<size_t> hit_count_{0};
+  std::atomic<size_t> miss_count_{0};
 };
 
 #endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
@@ -28,3 +28,51 @@ TEST(HTTPSEverywhereRecentlyUsedCacheTest, Operations) {
   cache.remove("kD");
   ASSERT_FALSE(cache.get("kD", &v));
 }
+
+TEST(HTTPSEverywhereRecentlyUsedCacheTest, Sharded) {
+  using Cache = HTTPSERecentlyUsedCache<std::string>;
+  Cache cache(64, 4);
+
+  for (int i = 0; i < 16; ++i)
+    cache.add("k" + std::to_string(i), "v" + std::to_string(i));
+  std::string v;
+  for (int i = 0; i < 16; ++i) {
+    ASSERT_TRUE(cache.get("k" + std::to_string(i), &v));
+    EXPECT_EQ(v, "v" + std::to_string(i));
+  }
+  ASSERT_FALSE(cache.get("kX", &v));
+  EXPECT_EQ(cache.hit_count(), 16u);
+  EXPECT_EQ(cache.miss_count(), 1u);
+
+  // Negative entries are plain values.
+  cache.add("kEmpty", "");
+  ASSERT_TRUE(cache.get("kEmpty", &v));
+  EXPECT_TRUE(v.empty());
+
+  cache.remove("k1");
+  ASSERT_FALSE(cache.get("k1", &v));
+  ASSERT_TRUE(cache.get("k2", &v));
+
+  cache.clear();
+  for (int i = 0; i < 16; ++i)
+    ASSERT_FALSE(cache.get("k" + std::to_string(i), &v));
+}
+
+TEST(HTTPSEverywhereRecentlyUsedCacheTest, ShardedCapacity) {
+  using Cache = HTTPSERecentlyUsedCache<int>;
+  Cache cache(8, 4);
+
+  for (int i = 0; i < 100; ++i)
+    cache.add("k" + std::to_string(i), i);
+  int hits = 0;
+  int v;
+  for (int i = 0; i < 100; ++i) {
+    if (cache.get("k" + std::to_string(i), &v))
+      ++hits;
+  }
+  // Each shard keeps at most two entries.
+  EXPECT_LE(hits, 8);
+  // The most recently added entry is never evicted.
+  ASSERT_TRUE(cache.get("k99", &v));
+  EXPECT_EQ(v, 99);
+}
@@ -31,6 +31,13 @@
 
 namespace {
 
+// The caches are consulted for every http subresource, so they are sized for
+// pages with many subresource hosts and sharded to keep network threads from
+// waiting on each other.
+constexpr size_t kRecentlyUsedCacheSize = 1024;
+constexpr size_t kHostsWithoutRulesCacheSize = 1024;
+constexpr size_t kCacheShardCount = 16;
+
 std::vector<std::string> Split(const std::string& s, char delim) {
   std::stringstream ss(s);
   std::string item;
@@ -122,6 +129,8 @@ void HTTPSEverywhereService::Engine::Init(const base::FilePath& base_dir) {
     return;
   }
   level_db_ = base::WrapUnique(db);
+  // Cached decisions were made with the previous rules.
+  service_->ClearCaches();
 }
 
 bool HTTPSEverywhereService::Engine::GetHTTPSURL(
@@ -142,6 +151,8 @@ bool HTTPSEverywhereService::Engine::GetHTTPSURL(
   }
 
   if (service_->recently_used_cache().get(url->spec(), new_url)) {
+    if (new_url->empty())
+      return false;
     service_->AddHTTPSEUrlToRedirectList(request_identifier);
     return true;
   }
@@ -153,12 +164,19 @@ bool HTTPSEverywhereService::Engine::GetHTTPSURL(
     candidate_url = candidate_url.ReplaceComponents(replacements);
   }
 
+  bool has_rules = false;
+  if (service_->hosts_without_rules_cache().get(candidate_url.host(),
+                                                &has_rules)) {
+    return false;
+  }
+
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.HTTPSE.GetHTTPSURL");
   const std::vector<std::string> domains =
       ExpandDomainForLookup(candidate_url.host());
   for (auto domain : domains) {
     std::string value = leveldbGet(level_db_.get(), domain);
     if (!value.empty()) {
+      has_rules = true;
       *new_url = ApplyHTTPSRule(candidate_url.spec(), value);
       if (0 != new_url->length()) {
         service_->recently_used_cache().add(candidate_url.spec(), *new_url);
@@ -167,7 +185,11 @@ bool HTTPSEverywhereService::Engine::GetHTTPSURL(
       }
     }
   }
-  service_->recently_used_cache().remove(candidate_url.spec());
+  if (has_rules) {
+    service_->recently_used_cache().add(candidate_url.spec(), std::string());
+  } else {
+    service_->hosts_without_rules_cache().add(candidate_url.host(), false);
+  }
   return false;
 }
 
@@ -277,6 +299,9 @@ bool HTTPSEverywhereService::g_ignore_port_for_test_(false);
 HTTPSEverywhereService::HTTPSEverywhereService(
     scoped_refptr<base::SequencedTaskRunner> task_runner)
     : BaseBraveShieldsService(task_runner),
+      recently_used_cache_(kRecentlyUsedCacheSize, kCacheShardCount),
+      hosts_without_rules_cache_(kHostsWithoutRulesCacheSize,
+                                 kCacheShardCount),
       engine_(new Engine(*this), base::OnTaskRunnerDeleter(task_runner)) {}
 
 HTTPSEverywhereService::~HTTPSEverywhereService() {
@@ -309,11 +334,22 @@ bool HTTPSEverywhereService::GetHTTPSURLFromCacheOnly(
     return false;
   }
 
-  if (recently_used_cache_.get(url->spec(), cached_url)) {
-    AddHTTPSEUrlToRedirectList(request_identifier);
-    return true;
+  bool hit = recently_used_cache_.get(url->spec(), cached_url);
+  if (!hit) {
+    bool has_rules = false;
+    hit = hosts_without_rules_cache_.get(url->host(), &has_rules);
+    if (hit)
+      cached_url->clear();
   }
-  return false;
+  UMA_HISTOGRAM_BOOLEAN("Brave.HTTPSE.CacheHit", hit);
+  if (!hit)
+    return false;
+
+  // Known not to be upgraded, there is no need to ask the engine.
+  if (cached_url->empty())
+    return true;
+  AddHTTPSEUrlToRedirectList(request_identifier);
+  return true;
 }
 
 HTTPSERecentlyUsedCache<std::string>&
@@ -321,6 +357,16 @@ HTTPSEverywhereService::recently_used_cache() {
   return recently_used_cache_;
 }
 
+HTTPSERecentlyUsedCache<bool>&
+HTTPSEverywhereService::hosts_without_rules_cache() {
+  return hosts_without_rules_cache_;
+}
+
+void HTTPSEverywhereService::ClearCaches() {
+  recently_used_cache_.clear();
+  hosts_without_rules_cache_.clear();
+}
+
 bool HTTPSEverywhereService::ShouldHTTPSERedirect(
     const uint64_t& request_identifier) {
   base::AutoLock auto_lock(httpse_get_urls_redirects_count_mutex_);
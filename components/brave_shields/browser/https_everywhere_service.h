@@ -77,6 +77,8 @@ class HTTPSEverywhereService : public BaseBraveShieldsService {
 
   void InitDB(const base::FilePath& install_dir);
 
+  // Returns true if the caches know whether |url| is upgraded, in which case
+  // |cached_url| is left empty if it isn't.
   bool GetHTTPSURLFromCacheOnly(const GURL* url,
                                 const uint64_t& request_id,
                                 std::string* cached_url);
@@ -95,10 +97,16 @@ class HTTPSEverywhereService : public BaseBraveShieldsService {
   void AddHTTPSEUrlToRedirectList(const uint64_t& request_id);
   bool ShouldHTTPSERedirect(const uint64_t& request_id);
   HTTPSERecentlyUsedCache<std::string>& recently_used_cache();
+  HTTPSERecentlyUsedCache<bool>& hosts_without_rules_cache();
+  void ClearCaches();
 
   base::Lock httpse_get_urls_redirects_count_mutex_;
   std::vector<HTTPSE_REDIRECTS_COUNT_ST> httpse_urls_redirects_count_;
+  // Upgraded URLs by original URL. An empty value means that the URL is known
+  // not to be upgraded.
   HTTPSERecentlyUsedCache<std::string> recently_used_cache_;
+  // Hosts that no rule applies to, whatever the rest of the URL.
+  HTTPSERecentlyUsedCache<bool> hosts_without_rules_cache_;
   std::unique_ptr<Engine, base::OnTaskRunnerDeleter> engine_;
 
   SEQUENCE_CHECKER(sequence_checker_);
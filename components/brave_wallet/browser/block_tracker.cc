@@ -5,7 +5,11 @@
 
 #include "brave/components/brave_wallet/browser/block_tracker.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "base/containers/contains.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 
 namespace brave_wallet {
@@ -21,10 +25,58 @@ void BlockTracker::Stop(const std::string& chain_id) {
   if (base::Contains(timers_, chain_id)) {
     timers_.erase(chain_id);
   }
+  intervals_.erase(chain_id);
 }
 
 void BlockTracker::Stop() {
   timers_.clear();
+  intervals_.clear();
+}
+
+base::TimeDelta BlockTracker::GetCurrentInterval(
+    const std::string& chain_id) const {
+  if (!IsRunning(chain_id)) {
+    return base::TimeDelta();
+  }
+  return timers_.at(chain_id)->GetCurrentDelay();
+}
+
+void BlockTracker::StartTimer(const std::string& chain_id,
+                              base::TimeDelta interval,
+                              base::RepeatingClosure task) {
+  if (!base::Contains(timers_, chain_id)) {
+    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
+  }
+  intervals_[chain_id] = interval;
+  timers_[chain_id]->Start(FROM_HERE, interval, std::move(task));
+}
+
+void BlockTracker::OnPollFailed(const std::string& chain_id) {
+  if (!IsRunning(chain_id) || !base::Contains(intervals_, chain_id)) {
+    return;
+  }
+  auto* timer = timers_[chain_id].get();
+  const base::TimeDelta max_interval =
+      intervals_[chain_id] * kBlockTrackerMaxBackoffFactor;
+  const base::TimeDelta interval =
+      std::min(timer->GetCurrentDelay() * 2, max_interval);
+  if (interval == timer->GetCurrentDelay()) {
+    return;
+  }
+  base::RepeatingClosure task = timer->user_task();
+  timer->Start(FROM_HERE, interval, std::move(task));
+}
+
+void BlockTracker::OnPollSucceeded(const std::string& chain_id) {
+  if (!IsRunning(chain_id) || !base::Contains(intervals_, chain_id)) {
+    return;
+  }
+  auto* timer = timers_[chain_id].get();
+  if (timer->GetCurrentDelay() == intervals_[chain_id]) {
+    return;
+  }
+  base::RepeatingClosure task = timer->user_task();
+  timer->Start(FROM_HERE, intervals_[chain_id], std::move(task));
 }
 
 bool BlockTracker::IsRunning(const std::string& chain_id) const {
@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
 #include "base/timer/timer.h"
@@ -27,10 +28,23 @@ class BlockTracker {
   virtual void Stop(const std::string& chain_id);
   virtual void Stop();
   bool IsRunning(const std::string& chain_id) const;
+  base::TimeDelta GetCurrentInterval(const std::string& chain_id) const;
 
  protected:
+  // If timer is already running, it will be replaced with new interval
+  void StartTimer(const std::string& chain_id,
+                  base::TimeDelta interval,
+                  base::RepeatingClosure task);
+  // Polling a chain whose RPC keeps failing is slowed down exponentially, up
+  // to kBlockTrackerMaxBackoffFactor times the interval passed to Start.
+  // First successful poll restores that interval.
+  void OnPollFailed(const std::string& chain_id);
+  void OnPollSucceeded(const std::string& chain_id);
+
   // <chain_id, timer>
   std::map<std::string, std::unique_ptr<base::RepeatingTimer>> timers_;
+  // <chain_id, interval passed to Start>
+  std::map<std::string, base::TimeDelta> intervals_;
   raw_ptr<JsonRpcService> json_rpc_service_ = nullptr;
 };
 
@@ -1223,6 +1223,7 @@ constexpr char kSolanaFeeRecipient[] =
     "3NUW8hWoCnLgJwWCVnwdFo2Dsz8bKwLac9A3VgS2jLUQ";
 
 constexpr int64_t kBlockTrackerDefaultTimeInSeconds = 20;
+constexpr int kBlockTrackerMaxBackoffFactor = 8;
 constexpr int64_t kLogTrackerDefaultTimeInSeconds = 20;
 
 constexpr char kPolygonMainnetEndpoint[] = "https://mainnet-polygon.brave.com/";
@@ -304,4 +304,59 @@ TEST_F(EthBlockTrackerUnitTest, GetBlockNumberRequestTimeout) {
   }
 }
 
+TEST_F(EthBlockTrackerUnitTest, BackoffOnFailure) {
+  EthBlockTracker tracker(json_rpc_service_.get());
+  size_t requests_count = 0;
+  bool fail = true;
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        ++requests_count;
+        url_loader_factory_.ClearResponses();
+        url_loader_factory_.AddResponse(
+            request.url.spec(),
+            fail ? "One ring to rule them all" : GetResponseString());
+      }));
+  response_block_num_ = 1;
+
+  tracker.Start(mojom::kMainnetChainId, base::Seconds(5));
+  EXPECT_EQ(tracker.GetCurrentInterval(mojom::kMainnetChainId),
+            base::Seconds(5));
+
+  // Polls at 5s, 15s, 35s and then every 40s.
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(requests_count, 3u);
+  EXPECT_EQ(tracker.GetCurrentInterval(mojom::kMainnetChainId),
+            base::Seconds(40));
+  requests_count = 0;
+  task_environment_.FastForwardBy(base::Minutes(2));
+  EXPECT_EQ(requests_count, 3u);
+  EXPECT_EQ(tracker.GetCurrentInterval(mojom::kMainnetChainId),
+            base::Seconds(40));
+
+  // First successful poll restores the interval.
+  fail = false;
+  requests_count = 0;
+  task_environment_.FastForwardBy(base::Seconds(15));
+  EXPECT_EQ(requests_count, 1u);
+  EXPECT_EQ(tracker.GetCurrentBlock(mojom::kMainnetChainId), uint256_t(1));
+  EXPECT_EQ(tracker.GetCurrentInterval(mojom::kMainnetChainId),
+            base::Seconds(5));
+  requests_count = 0;
+  task_environment_.FastForwardBy(base::Minutes(1));
+  EXPECT_EQ(requests_count, 12u);
+
+  // Start resets backoff.
+  fail = true;
+  task_environment_.FastForwardBy(base::Seconds(15));
+  EXPECT_EQ(tracker.GetCurrentInterval(mojom::kMainnetChainId),
+            base::Seconds(20));
+  tracker.Start(mojom::kMainnetChainId, base::Seconds(5));
+  EXPECT_EQ(tracker.GetCurrentInterval(mojom::kMainnetChainId),
+            base::Seconds(5));
+
+  tracker.Stop();
+  EXPECT_EQ(tracker.GetCurrentInterval(mojom::kMainnetChainId),
+            base::TimeDelta());
+}
+
 }  // namespace brave_wallet
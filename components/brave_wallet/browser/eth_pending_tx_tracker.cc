@@ -45,6 +45,11 @@ bool EthPendingTxTracker::UpdatePendingTransactions(
       pending_transactions.end(),
       std::make_move_iterator(signed_transactions.begin()),
       std::make_move_iterator(signed_transactions.end()));
+  // (chain_id, (ids, tx_hashes)) so receipts of all pending transactions on
+  // a chain are fetched with one batch request per block.
+  std::map<std::string,
+           std::pair<std::vector<std::string>, std::vector<std::string>>>
+      pending_by_chain;
   for (const auto& pending_transaction : pending_transactions) {
     if (IsNonceTaken(static_cast<const EthTxMeta&>(*pending_transaction))) {
       DropTransaction(pending_transaction.get());
@@ -52,12 +57,17 @@ bool EthPendingTxTracker::UpdatePendingTransactions(
     }
     const auto& pending_chain_id = pending_transaction->chain_id();
     pending_chain_ids->emplace(pending_chain_id);
-    std::string id = pending_transaction->id();
-    json_rpc_service_->GetTransactionReceipt(
-        pending_chain_id, pending_transaction->tx_hash(),
-        base::BindOnce(&EthPendingTxTracker::OnGetTxReceipt,
+    auto& [ids, tx_hashes] = pending_by_chain[pending_chain_id];
+    ids.push_back(pending_transaction->id());
+    tx_hashes.push_back(pending_transaction->tx_hash());
+  }
+
+  for (auto& [pending_chain_id, pending] : pending_by_chain) {
+    json_rpc_service_->GetTransactionReceipts(
+        pending_chain_id, pending.second,
+        base::BindOnce(&EthPendingTxTracker::OnGetTxReceipts,
                        weak_factory_.GetWeakPtr(), pending_chain_id,
-                       std::move(id)));
+                       std::move(pending.first)));
   }
 
   nonce_lock->Release();
@@ -69,29 +79,35 @@ void EthPendingTxTracker::Reset() {
   dropped_blocks_counter_.clear();
 }
 
-void EthPendingTxTracker::OnGetTxReceipt(const std::string& chain_id,
-                                         std::string id,
-                                         TransactionReceipt receipt,
-                                         mojom::ProviderError error,
-                                         const std::string& error_message) {
+void EthPendingTxTracker::OnGetTxReceipts(
+    const std::string& chain_id,
+    std::vector<std::string> ids,
+    std::vector<absl::optional<TransactionReceipt>> receipts,
+    mojom::ProviderError error,
+    const std::string& error_message) {
   if (error != mojom::ProviderError::kSuccess)
     return;
+  DCHECK_EQ(ids.size(), receipts.size());
   base::Lock* nonce_lock = nonce_tracker_->GetLock();
   if (!nonce_lock->Try())
     return;
 
-  std::unique_ptr<EthTxMeta> meta = tx_state_manager_->GetEthTx(chain_id, id);
-  if (!meta) {
-    nonce_lock->Release();
-    return;
-  }
-  if (receipt.status) {
-    meta->set_tx_receipt(receipt);
-    meta->set_status(mojom::TransactionStatus::Confirmed);
-    meta->set_confirmed_time(base::Time::Now());
-    tx_state_manager_->AddOrUpdateTx(*meta);
-  } else if (ShouldTxDropped(*meta)) {
-    DropTransaction(meta.get());
+  for (size_t i = 0; i < ids.size() && i < receipts.size(); ++i) {
+    // Same as a failed single receipt request, retry on next block.
+    if (!receipts[i])
+      continue;
+    std::unique_ptr<EthTxMeta> meta =
+        tx_state_manager_->GetEthTx(chain_id, ids[i]);
+    if (!meta)
+      continue;
+    if (receipts[i]->status) {
+      meta->set_tx_receipt(*receipts[i]);
+      meta->set_status(mojom::TransactionStatus::Confirmed);
+      meta->set_confirmed_time(base::Time::Now());
+      tx_state_manager_->AddOrUpdateTx(*meta);
+    } else if (ShouldTxDropped(*meta)) {
+      DropTransaction(meta.get());
+    }
   }
 
   nonce_lock->Release();
@@ -9,6 +9,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/gtest_prod_util.h"
@@ -42,11 +43,11 @@ class EthPendingTxTracker {
   FRIEND_TEST_ALL_PREFIXES(EthPendingTxTrackerUnitTest, ShouldTxDropped);
   FRIEND_TEST_ALL_PREFIXES(EthPendingTxTrackerUnitTest, DropTransaction);
 
-  void OnGetTxReceipt(const std::string& chain_id,
-                      std::string id,
-                      TransactionReceipt receipt,
-                      mojom::ProviderError error,
-                      const std::string& error_message);
+  void OnGetTxReceipts(const std::string& chain_id,
+                       std::vector<std::string> ids,
+                       std::vector<absl::optional<TransactionReceipt>> receipts,
+                       mojom::ProviderError error,
+                       const std::string& error_message);
   void OnGetNetworkNonce(const std::string& chain_id,
                          const std::string& address,
                          uint256_t result,
@@ -239,6 +239,13 @@ TEST(EthRequestUnitTest, eth_getTransactionReceipt) {
       R"({"id":1,"jsonrpc":"2.0","method":"eth_getTransactionReceipt","params":["0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238"]})");  // NOLINT
 }
 
+TEST(EthRequestUnitTest, eth_getTransactionReceipts) {
+  ASSERT_EQ(
+      eth_getTransactionReceipts({"0x1", "0x2"}),
+      R"([{"id":0,"jsonrpc":"2.0","method":"eth_getTransactionReceipt","params":["0x1"]},{"id":1,"jsonrpc":"2.0","method":"eth_getTransactionReceipt","params":["0x2"]}])");  // NOLINT
+  ASSERT_EQ(eth_getTransactionReceipts({}), "[]");
+}
+
 TEST(EthRequestUnitTest, eth_getUncleByBlockHashAndIndex) {
   ASSERT_EQ(
       eth_getUncleByBlockHashAndIndex(
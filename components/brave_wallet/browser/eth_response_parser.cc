@@ -179,6 +179,28 @@ bool ParseEthGetTransactionReceipt(const base::Value& json_value,
   return true;
 }
 
+absl::optional<std::vector<absl::optional<TransactionReceipt>>>
+ParseEthGetTransactionReceipts(const base::Value& json_value,
+                               size_t requests_count) {
+  if (!json_value.is_list())
+    return absl::nullopt;
+
+  std::vector<absl::optional<TransactionReceipt>> receipts(requests_count);
+  for (const auto& response : json_value.GetList()) {
+    if (!response.is_dict())
+      return absl::nullopt;
+    // Responses in a batch may be returned in any order.
+    absl::optional<int> id = response.GetDict().FindInt("id");
+    if (!id || *id < 0 || static_cast<size_t>(*id) >= requests_count)
+      continue;
+    TransactionReceipt receipt;
+    if (ParseEthGetTransactionReceipt(response, &receipt))
+      receipts[*id] = std::move(receipt);
+  }
+
+  return receipts;
+}
+
 absl::optional<std::string> ParseEthSendRawTransaction(
     const base::Value& json_value) {
   return ParseSingleStringResult(json_value);
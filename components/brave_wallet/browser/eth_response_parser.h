@@ -36,6 +36,12 @@ bool ParseEthGetTransactionCount(const base::Value& json_value,
                                  uint256_t* count);
 bool ParseEthGetTransactionReceipt(const base::Value& json_value,
                                    TransactionReceipt* receipt);
+// Parses response of eth_getTransactionReceipts batch request, receipts are
+// ordered by request id. Receipt is absl::nullopt when it is not available
+// (yet) for that transaction.
+absl::optional<std::vector<absl::optional<TransactionReceipt>>>
+ParseEthGetTransactionReceipts(const base::Value& json_value,
+                               size_t requests_count);
 absl::optional<std::string> ParseEthSendRawTransaction(
     const base::Value& json_value);
 absl::optional<std::string> ParseEthCall(const base::Value& json_value);
@@ -134,6 +134,46 @@ TEST(EthResponseParserUnitTest, ParseEthGetTransactionReceipt) {
   EXPECT_TRUE(receipt.status);
 }
 
+TEST(EthResponseParserUnitTest, ParseEthGetTransactionReceipts) {
+  std::string json(
+      R"([{
+      "id": 1,
+      "jsonrpc": "2.0",
+      "result": {
+        "transactionHash": "0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238",
+        "transactionIndex":  "0x1",
+        "blockNumber": "0xb",
+        "blockHash": "0xc6ef2fc5426d6ad6fd9e2a26abeab0aa2411b7ab17f30a99d3cb96aed1d1055b",
+        "cumulativeGasUsed": "0x33bc",
+        "gasUsed": "0x4dc",
+        "contractAddress": null,
+        "logs": [],
+        "logsBloom": "0x00...0",
+        "status": "0x1"
+      }
+    }, {
+      "id": 0,
+      "jsonrpc": "2.0",
+      "result": null
+    }, {
+      "id": 7,
+      "jsonrpc": "2.0",
+      "result": null
+    }])");
+  auto receipts = ParseEthGetTransactionReceipts(ParseJson(json), 3);
+  ASSERT_TRUE(receipts);
+  ASSERT_EQ(receipts->size(), 3u);
+  EXPECT_FALSE((*receipts)[0]);
+  ASSERT_TRUE((*receipts)[1]);
+  EXPECT_EQ((*receipts)[1]->block_number, (uint256_t)11);
+  EXPECT_TRUE((*receipts)[1]->status);
+  EXPECT_FALSE((*receipts)[2]);
+
+  // Not a batch response.
+  EXPECT_FALSE(ParseEthGetTransactionReceipts(
+      ParseJson(R"({"id": 1, "jsonrpc": "2.0", "result": null})"), 1));
+}
+
 TEST(EthResponseParserUnitTest, ParseEthGetTransactionReceiptNullContractAddr) {
   std::string json(
       R"({
@@ -0,0 +1,71 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <vector>
+
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
+#include "base/timer/lap_timer.h"
+#include "brave/components/brave_wallet/browser/ethereum_keyring.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kMetricPrefixEthereumKeyring[] = "EthereumKeyring.";
+constexpr char kMetricSignMessageTime[] = "sign_message_time";
+
+constexpr int kWarmupRuns = 5;
+constexpr int kTimeCheckInterval = 10;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixEthereumKeyring, story);
+  reporter.RegisterImportantMetric(kMetricSignMessageTime, "us");
+  return reporter;
+}
+
+void RunSignMessageTest(size_t accounts_number) {
+  std::vector<uint8_t> seed;
+  ASSERT_TRUE(base::HexStringToBytes(
+      "13ca6c28d26812f82db27908de0b0b7b18940cc4e9d96ebd7de190f706741489907ef65b"
+      "8f9e36c31dc46e81472b6a5e40a4487e725ace445b8203f243fb8958",
+      &seed));
+  EthereumKeyring keyring;
+  keyring.ConstructRootHDKey(seed, "m/44'/60'/0'/0");
+  keyring.AddAccounts(accounts_number);
+  const std::vector<std::string> accounts = keyring.GetAccounts();
+  ASSERT_EQ(accounts.size(), accounts_number);
+
+  // Signs with the last added account, which is the worst case for a lookup
+  // walking derived accounts.
+  const std::string& address = accounts.back();
+  std::vector<uint8_t> message;
+  ASSERT_TRUE(base::HexStringToBytes("deadbeef", &message));
+
+  base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    ASSERT_FALSE(keyring.SignMessage(address, message, 0, false).empty());
+    timer.NextLap();
+  } while (!timer.HasTimeLimitExpired());
+
+  auto reporter =
+      SetUpReporter(base::NumberToString(accounts_number) + "_accounts");
+  reporter.AddResult(kMetricSignMessageTime, timer.TimePerLap());
+}
+
+}  // namespace
+
+// Signing cost should stay flat as the number of accounts grows.
+TEST(EthereumKeyringPerfTest, SignMessage) {
+  for (size_t accounts_number : {1u, 10u, 100u, 500u}) {
+    RunSignMessageTest(accounts_number);
+  }
+}
+
+}  // namespace brave_wallet
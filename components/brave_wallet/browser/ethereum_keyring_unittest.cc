@@ -84,6 +84,35 @@ TEST(EthereumKeyringUnitTest, Accounts) {
   EXPECT_TRUE(keyring2.GetAddress(0).empty());
 }
 
+TEST(EthereumKeyringUnitTest, ManyAccountsLookup) {
+  constexpr size_t kAccountsNumber = 50;
+  std::vector<uint8_t> seed;
+  EXPECT_TRUE(base::HexStringToBytes(
+      "13ca6c28d26812f82db27908de0b0b7b18940cc4e9d96ebd7de190f706741489907ef65b"
+      "8f9e36c31dc46e81472b6a5e40a4487e725ace445b8203f243fb8958",
+      &seed));
+  EthereumKeyring keyring;
+  keyring.ConstructRootHDKey(seed, "m/44'/60'/0'/0");
+  keyring.AddAccounts(kAccountsNumber);
+  const std::vector<std::string> accounts = keyring.GetAccounts();
+  ASSERT_EQ(accounts.size(), kAccountsNumber);
+
+  std::vector<uint8_t> message;
+  EXPECT_TRUE(base::HexStringToBytes("deadbeef", &message));
+  for (const auto& address : accounts) {
+    EXPECT_TRUE(keyring.HasAddress(address));
+    EXPECT_FALSE(keyring.SignMessage(address, message, 0, false).empty());
+  }
+
+  keyring.RemoveAccount();
+  EXPECT_FALSE(keyring.HasAddress(accounts.back()));
+  EXPECT_TRUE(keyring.SignMessage(accounts.back(), message, 0, false).empty());
+  EXPECT_TRUE(keyring.HasAddress(accounts.front()));
+
+  keyring.AddAccounts(1);
+  EXPECT_TRUE(keyring.HasAddress(accounts.back()));
+}
+
 TEST(EthereumKeyringUnitTest, SignTransaction) {
   // Specific signature check is in eth_transaction_unittest.cc
   EthereumKeyring keyring;
@@ -118,6 +147,7 @@ TEST(EthereumKeyringUnitTest, SignMessage) {
   keyring.accounts_.push_back(std::move(key));
   EXPECT_EQ(keyring.GetAddress(0),
             "0xbE93f9BacBcFFC8ee6663f2647917ed7A20a57BB");
+  keyring.accounts_by_address_[keyring.GetAddress(0)] = 0;
 
   std::vector<uint8_t> message;
   EXPECT_TRUE(base::HexStringToBytes("deadbeef", &message));
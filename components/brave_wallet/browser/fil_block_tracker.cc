@@ -21,14 +21,10 @@ FilBlockTracker::~FilBlockTracker() = default;
 
 void FilBlockTracker::Start(const std::string& chain_id,
                             base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&FilBlockTracker::GetFilBlockHeight,
-                          weak_ptr_factory_.GetWeakPtr(), chain_id,
-                          base::NullCallback()));
+  StartTimer(chain_id, interval,
+             base::BindRepeating(&FilBlockTracker::GetFilBlockHeight,
+                                 weak_ptr_factory_.GetWeakPtr(), chain_id,
+                                 base::NullCallback()));
 }
 
 void FilBlockTracker::GetFilBlockHeight(const std::string& chain_id,
@@ -57,8 +53,10 @@ void FilBlockTracker::OnGetFilBlockHeight(const std::string& chain_id,
   if (error != mojom::FilecoinProviderError::kSuccess) {
     VLOG(1) << __FUNCTION__ << ": Failed to get latest height, error: "
             << static_cast<int>(error) << ", error_message: " << error_message;
+    OnPollFailed(chain_id);
     return;
   }
+  OnPollSucceeded(chain_id);
   if (GetLatestHeight(chain_id) == latest_height) {
     return;
   }
@@ -30,8 +30,9 @@ std::vector<AddedAcountInfo> HDKeyring::AddAccounts(size_t number) {
   size_t cur_accounts_number = accounts_.size();
   for (size_t i = cur_accounts_number; i < cur_accounts_number + number; ++i) {
     auto& added_account = accounts_.emplace_back(DeriveAccount(i));
-    result.push_back(
-        {added_account->GetPath(), GetAddressInternal(added_account.get())});
+    std::string address = GetAddressInternal(added_account.get());
+    accounts_by_address_[address] = i;
+    result.push_back({added_account->GetPath(), std::move(address)});
   }
 
   return result;
@@ -46,6 +47,10 @@ std::vector<std::string> HDKeyring::GetAccounts() const {
 }
 
 void HDKeyring::RemoveAccount() {
+  if (accounts_.empty()) {
+    return;
+  }
+  accounts_by_address_.erase(GetAddressInternal(accounts_.back().get()));
   accounts_.pop_back();
 }
 
@@ -55,10 +60,8 @@ bool HDKeyring::AddImportedAddress(const std::string& address,
   if (imported_accounts_.find(address) != imported_accounts_.end())
     return false;
   // Check if it is duplicate in derived accounts
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return false;
-  }
+  if (accounts_by_address_.find(address) != accounts_by_address_.end())
+    return false;
 
   imported_accounts_[address] = std::move(hd_key);
   return true;
@@ -120,19 +123,14 @@ HDKeyBase* HDKeyring::GetHDKeyFromAddress(const std::string& address) {
   const auto imported_accounts_iter = imported_accounts_.find(address);
   if (imported_accounts_iter != imported_accounts_.end())
     return imported_accounts_iter->second.get();
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return accounts_[i].get();
-  }
+  const auto accounts_iter = accounts_by_address_.find(address);
+  if (accounts_iter != accounts_by_address_.end())
+    return accounts_[accounts_iter->second].get();
   return nullptr;
 }
 
 bool HDKeyring::HasAddress(const std::string& address) {
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return true;
-  }
-  return false;
+  return accounts_by_address_.find(address) != accounts_by_address_.end();
 }
 
 bool HDKeyring::HasImportedAddress(const std::string& address) {
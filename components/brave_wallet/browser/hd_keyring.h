@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/containers/flat_map.h"
@@ -71,6 +72,9 @@ class HDKeyring {
 
   std::unique_ptr<HDKeyBase> root_;
   std::vector<std::unique_ptr<HDKeyBase>> accounts_;
+  // (address, index in accounts_) so address lookups don't need to derive
+  // address for each account.
+  std::unordered_map<std::string, size_t> accounts_by_address_;
   // TODO(apaymyshev): make separate abstraction for imported keys as they are
   // not HD keys.
   // (address, key)
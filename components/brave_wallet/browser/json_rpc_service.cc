@@ -9,6 +9,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "base/barrier_callback.h"
 #include "base/base64.h"
 #include "base/feature_list.h"
 #include "base/functional/bind.h"
@@ -1096,6 +1097,87 @@ void JsonRpcService::OnGetTransactionReceipt(
   std::move(callback).Run(receipt, mojom::ProviderError::kSuccess, "");
 }
 
+void JsonRpcService::GetTransactionReceipts(
+    const std::string& chain_id,
+    const std::vector<std::string>& tx_hashes,
+    GetTxReceiptsCallback callback) {
+  auto internal_callback = base::BindOnce(
+      &JsonRpcService::OnGetTransactionReceipts, weak_ptr_factory_.GetWeakPtr(),
+      chain_id, tx_hashes, std::move(callback));
+  RequestInternal(eth::eth_getTransactionReceipts(tx_hashes), true,
+                  GetNetworkURL(prefs_, chain_id, mojom::CoinType::ETH),
+                  std::move(internal_callback));
+}
+
+void JsonRpcService::OnGetTransactionReceipts(
+    const std::string& chain_id,
+    const std::vector<std::string>& tx_hashes,
+    GetTxReceiptsCallback callback,
+    APIRequestResult api_request_result) {
+  absl::optional<std::vector<absl::optional<TransactionReceipt>>> receipts;
+  if (api_request_result.Is2XXResponseCode()) {
+    receipts = eth::ParseEthGetTransactionReceipts(
+        api_request_result.value_body(), tx_hashes.size());
+  }
+  if (!receipts) {
+    // Some endpoints, custom networks in particular, reject batch requests
+    // or answer them with a single error object. Ask for every receipt
+    // separately so transactions on those networks still get confirmed.
+    GetTransactionReceiptsOneByOne(chain_id, tx_hashes, std::move(callback));
+    return;
+  }
+
+  std::move(callback).Run(std::move(*receipts), mojom::ProviderError::kSuccess,
+                          "");
+}
+
+void JsonRpcService::GetTransactionReceiptsOneByOne(
+    const std::string& chain_id,
+    const std::vector<std::string>& tx_hashes,
+    GetTxReceiptsCallback callback) {
+  if (tx_hashes.empty()) {
+    std::move(callback).Run({}, mojom::ProviderError::kSuccess, "");
+    return;
+  }
+
+  auto barrier_callback =
+      base::BarrierCallback<std::pair<size_t, TransactionReceiptResult>>(
+          tx_hashes.size(),
+          base::BindOnce(&JsonRpcService::OnGetTransactionReceiptsOneByOne,
+                         weak_ptr_factory_.GetWeakPtr(), tx_hashes.size(),
+                         std::move(callback)));
+  for (size_t i = 0; i < tx_hashes.size(); ++i) {
+    GetTransactionReceipt(
+        chain_id, tx_hashes[i],
+        base::BindOnce(
+            [](size_t index,
+               const base::RepeatingCallback<void(
+                   std::pair<size_t, TransactionReceiptResult>)>& callback,
+               TransactionReceipt receipt, mojom::ProviderError error,
+               const std::string& error_message) {
+              TransactionReceiptResult result;
+              if (error == mojom::ProviderError::kSuccess) {
+                result = std::move(receipt);
+              }
+              callback.Run({index, std::move(result)});
+            },
+            i, barrier_callback));
+  }
+}
+
+void JsonRpcService::OnGetTransactionReceiptsOneByOne(
+    size_t requests_count,
+    GetTxReceiptsCallback callback,
+    std::vector<std::pair<size_t, TransactionReceiptResult>> results) {
+  // Failed requests are left empty, same as a null entry in a batch response.
+  std::vector<TransactionReceiptResult> receipts(requests_count);
+  for (auto& [index, receipt] : results) {
+    receipts[index] = std::move(receipt);
+  }
+  std::move(callback).Run(std::move(receipts), mojom::ProviderError::kSuccess,
+                          "");
+}
+
 void JsonRpcService::SendRawTransaction(const std::string& chain_id,
                                         const std::string& signed_tx,
                                         SendRawTxCallback callback) {
@@ -167,6 +167,18 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
                              const std::string& tx_hash,
                              GetTxReceiptCallback callback);
 
+  // Fetches receipts for all |tx_hashes| with one JSON-RPC batch request,
+  // falling back to a request per transaction when the endpoint doesn't
+  // support batches. |results| are in the same order as |tx_hashes|.
+  using TransactionReceiptResult = absl::optional<TransactionReceipt>;
+  using GetTxReceiptsCallback = base::OnceCallback<void(
+      std::vector<TransactionReceiptResult> results,
+      mojom::ProviderError error,
+      const std::string& error_message)>;
+  void GetTransactionReceipts(const std::string& chain_id,
+                              const std::vector<std::string>& tx_hashes,
+                              GetTxReceiptsCallback callback);
+
   using SendRawTxCallback =
       base::OnceCallback<void(const std::string& tx_hash,
                               mojom::ProviderError error,
@@ -521,6 +533,18 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
                                  APIRequestResult api_request_result);
   void OnGetTransactionReceipt(GetTxReceiptCallback callback,
                                APIRequestResult api_request_result);
+  void OnGetTransactionReceipts(const std::string& chain_id,
+                                const std::vector<std::string>& tx_hashes,
+                                GetTxReceiptsCallback callback,
+                                APIRequestResult api_request_result);
+  void GetTransactionReceiptsOneByOne(
+      const std::string& chain_id,
+      const std::vector<std::string>& tx_hashes,
+      GetTxReceiptsCallback callback);
+  void OnGetTransactionReceiptsOneByOne(
+      size_t requests_count,
+      GetTxReceiptsCallback callback,
+      std::vector<std::pair<size_t, TransactionReceiptResult>> results);
   void OnSendRawTransaction(SendRawTxCallback callback,
                             APIRequestResult api_request_result);
   void OnGetERC20TokenBalance(GetERC20TokenBalanceCallback callback,
@@ -10,13 +10,16 @@
 
 #include "base/base64.h"
 #include "base/check_op.h"
+#include "base/barrier_callback.h"
 #include "base/command_line.h"
 #include "base/logging.h"
 #include "base/notreached.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "base/value_iterators.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/bitcoin_keyring.h"
@@ -215,6 +218,17 @@ int GetPbkdf2Iterations() {
       kPbkdf2Iterations);
 }
 
+// Runs on the thread pool, PBKDF2 with 310000 iterations is too expensive to
+// block UI thread on.
+KeyringService::DerivedEncryptor DeriveEncryptorForKeyring(
+    const std::string& keyring_id,
+    const std::string& password,
+    const std::vector<uint8_t>& salt,
+    int iterations) {
+  return {keyring_id, PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
+                          password, salt, iterations, kPbkdf2KeySize)};
+}
+
 const base::Value::List* GetPrefForKeyringList(const PrefService& profile_prefs,
                                                const std::string& key,
                                                const std::string& id) {
@@ -604,6 +618,16 @@ HDKeyring* KeyringService::ResumeKeyring(const std::string& keyring_id,
     return nullptr;
   }
 
+  return ResumeKeyringWithEncryptor(keyring_id);
+}
+
+HDKeyring* KeyringService::ResumeKeyringWithEncryptor(
+    const std::string& keyring_id) {
+  DCHECK(profile_prefs_);
+  if (!encryptors_[keyring_id]) {
+    return nullptr;
+  }
+
   const std::string mnemonic = GetMnemonicForKeyringImpl(keyring_id);
   if (mnemonic.empty()) {
     return nullptr;
@@ -1782,6 +1806,10 @@ absl::optional<std::string> KeyringService::GetFilecoinSelectedAccount(
 }
 
 void KeyringService::Lock() {
+  // An unlock which is still deriving keys must not unlock the wallet once
+  // it's done.
+  CancelPendingUnlock();
+
   if (IsLockedSync()) {
     return;
   }
@@ -1809,14 +1837,76 @@ bool KeyringService::IsHardwareAccount(const std::string& keyring_id,
 
 void KeyringService::Unlock(const std::string& password,
                             KeyringService::UnlockCallback callback) {
-  if (!ResumeKeyring(mojom::kDefaultKeyringId, password)) {
+  if (password.empty()) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  // Only one unlock at a time, a second attempt is rejected rather than racing
+  // the first one.
+  if (pending_unlock_callback_) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  // Added 08.08.2022
+  MaybeMigratePBKDF2Iterations(password);
+
+  std::vector<std::string> keyring_ids = {mojom::kDefaultKeyringId};
+  if (IsFilecoinEnabled()) {
+    keyring_ids.push_back(mojom::kFilecoinKeyringId);
+    keyring_ids.push_back(mojom::kFilecoinTestnetKeyringId);
+  }
+  if (IsSolanaEnabled()) {
+    keyring_ids.push_back(mojom::kSolanaKeyringId);
+  }
+  if (IsBitcoinEnabled()) {
+    keyring_ids.push_back(mojom::kBitcoinKeyringId);
+  }
+
+  // Every keyring has its own salt so keys are derived in parallel, one thread
+  // pool task per keyring.
+  pending_unlock_callback_ = std::move(callback);
+  auto barrier_callback = base::BarrierCallback<DerivedEncryptor>(
+      keyring_ids.size(),
+      base::BindOnce(&KeyringService::OnUnlockEncryptorsDerived,
+                     unlock_weak_factory_.GetWeakPtr()));
+  for (const auto& keyring_id : keyring_ids) {
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+        base::BindOnce(&DeriveEncryptorForKeyring, keyring_id, password,
+                       GetOrCreateSaltForKeyring(keyring_id),
+                       GetPbkdf2Iterations()),
+        barrier_callback);
+  }
+}
+
+void KeyringService::OnUnlockEncryptorsDerived(
+    std::vector<DerivedEncryptor> derived_encryptors) {
+  DCHECK(pending_unlock_callback_);
+  UnlockCallback callback = std::move(pending_unlock_callback_);
+
+  // The password is checked against the default keyring before any other
+  // encryptor is installed, so a wrong password leaves every keyring locked.
+  auto default_it = base::ranges::find(derived_encryptors,
+                                       mojom::kDefaultKeyringId,
+                                       &DerivedEncryptor::keyring_id);
+  DCHECK(default_it != derived_encryptors.end());
+  encryptors_[mojom::kDefaultKeyringId] = std::move(default_it->encryptor);
+  if (!ResumeKeyringWithEncryptor(mojom::kDefaultKeyringId)) {
     encryptors_.erase(mojom::kDefaultKeyringId);
     std::move(callback).Run(false);
     return;
   }
 
+  for (auto& derived : derived_encryptors) {
+    if (derived.keyring_id != mojom::kDefaultKeyringId) {
+      encryptors_[derived.keyring_id] = std::move(derived.encryptor);
+    }
+  }
+
   if (IsFilecoinEnabled()) {
-    if (!ResumeKeyring(mojom::kFilecoinKeyringId, password)) {
+    if (!ResumeKeyringWithEncryptor(mojom::kFilecoinKeyringId)) {
       // If Filecoin keyring doesnt exist we keep encryptor pre-created
       // to be able to lazily create keyring later
       if (IsKeyringExist(mojom::kFilecoinKeyringId)) {
@@ -1827,7 +1917,7 @@ void KeyringService::Unlock(const std::string& password,
       }
     }
 
-    if (!ResumeKeyring(mojom::kFilecoinTestnetKeyringId, password)) {
+    if (!ResumeKeyringWithEncryptor(mojom::kFilecoinTestnetKeyringId)) {
       if (IsKeyringExist(mojom::kFilecoinTestnetKeyringId)) {
         VLOG(1) << __func__ << " Unable to unlock filecoin testnet keyring";
         encryptors_.erase(mojom::kFilecoinTestnetKeyringId);
@@ -1837,7 +1927,8 @@ void KeyringService::Unlock(const std::string& password,
     }
   }
 
-  if (IsSolanaEnabled() && !ResumeKeyring(mojom::kSolanaKeyringId, password)) {
+  if (IsSolanaEnabled() &&
+      !ResumeKeyringWithEncryptor(mojom::kSolanaKeyringId)) {
     if (IsKeyringExist(mojom::kSolanaKeyringId)) {
       VLOG(1) << __func__ << " Unable to unlock Solana keyring";
       encryptors_.erase(mojom::kSolanaKeyringId);
@@ -1847,7 +1938,8 @@ void KeyringService::Unlock(const std::string& password,
   }
 
   if (IsBitcoinEnabled()) {
-    auto* bitcoin_keyring = ResumeKeyring(mojom::kBitcoinKeyringId, password);
+    auto* bitcoin_keyring =
+        ResumeKeyringWithEncryptor(mojom::kBitcoinKeyringId);
     DCHECK(bitcoin_keyring);
   }
 
@@ -1861,6 +1953,13 @@ void KeyringService::Unlock(const std::string& password,
   std::move(callback).Run(true);
 }
 
+void KeyringService::CancelPendingUnlock() {
+  unlock_weak_factory_.InvalidateWeakPtrs();
+  if (pending_unlock_callback_) {
+    std::move(pending_unlock_callback_).Run(false);
+  }
+}
+
 void KeyringService::OnAutoLockFired() {
   Lock();
 }
@@ -1874,6 +1973,7 @@ void KeyringService::Reset(bool notify_observer) {
   encryptors_.clear();
   keyrings_.clear();
   discovery_weak_factory_.InvalidateWeakPtrs();
+  CancelPendingUnlock();
   ClearKeyringServiceProfilePrefs(profile_prefs_);
   if (notify_observer) {
     for (const auto& observer : observers_) {
@@ -51,6 +51,12 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
                  PrefService* local_state);
   ~KeyringService() override;
 
+  // Key derived for a keyring off the UI thread.
+  struct DerivedEncryptor {
+    std::string keyring_id;
+    std::unique_ptr<PasswordEncryptor> encryptor;
+  };
+
   static absl::optional<int>& GetPbkdf2IterationsForTesting();
   static void MigrateObsoleteProfilePrefs(PrefService* profile_prefs);
 
@@ -267,6 +273,8 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   FRIEND_TEST_ALL_PREFIXES(KeyringServiceUnitTest,
                            DefaultSolanaAccountRestored);
   FRIEND_TEST_ALL_PREFIXES(KeyringServiceUnitTest, AccountsAdded);
+  FRIEND_TEST_ALL_PREFIXES(KeyringServiceUnitTest,
+                           UnlockWithWrongPasswordKeepsAllKeyringsLocked);
   FRIEND_TEST_ALL_PREFIXES(KeyringServiceAccountDiscoveryUnitTest,
                            AccountDiscovery);
   FRIEND_TEST_ALL_PREFIXES(KeyringServiceAccountDiscoveryUnitTest,
@@ -355,6 +363,13 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   // It's used to reconstruct same default keyring between browser relaunch
   HDKeyring* ResumeKeyring(const std::string& keyring_id,
                            const std::string& password);
+  // Same as `ResumeKeyring` but uses the encryptor which is already in
+  // `encryptors_`.
+  HDKeyring* ResumeKeyringWithEncryptor(const std::string& keyring_id);
+  void OnUnlockEncryptorsDerived(
+      std::vector<DerivedEncryptor> derived_encryptors);
+  // Drops the keys of a pending unlock and fails its callback.
+  void CancelPendingUnlock();
 
   void MaybeMigratePBKDF2Iterations(const std::string& password);
 
@@ -392,11 +407,14 @@ class KeyringService : public KeyedService, public mojom::KeyringService {
   raw_ptr<PrefService> profile_prefs_ = nullptr;
   raw_ptr<PrefService> local_state_ = nullptr;
   bool request_unlock_pending_ = false;
+  // Callback of the unlock whose keys are being derived, if any.
+  UnlockCallback pending_unlock_callback_;
 
   mojo::RemoteSet<mojom::KeyringServiceObserver> observers_;
   mojo::ReceiverSet<mojom::KeyringService> receivers_;
 
   base::WeakPtrFactory<KeyringService> discovery_weak_factory_{this};
+  base::WeakPtrFactory<KeyringService> unlock_weak_factory_{this};
 
   KeyringService(const KeyringService&) = delete;
   KeyringService& operator=(const KeyringService&) = delete;
@@ -30,14 +30,10 @@ SolanaBlockTracker::~SolanaBlockTracker() = default;
 
 void SolanaBlockTracker::Start(const std::string& chain_id,
                                base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&SolanaBlockTracker::GetLatestBlockhash,
-                          weak_ptr_factory_.GetWeakPtr(), chain_id,
-                          base::NullCallback(), false));
+  StartTimer(chain_id, interval,
+             base::BindRepeating(&SolanaBlockTracker::GetLatestBlockhash,
+                                 weak_ptr_factory_.GetWeakPtr(), chain_id,
+                                 base::NullCallback(), false));
 }
 
 void SolanaBlockTracker::GetLatestBlockhash(const std::string& chain_id,
@@ -74,8 +70,10 @@ void SolanaBlockTracker::OnGetLatestBlockhash(
   if (error != mojom::SolanaProviderError::kSuccess) {
     VLOG(1) << __FUNCTION__ << ": Failed to get latest blockhash, error: "
             << static_cast<int>(error) << ", error_message: " << error_message;
+    OnPollFailed(chain_id);
     return;
   }
+  OnPollSucceeded(chain_id);
 
   if (base::Contains(latest_blockhash_map_, chain_id) &&
       latest_blockhash_map_[chain_id] == latest_blockhash) {
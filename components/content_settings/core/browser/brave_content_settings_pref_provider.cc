@@ -6,6 +6,9 @@
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
 
 #include <memory>
+#include <set>
+#include <string>
+#include <tuple>
 #include <utility>
 
 #include "base/containers/contains.h"
@@ -20,6 +23,7 @@
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "brave/components/constants/pref_names.h"
 #include "brave/components/content_settings/core/browser/brave_content_settings_utils.h"
+#include "brave/components/content_settings/core/browser/brave_shield_rules_index.h"
 #include "brave/components/content_settings/core/common/content_settings_util.h"
 #include "brave/components/google_sign_in_permission/google_sign_in_permission_util.h"
 #include "build/build_config.h"
@@ -59,20 +63,17 @@ Rule CloneRule(const Rule& original_rule) {
               original_rule.value.Clone(), original_rule.metadata);
 }
 
-bool IsActive(const Rule& cookie_rule, const std::vector<Rule>& shield_rules) {
+bool IsActive(const Rule& cookie_rule, const ShieldRulesIndex& shield_rules) {
   // don't include default rules in the iterator
   if (cookie_rule.primary_pattern == ContentSettingsPattern::Wildcard() &&
       cookie_rule.secondary_pattern == ContentSettingsPattern::Wildcard()) {
     return false;
   }
 
-  for (const auto& shield_rule : shield_rules) {
-    auto primary_compare =
-        shield_rule.primary_pattern.Compare(cookie_rule.secondary_pattern);
-    if (primary_compare == ContentSettingsPattern::IDENTITY ||
-        primary_compare == ContentSettingsPattern::SUCCESSOR) {
-      return ValueToContentSetting(shield_rule.value) != CONTENT_SETTING_BLOCK;
-    }
+  const Rule* shield_rule =
+      shield_rules.FindFirstMatch(cookie_rule.secondary_pattern);
+  if (shield_rule) {
+    return ValueToContentSetting(shield_rule->value) != CONTENT_SETTING_BLOCK;
   }
 
   return true;
@@ -721,12 +722,13 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
 
   // add brave cookies after checking shield status
   {
+    const ShieldRulesIndex shield_rules_index(shield_rules);
     auto brave_cookies_iterator = PrefProvider::GetRuleIterator(
         ContentSettingsType::BRAVE_COOKIES, incognito);
     // Matching cookie rules against shield rules.
     while (brave_cookies_iterator && brave_cookies_iterator->HasNext()) {
       auto rule = brave_cookies_iterator->Next();
-      if (IsActive(rule, shield_rules)) {
+      if (IsActive(rule, shield_rules_index)) {
         rules.emplace_back(CloneRule(rule));
         brave_cookie_rules_[incognito].emplace_back(CloneRule(rule));
       }
@@ -763,32 +765,37 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   }
 
   // get the list of changes
+  std::set<std::tuple<ContentSettingsPattern, ContentSettingsPattern,
+                      ContentSetting>>
+      old_rule_settings;
+  for (const auto& old_rule : old_rules) {
+    old_rule_settings.emplace(old_rule.primary_pattern,
+                              old_rule.secondary_pattern,
+                              ValueToContentSetting(old_rule.value));
+  }
   std::vector<Rule> brave_cookie_updates;
+  std::set<std::pair<ContentSettingsPattern, ContentSettingsPattern>>
+      new_rule_patterns;
   for (const auto& new_rule : brave_cookie_rules_[incognito]) {
-    auto match =
-        base::ranges::find_if(old_rules, [&new_rule](const auto& old_rule) {
-          // we want an exact match here because any change to the rule
-          // is an update
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern &&
-                 ValueToContentSetting(new_rule.value) ==
-                     ValueToContentSetting(old_rule.value);
-        });
-    if (match == old_rules.end()) {
+    new_rule_patterns.emplace(new_rule.primary_pattern,
+                              new_rule.secondary_pattern);
+    // we want an exact match here because any change to the rule
+    // is an update
+    const auto new_rule_setting =
+        std::make_tuple(new_rule.primary_pattern, new_rule.secondary_pattern,
+                        ValueToContentSetting(new_rule.value));
+    if (!base::Contains(old_rule_settings, new_rule_setting)) {
       brave_cookie_updates.emplace_back(CloneRule(new_rule));
     }
   }
 
   // find any removed rules
   for (const auto& old_rule : old_rules) {
-    auto match = base::ranges::find_if(
-        brave_cookie_rules_[incognito], [&old_rule](const auto& new_rule) {
-          // we only care about the patterns here because we're looking
-          // for deleted rules, not changed rules
-          return new_rule.primary_pattern == old_rule.primary_pattern &&
-                 new_rule.secondary_pattern == old_rule.secondary_pattern;
-        });
-    if (match == brave_cookie_rules_[incognito].end()) {
+    // we only care about the patterns here because we're looking
+    // for deleted rules, not changed rules
+    if (!base::Contains(new_rule_patterns,
+                        std::make_pair(old_rule.primary_pattern,
+                                       old_rule.secondary_pattern))) {
       brave_cookie_updates.emplace_back(old_rule.primary_pattern,
                                         old_rule.secondary_pattern,
                                         base::Value(), old_rule.metadata);
@@ -0,0 +1,132 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/run_loop.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
+#include "base/timer/elapsed_timer.h"
+#include "base/timer/lap_timer.h"
+#include "base/values.h"
+#include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/content_settings/core/browser/content_settings_registry.h"
+#include "components/content_settings/core/common/content_settings.h"
+#include "components/content_settings/core/common/content_settings_pattern.h"
+#include "components/content_settings/core/common/content_settings_types.h"
+#include "components/content_settings/core/common/content_settings_utils.h"
+#include "components/prefs/pref_service.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace content_settings {
+
+namespace {
+
+constexpr char kMetricPrefixBravePrefProvider[] = "BravePrefProvider.";
+constexpr char kMetricLoadTime[] = "load_time";
+constexpr char kMetricToggleShieldsTime[] = "toggle_shields_time";
+
+constexpr int kWarmupRuns = 1;
+constexpr int kTimeCheckInterval = 1;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixBravePrefProvider,
+                                         story);
+  reporter.RegisterImportantMetric(kMetricLoadTime, "ms");
+  reporter.RegisterImportantMetric(kMetricToggleShieldsTime, "ms");
+  return reporter;
+}
+
+base::Value::Dict MakeSetting(ContentSetting setting) {
+  base::Value::Dict value;
+  value.Set("expiration", "0");
+  value.Set("last_modified", "13304670271801570");
+  value.Set("model", 0);
+  value.Set("setting", static_cast<int>(setting));
+  return value;
+}
+
+}  // namespace
+
+class BravePrefProviderPerfTest : public testing::Test {
+ public:
+  BravePrefProviderPerfTest() {
+    // Ensure all content settings are initialized.
+    ContentSettingsRegistry::GetInstance();
+  }
+
+  void SetUp() override {
+    testing_profile_ = TestingProfile::Builder().Build();
+  }
+
+  void TearDown() override { testing_profile_.reset(); }
+
+  // Blocks cookies on |sites_count| sites and turns shields down on every
+  // other one, then toggles shields for a single site.
+  void RunSiteExceptionsTest(int sites_count) {
+    PrefService* prefs = testing_profile_->GetPrefs();
+    BravePrefProvider provider(prefs, false /* incognito */,
+                               true /* store_last_modified */,
+                               false /* restore_session */);
+
+    base::Value::Dict cookies;
+    base::Value::Dict shields;
+    for (int i = 0; i < sites_count; ++i) {
+      const std::string site = "[*.]site" + base::NumberToString(i) + ".com";
+      cookies.Set("*," + site, MakeSetting(CONTENT_SETTING_BLOCK));
+      if (i % 2 == 0) {
+        shields.Set(site + ",*", MakeSetting(CONTENT_SETTING_BLOCK));
+      }
+    }
+    base::ElapsedTimer load_timer;
+    prefs->SetDict("profile.content_settings.exceptions.shieldsCookiesV3",
+                   std::move(cookies));
+    prefs->SetDict("profile.content_settings.exceptions.braveShields",
+                   std::move(shields));
+    base::RunLoop().RunUntilIdle();
+    const base::TimeDelta load_time = load_timer.Elapsed();
+
+    const auto site_pattern =
+        ContentSettingsPattern::FromString("[*.]site1.com");
+    bool shields_down = false;
+    base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+    do {
+      shields_down = !shields_down;
+      provider.SetWebsiteSetting(
+          site_pattern, ContentSettingsPattern::Wildcard(),
+          ContentSettingsType::BRAVE_SHIELDS,
+          ContentSettingToValue(shields_down ? CONTENT_SETTING_BLOCK
+                                             : CONTENT_SETTING_ALLOW),
+          {});
+      timer.NextLap();
+    } while (!timer.HasTimeLimitExpired());
+
+    auto reporter =
+        SetUpReporter(base::NumberToString(sites_count) + "_sites");
+    reporter.AddResult(kMetricLoadTime, load_time);
+    reporter.AddResult(kMetricToggleShieldsTime, timer.TimePerLap());
+    provider.ShutdownOnUIThread();
+  }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<TestingProfile> testing_profile_;
+};
+
+TEST_F(BravePrefProviderPerfTest, SiteExceptions100) {
+  RunSiteExceptionsTest(100);
+}
+
+TEST_F(BravePrefProviderPerfTest, SiteExceptions10000) {
+  RunSiteExceptionsTest(10000);
+}
+
+}  // namespace content_settings
@@ -8,6 +8,7 @@
 
 #include "base/json/values_util.h"
 #include "base/memory/raw_ptr.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "brave/components/constants/pref_names.h"
@@ -713,4 +714,63 @@ TEST_F(BravePrefProviderTest, EnsureNoWildcardEntries) {
   provider.ShutdownOnUIThread();
 }
 
+TEST_F(BravePrefProviderTest, ManySiteExceptions) {
+  constexpr int kSitesCount = 100;
+  BravePrefProvider provider(
+      testing_profile()->GetPrefs(), false /* incognito */,
+      true /* store_last_modified */, false /* restore_session */);
+
+  auto make_setting = [](ContentSetting setting) {
+    base::Value::Dict value;
+    value.Set("expiration", "0");
+    value.Set("last_modified", "13304670271801570");
+    value.Set("model", 0);
+    value.Set("setting", static_cast<int>(setting));
+    return value;
+  };
+
+  // Block cookies on every site and turn shields down on every other one.
+  base::Value::Dict cookies;
+  base::Value::Dict shields;
+  for (int i = 0; i < kSitesCount; ++i) {
+    const std::string site = "[*.]site" + base::NumberToString(i) + ".com";
+    cookies.Set("*," + site, make_setting(CONTENT_SETTING_BLOCK));
+    if (i % 2 == 0) {
+      shields.Set(site + ",*", make_setting(CONTENT_SETTING_BLOCK));
+    }
+  }
+  testing_profile()->GetPrefs()->SetDict(
+      "profile.content_settings.exceptions.shieldsCookiesV3",
+      std::move(cookies));
+  testing_profile()->GetPrefs()->SetDict(
+      "profile.content_settings.exceptions.braveShields", std::move(shields));
+  base::RunLoop().RunUntilIdle();
+
+  const GURL first_party("https://example.com");
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            TestUtils::GetContentSetting(&provider, first_party,
+                                         GURL("https://site0.com"),
+                                         ContentSettingsType::COOKIES, false));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, first_party,
+                                         GURL("https://site1.com"),
+                                         ContentSettingsType::COOKIES, false));
+
+  // Toggling shields for a single site.
+  provider.SetWebsiteSetting(
+      ContentSettingsPattern::FromString("[*.]site1.com"),
+      ContentSettingsPattern::Wildcard(), ContentSettingsType::BRAVE_SHIELDS,
+      ContentSettingToValue(CONTENT_SETTING_BLOCK), {});
+
+  EXPECT_EQ(CONTENT_SETTING_ALLOW,
+            TestUtils::GetContentSetting(&provider, first_party,
+                                         GURL("https://site1.com"),
+                                         ContentSettingsType::COOKIES, false));
+  EXPECT_EQ(CONTENT_SETTING_BLOCK,
+            TestUtils::GetContentSetting(&provider, first_party,
+                                         GURL("https://site3.com"),
+                                         ContentSettingsType::COOKIES, false));
+  provider.ShutdownOnUIThread();
+}
+
 }  //  namespace content_settings
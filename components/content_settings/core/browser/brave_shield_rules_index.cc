@@ -0,0 +1,54 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/content_settings/core/browser/brave_shield_rules_index.h"
+
+namespace content_settings {
+
+ShieldRulesIndex::ShieldRulesIndex(const std::vector<Rule>& shield_rules)
+    : shield_rules_(shield_rules) {
+  for (size_t i = 0; i < shield_rules.size(); ++i) {
+    rules_by_host_[shield_rules[i].primary_pattern.GetHost()].push_back(i);
+  }
+}
+
+ShieldRulesIndex::~ShieldRulesIndex() = default;
+
+const Rule* ShieldRulesIndex::FindFirstMatch(
+    const ContentSettingsPattern& pattern) const {
+  size_t first_match = shield_rules_->size();
+  auto find_in_bucket = [&](const std::string& host) {
+    auto it = rules_by_host_.find(host);
+    if (it == rules_by_host_.end()) {
+      return;
+    }
+    for (size_t index : it->second) {
+      if (index >= first_match) {
+        break;
+      }
+      auto compare = (*shield_rules_)[index].primary_pattern.Compare(pattern);
+      if (compare == ContentSettingsPattern::IDENTITY ||
+          compare == ContentSettingsPattern::SUCCESSOR) {
+        first_match = index;
+        break;
+      }
+    }
+  };
+
+  const std::string& host = pattern.GetHost();
+  find_in_bucket(host);
+  for (size_t dot = host.find('.'); dot != std::string::npos;
+       dot = host.find('.', dot + 1)) {
+    find_in_bucket(host.substr(dot + 1));
+  }
+  if (!host.empty()) {
+    find_in_bucket(std::string());
+  }
+
+  return first_match < shield_rules_->size() ? &(*shield_rules_)[first_match]
+                                             : nullptr;
+}
+
+}  // namespace content_settings
@@ -0,0 +1,42 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_SHIELD_RULES_INDEX_H_
+#define BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_SHIELD_RULES_INDEX_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/memory/raw_ref.h"
+#include "components/content_settings/core/browser/content_settings_rule.h"
+#include "components/content_settings/core/common/content_settings_pattern.h"
+
+namespace content_settings {
+
+// Indexes shield rules by the host of their primary pattern, so finding the
+// shield rule for a cookie rule doesn't have to go through all shield rules.
+// A shield pattern can only be identical to or broader than a pattern when
+// its host is the pattern's host, one of its parent domains, or empty.
+class ShieldRulesIndex {
+ public:
+  // |shield_rules| are in precedence order and must outlive the index.
+  explicit ShieldRulesIndex(const std::vector<Rule>& shield_rules);
+  ~ShieldRulesIndex();
+  ShieldRulesIndex(const ShieldRulesIndex&) = delete;
+  ShieldRulesIndex& operator=(const ShieldRulesIndex&) = delete;
+
+  // Returns the first shield rule (in precedence order) whose primary pattern
+  // is identical to or broader than |pattern|.
+  const Rule* FindFirstMatch(const ContentSettingsPattern& pattern) const;
+
+ private:
+  const raw_ref<const std::vector<Rule>> shield_rules_;
+  std::map<std::string, std::vector<size_t>> rules_by_host_;
+};
+
+}  // namespace content_settings
+
+#endif  // BRAVE_COMPONENTS_CONTENT_SETTINGS_CORE_BROWSER_BRAVE_SHIELD_RULES_INDEX_H_
@@ -0,0 +1,127 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/content_settings/core/browser/brave_shield_rules_index.h"
+
+#include <string>
+#include <vector>
+
+#include "base/check.h"
+#include "base/values.h"
+#include "components/content_settings/core/common/content_settings.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace content_settings {
+
+namespace {
+
+ContentSettingsPattern Pattern(const std::string& pattern) {
+  auto result = ContentSettingsPattern::FromString(pattern);
+  CHECK(result.IsValid()) << pattern;
+  return result;
+}
+
+// Shield rules are in precedence order, like the rules the provider gets.
+std::vector<Rule> MakeShieldRules(
+    const std::vector<ContentSettingsPattern>& primary_patterns) {
+  std::vector<Rule> rules;
+  for (const auto& pattern : primary_patterns) {
+    rules.emplace_back(pattern, ContentSettingsPattern::Wildcard(),
+                       base::Value(CONTENT_SETTING_BLOCK), RuleMetaData());
+  }
+  return rules;
+}
+
+}  // namespace
+
+TEST(ShieldRulesIndexTest, NoMatch) {
+  const auto rules = MakeShieldRules(
+      {Pattern("[*.]example.com"), Pattern("[*.]sub.example.org")});
+  ShieldRulesIndex index(rules);
+
+  EXPECT_EQ(index.FindFirstMatch(Pattern("[*.]brave.com")), nullptr);
+  // Narrower shield rules don't apply to a broader pattern.
+  EXPECT_EQ(index.FindFirstMatch(Pattern("[*.]example.org")), nullptr);
+  EXPECT_EQ(index.FindFirstMatch(ContentSettingsPattern::Wildcard()), nullptr);
+}
+
+TEST(ShieldRulesIndexTest, SameHost) {
+  const auto rules = MakeShieldRules(
+      {Pattern("[*.]brave.com"), Pattern("[*.]example.com")});
+  ShieldRulesIndex index(rules);
+
+  EXPECT_EQ(index.FindFirstMatch(Pattern("[*.]example.com")), &rules[1]);
+  EXPECT_EQ(index.FindFirstMatch(Pattern("https://example.com:443")),
+            &rules[1]);
+}
+
+TEST(ShieldRulesIndexTest, ParentDomain) {
+  const auto rules = MakeShieldRules(
+      {Pattern("example.com"), Pattern("[*.]example.com")});
+  ShieldRulesIndex index(rules);
+
+  // Only the rule that covers subdomains applies to them, even though the
+  // other one is in the same bucket and comes first.
+  EXPECT_EQ(index.FindFirstMatch(Pattern("[*.]sub.example.com")), &rules[1]);
+  EXPECT_EQ(index.FindFirstMatch(Pattern("[*.]a.b.sub.example.com")),
+            &rules[1]);
+  EXPECT_EQ(index.FindFirstMatch(Pattern("https://sub.example.com:443")),
+            &rules[1]);
+  // Hosts which only end with the same string are not subdomains.
+  EXPECT_EQ(index.FindFirstMatch(Pattern("[*.]notexample.com")), nullptr);
+}
+
+TEST(ShieldRulesIndexTest, WildcardAndEmptyHost) {
+  const auto rules = MakeShieldRules(
+      {Pattern("[*.]example.com"), Pattern("https://*"),
+       ContentSettingsPattern::Wildcard()});
+  ShieldRulesIndex index(rules);
+
+  EXPECT_EQ(index.FindFirstMatch(Pattern("[*.]example.com")), &rules[0]);
+  // Rules with an empty host apply to every host they are broader than.
+  EXPECT_EQ(index.FindFirstMatch(Pattern("https://brave.com:443")), &rules[1]);
+  EXPECT_EQ(index.FindFirstMatch(Pattern("http://brave.com:80")), &rules[2]);
+  // A wildcard pattern is looked up in the empty host bucket only once.
+  EXPECT_EQ(index.FindFirstMatch(ContentSettingsPattern::Wildcard()),
+            &rules[2]);
+}
+
+TEST(ShieldRulesIndexTest, PrecedenceAcrossBuckets) {
+  const ContentSettingsPattern pattern = Pattern("[*.]a.sub.example.com");
+
+  {
+    // The parent domain rule comes first, so it wins over the more specific
+    // rule in the bucket that is looked up first.
+    const auto rules = MakeShieldRules(
+        {Pattern("[*.]example.com"), Pattern("[*.]a.sub.example.com"),
+         ContentSettingsPattern::Wildcard()});
+    ShieldRulesIndex index(rules);
+    EXPECT_EQ(index.FindFirstMatch(pattern), &rules[0]);
+  }
+  {
+    const auto rules = MakeShieldRules(
+        {Pattern("[*.]a.sub.example.com"), Pattern("[*.]example.com"),
+         ContentSettingsPattern::Wildcard()});
+    ShieldRulesIndex index(rules);
+    EXPECT_EQ(index.FindFirstMatch(pattern), &rules[0]);
+  }
+  {
+    // A wildcard rule with higher precedence wins over every host bucket.
+    const auto rules = MakeShieldRules(
+        {ContentSettingsPattern::Wildcard(), Pattern("[*.]sub.example.com"),
+         Pattern("[*.]a.sub.example.com")});
+    ShieldRulesIndex index(rules);
+    EXPECT_EQ(index.FindFirstMatch(pattern), &rules[0]);
+  }
+  {
+    const auto rules = MakeShieldRules(
+        {Pattern("[*.]brave.com"), Pattern("[*.]sub.example.com"),
+         Pattern("[*.]example.com")});
+    ShieldRulesIndex index(rules);
+    EXPECT_EQ(index.FindFirstMatch(pattern), &rules[1]);
+  }
+}
+
+}  // namespace content_settings
@@ -55,21 +55,17 @@ GURL GetOriginOrURL(const blink::WebFrame* frame) {
   return top_origin.GetURL();
 }
 
-bool IsBraveShieldsDown(const blink::WebFrame* frame,
-                        const GURL& secondary_url,
-                        const ContentSettingsForOneType& rules) {
-  ContentSetting setting = CONTENT_SETTING_DEFAULT;
-  const GURL& primary_url = GetOriginOrURL(frame);
-
+ContentSetting GetContentSettingFromRules(
+    const ContentSettingsForOneType& rules,
+    const GURL& primary_url,
+    const GURL& secondary_url) {
   for (const auto& rule : rules) {
     if (rule.primary_pattern.Matches(primary_url) &&
         rule.secondary_pattern.Matches(secondary_url)) {
-      setting = rule.GetContentSetting();
-      break;
+      return rule.GetContentSetting();
     }
   }
-
-  return setting == CONTENT_SETTING_BLOCK;
+  return CONTENT_SETTING_DEFAULT;
 }
 
 // Skips everything except main frame domain and javascript urls.
@@ -96,6 +92,83 @@ BraveContentSettingsAgentImpl::BraveContentSettingsAgentImpl(
 
 BraveContentSettingsAgentImpl::~BraveContentSettingsAgentImpl() = default;
 
+BraveContentSettingsAgentImpl::FrameSettings::FrameSettings() = default;
+
+BraveContentSettingsAgentImpl::FrameSettings::~FrameSettings() = default;
+
+void BraveContentSettingsAgentImpl::DidCommitProvisionalLoad(
+    ui::PageTransition transition) {
+  ContentSettingsAgentImpl::DidCommitProvisionalLoad(transition);
+  frame_settings_.reset();
+}
+
+void BraveContentSettingsAgentImpl::SendRendererContentSettingRules(
+    const RendererContentSettingRules& renderer_settings) {
+  ContentSettingsAgentImpl::SendRendererContentSettingRules(renderer_settings);
+  frame_settings_.reset();
+}
+
+void BraveContentSettingsAgentImpl::SetRendererContentSettingRulesForTest(
+    const RendererContentSettingRules& rules) {
+  ContentSettingsAgentImpl::SetRendererContentSettingRulesForTest(rules);
+  frame_settings_.reset();
+}
+
+const BraveContentSettingsAgentImpl::FrameSettings&
+BraveContentSettingsAgentImpl::GetFrameSettings() {
+  if (frame_settings_)
+    return *frame_settings_;
+
+  FrameSettings& settings = frame_settings_.emplace();
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  settings.frame_origin_url = url::Origin(frame->GetSecurityOrigin()).GetURL();
+  // Without rules shields are considered down.
+  if (!content_setting_rules_)
+    return settings;
+
+  settings.has_rules = true;
+  const GURL primary_url = GetOriginOrURL(frame);
+  for (const auto& rule : content_setting_rules_->brave_shields_rules) {
+    if (rule.primary_pattern.Matches(primary_url))
+      settings.shields_rules.push_back(rule);
+  }
+  if (!settings.shields_rules.empty() &&
+      settings.shields_rules.front().secondary_pattern ==
+          ContentSettingsPattern::Wildcard()) {
+    settings.shields_down_for_any_url =
+        settings.shields_rules.front().GetContentSetting() ==
+        CONTENT_SETTING_BLOCK;
+  }
+  settings.shields_down =
+      IsBraveShieldsDown(settings, settings.frame_origin_url);
+  settings.shields_down_for_cosmetic_filtering =
+      IsBraveShieldsDown(settings, GURL());
+
+  const auto& cosmetic_rules = content_setting_rules_->cosmetic_filtering_rules;
+  settings.cosmetic_filtering_setting =
+      GetContentSettingFromRules(cosmetic_rules, primary_url, GURL());
+  settings.first_party_cosmetic_filtering_setting = GetContentSettingFromRules(
+      cosmetic_rules, primary_url, GURL("https://firstParty/"));
+  settings.fingerprinting_setting =
+      brave_shields::GetBraveFPContentSettingFromRules(
+          content_setting_rules_->fingerprinting_rules, primary_url);
+  return settings;
+}
+
+bool BraveContentSettingsAgentImpl::IsBraveShieldsDown(
+    const FrameSettings& settings,
+    const GURL& secondary_url) const {
+  if (!settings.has_rules)
+    return true;
+  if (settings.shields_down_for_any_url)
+    return *settings.shields_down_for_any_url;
+  for (const auto& rule : settings.shields_rules) {
+    if (rule.secondary_pattern.Matches(secondary_url))
+      return rule.GetContentSetting() == CONTENT_SETTING_BLOCK;
+  }
+  return false;
+}
+
 bool BraveContentSettingsAgentImpl::IsScriptTemporilyAllowed(
     const GURL& script_url) {
   // Check if scripts from this origin are temporily allowed or not.
@@ -143,10 +216,10 @@ bool BraveContentSettingsAgentImpl::AllowScript(bool enabled_per_settings) {
   // without calling `AllowScriptFromSource` first
   blocked_script_url_ = GURL::EmptyGURL();
 
-  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
-  const GURL secondary_url(url::Origin(frame->GetSecurityOrigin()).GetURL());
+  const FrameSettings& settings = GetFrameSettings();
+  const GURL& secondary_url = settings.frame_origin_url;
   bool allow = ContentSettingsAgentImpl::AllowScript(enabled_per_settings);
-  auto is_shields_down = IsBraveShieldsDown(frame, secondary_url);
+  auto is_shields_down = settings.shields_down;
   auto is_script_temprily_allowed = IsScriptTemporilyAllowed(secondary_url);
   allow = allow || is_shields_down || is_script_temprily_allowed;
   if (!allow) {
@@ -224,14 +297,13 @@ bool BraveContentSettingsAgentImpl::AllowStorageAccessSync(
 bool BraveContentSettingsAgentImpl::AllowScriptFromSource(
     bool enabled_per_settings,
     const blink::WebURL& script_url) {
+  const FrameSettings& settings = GetFrameSettings();
   GURL secondary_url(script_url);
   // For scripts w/o sources it should report the domain / site used for
   // executing the frame (which most, but not all, of the time will just be from
   // document.location
   if (secondary_url.SchemeIsLocal()) {
-    secondary_url =
-        url::Origin(render_frame()->GetWebFrame()->GetSecurityOrigin())
-            .GetURL();
+    secondary_url = settings.frame_origin_url;
   }
   bool allow = ContentSettingsAgentImpl::AllowScriptFromSource(
       enabled_per_settings, script_url);
@@ -241,8 +313,7 @@ bool BraveContentSettingsAgentImpl::AllowScriptFromSource(
   bool should_white_list = IsAllowlistedForContentSettings(
       blink::WebSecurityOrigin::Create(script_url),
       render_frame()->GetWebFrame()->GetDocument().Url());
-  auto is_shields_down =
-      IsBraveShieldsDown(render_frame()->GetWebFrame(), secondary_url);
+  auto is_shields_down = IsBraveShieldsDown(settings, secondary_url);
   auto is_script_temprily_allowed = IsScriptTemporilyAllowed(secondary_url);
   allow = allow || should_white_list || is_shields_down ||
           is_script_temprily_allowed;
@@ -258,71 +329,28 @@ bool BraveContentSettingsAgentImpl::AllowScriptFromSource(
   return allow;
 }
 
-bool BraveContentSettingsAgentImpl::IsBraveShieldsDown(
-    const blink::WebFrame* frame,
-    const GURL& secondary_url) {
-  return !content_setting_rules_ ||
-         ::content_settings::IsBraveShieldsDown(
-             frame, secondary_url, content_setting_rules_->brave_shields_rules);
-}
-
 bool BraveContentSettingsAgentImpl::IsCosmeticFilteringEnabled(
     const GURL& url) {
-  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
-  GURL secondary_url = GURL();
-
-  ContentSetting setting = CONTENT_SETTING_DEFAULT;
-  if (content_setting_rules_) {
-    const GURL& primary_url = GetOriginOrURL(frame);
-
-    for (const auto& rule : content_setting_rules_->cosmetic_filtering_rules) {
-      if (rule.primary_pattern.Matches(primary_url) &&
-          rule.secondary_pattern.Matches(secondary_url)) {
-        setting = rule.GetContentSetting();
-        break;
-      }
-    }
-  }
-
+  const FrameSettings& settings = GetFrameSettings();
   return base::FeatureList::IsEnabled(
              brave_shields::features::kBraveAdblockCosmeticFiltering) &&
-         !IsBraveShieldsDown(frame, secondary_url) &&
-         (setting != CONTENT_SETTING_ALLOW);
+         !settings.shields_down_for_cosmetic_filtering &&
+         (settings.cosmetic_filtering_setting != CONTENT_SETTING_ALLOW);
 }
 
 bool BraveContentSettingsAgentImpl::IsFirstPartyCosmeticFilteringEnabled(
     const GURL& url) {
-  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
-  GURL secondary_url = GURL("https://firstParty/");
-
-  ContentSetting setting = CONTENT_SETTING_DEFAULT;
-  if (content_setting_rules_) {
-    const GURL& primary_url = GetOriginOrURL(frame);
-
-    for (const auto& rule : content_setting_rules_->cosmetic_filtering_rules) {
-      if (rule.primary_pattern.Matches(primary_url) &&
-          rule.secondary_pattern.Matches(secondary_url)) {
-        setting = rule.GetContentSetting();
-        break;
-      }
-    }
-  }
-
-  return setting == CONTENT_SETTING_BLOCK;
+  return GetFrameSettings().first_party_cosmetic_filtering_setting ==
+         CONTENT_SETTING_BLOCK;
 }
 
 BraveFarblingLevel BraveContentSettingsAgentImpl::GetBraveFarblingLevel() {
-  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  const FrameSettings& settings = GetFrameSettings();
 
   ContentSetting setting = CONTENT_SETTING_DEFAULT;
-  if (content_setting_rules_) {
-    if (IsBraveShieldsDown(frame,
-                           url::Origin(frame->GetSecurityOrigin()).GetURL())) {
-      setting = CONTENT_SETTING_ALLOW;
-    } else {
-      setting = brave_shields::GetBraveFPContentSettingFromRules(
-          content_setting_rules_->fingerprinting_rules, GetOriginOrURL(frame));
-    }
+  if (settings.has_rules) {
+    setting = settings.shields_down ? CONTENT_SETTING_ALLOW
+                                    : settings.fingerprinting_setting;
   }
 
   if (setting == CONTENT_SETTING_BLOCK) {
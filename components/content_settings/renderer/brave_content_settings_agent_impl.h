@@ -21,7 +21,8 @@
 #include "mojo/public/cpp/bindings/associated_receiver_set.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
 #include "mojo/public/cpp/bindings/pending_associated_receiver.h"
-
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "ui/base/page_transition_types.h"
 #include "url/gurl.h"
 
 namespace blink {
@@ -47,6 +48,11 @@ class BraveContentSettingsAgentImpl
 
   bool IsFirstPartyCosmeticFilteringEnabled(const GURL& url) override;
 
+  // Hides ContentSettingsAgentImpl's version so that the frame settings
+  // resolved from the previous rules are dropped as well.
+  void SetRendererContentSettingRulesForTest(
+      const RendererContentSettingRules& rules);
+
  protected:
   bool AllowScript(bool enabled_per_settings) override;
   bool AllowScriptFromSource(bool enabled_per_settings,
@@ -69,9 +75,46 @@ class BraveContentSettingsAgentImpl
                            AutoplayBlockedByDefault);
   FRIEND_TEST_ALL_PREFIXES(BraveContentSettingsAgentImplAutoplayBrowserTest,
                            AutoplayAllowedByDefault);
-
-  bool IsBraveShieldsDown(const blink::WebFrame* frame,
-                          const GURL& secondary_url);
+  FRIEND_TEST_ALL_PREFIXES(BraveContentSettingsAgentImplAutoplayBrowserTest,
+                           FrameSettingsFollowRulesSetForTest);
+
+  // Settings of the document committed in this frame, resolved once from
+  // |content_setting_rules_| so that per-script checks don't have to match
+  // every rule again. Dropped on commit and whenever the rules change.
+  struct FrameSettings {
+    FrameSettings();
+    FrameSettings(const FrameSettings&) = delete;
+    FrameSettings& operator=(const FrameSettings&) = delete;
+    ~FrameSettings();
+
+    bool has_rules = false;
+    GURL frame_origin_url;
+    // Shields rules whose primary pattern matches the top frame, in
+    // precedence order. Usually just the site rule and the default one.
+    ContentSettingsForOneType shields_rules;
+    // Set when the first of |shields_rules| matches any secondary URL, so the
+    // shields status is the same for every script loaded in the frame.
+    absl::optional<bool> shields_down_for_any_url;
+    // Shields status for |frame_origin_url|.
+    bool shields_down = true;
+    // Shields status for cosmetic filtering, which has no secondary URL.
+    bool shields_down_for_cosmetic_filtering = true;
+    ContentSetting cosmetic_filtering_setting = CONTENT_SETTING_DEFAULT;
+    ContentSetting first_party_cosmetic_filtering_setting =
+        CONTENT_SETTING_DEFAULT;
+    ContentSetting fingerprinting_setting = CONTENT_SETTING_DEFAULT;
+  };
+
+  // RenderFrameObserver:
+  void DidCommitProvisionalLoad(ui::PageTransition transition) override;
+
+  // mojom::ContentSettingsAgent:
+  void SendRendererContentSettingRules(
+      const RendererContentSettingRules& renderer_settings) override;
+
+  const FrameSettings& GetFrameSettings();
+  bool IsBraveShieldsDown(const FrameSettings& settings,
+                          const GURL& secondary_url) const;
 
   bool IsScriptTemporilyAllowed(const GURL& script_url);
 
@@ -93,6 +136,8 @@ class BraveContentSettingsAgentImpl
   // current load
   base::flat_set<std::string> temporarily_allowed_scripts_;
 
+  absl::optional<FrameSettings> frame_settings_;
+
   // cache blocked script url which will later be used in `DidNotAllowScript()`
   GURL blocked_script_url_;
 
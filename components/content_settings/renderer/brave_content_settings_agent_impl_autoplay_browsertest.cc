@@ -174,4 +174,34 @@ TEST_F(BraveContentSettingsAgentImplAutoplayBrowserTest,
   EXPECT_EQ(ContentSettingsType::AUTOPLAY, agent.on_content_blocked_type());
 }
 
+TEST_F(BraveContentSettingsAgentImplAutoplayBrowserTest,
+       FrameSettingsFollowRulesSetForTest) {
+  LoadHTMLWithUrlOverride("<html>Shields</html>", "https://example.com/");
+
+  // Shields down everywhere.
+  RendererContentSettingRules content_setting_rules;
+  content_setting_rules.brave_shields_rules.push_back(
+      ContentSettingPatternSource(
+          ContentSettingsPattern::Wildcard(),
+          ContentSettingsPattern::Wildcard(),
+          content_settings::ContentSettingToValue(CONTENT_SETTING_BLOCK),
+          std::string(), false));
+
+  MockContentSettingsAgentImpl agent(GetMainRenderFrame());
+  agent.SetRendererContentSettingRulesForTest(content_setting_rules);
+  EXPECT_EQ(BraveFarblingLevel::OFF, agent.GetBraveFarblingLevel());
+
+  // Shields up for the site, the frame settings resolved from the previous
+  // rules must not be used anymore.
+  content_setting_rules.brave_shields_rules.insert(
+      content_setting_rules.brave_shields_rules.begin(),
+      ContentSettingPatternSource(
+          ContentSettingsPattern::FromString("https://example.com"),
+          ContentSettingsPattern::Wildcard(),
+          content_settings::ContentSettingToValue(CONTENT_SETTING_ALLOW),
+          std::string(), false));
+  agent.SetRendererContentSettingRulesForTest(content_setting_rules);
+  EXPECT_NE(BraveFarblingLevel::OFF, agent.GetBraveFarblingLevel());
+}
+
 }  // namespace content_settings
@@ -5,12 +5,10 @@
 
 #include "brave/components/debounce/browser/debounce_component_installer.h"
 
-#include <memory>
 #include <utility>
 
 #include "base/base_paths.h"
 #include "base/command_line.h"
-#include "base/containers/flat_set.h"
 #include "base/functional/bind.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
@@ -51,10 +49,7 @@ void DebounceComponentInstaller::OnDATFileDataReady(
     LOG(WARNING) << parsed_rules.error();
     return;
   }
-  rules_.clear();
-  host_cache_.clear();
-  rules_ = std::move(parsed_rules.value().first);
-  host_cache_ = parsed_rules.value().second;
+  rule_index_ = DebounceRuleIndex(std::move(parsed_rules.value()));
   for (Observer& observer : observers_)
     observer.OnRulesReady(this);
 }
@@ -6,11 +6,8 @@
 #ifndef BRAVE_COMPONENTS_DEBOUNCE_BROWSER_DEBOUNCE_COMPONENT_INSTALLER_H_
 #define BRAVE_COMPONENTS_DEBOUNCE_BROWSER_DEBOUNCE_COMPONENT_INSTALLER_H_
 
-#include <memory>
 #include <string>
-#include <vector>
 
-#include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
 #include "base/json/json_value_converter.h"
 #include "base/memory/weak_ptr.h"
@@ -20,6 +17,7 @@
 #include "base/values.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 #include "brave/components/debounce/browser/debounce_rule.h"
+#include "brave/components/debounce/browser/debounce_rule_index.h"
 #include "brave/components/debounce/browser/debounce_service.h"
 
 namespace debounce {
@@ -41,10 +39,7 @@ class DebounceComponentInstaller
       delete;
   ~DebounceComponentInstaller() override;
 
-  const std::vector<std::unique_ptr<DebounceRule>>& rules() const {
-    return rules_;
-  }
-  const base::flat_set<std::string>& host_cache() const { return host_cache_; }
+  const DebounceRuleIndex& rule_index() const { return rule_index_; }
 
   // implementation of brave_component_updater::LocalDataFilesObserver
   void OnComponentReady(const std::string& component_id,
@@ -70,8 +65,7 @@ class DebounceComponentInstaller
   void LoadDirectlyFromResourcePath();
 
   base::ObserverList<Observer> observers_;
-  std::vector<std::unique_ptr<DebounceRule>> rules_;
-  base::flat_set<std::string> host_cache_;
+  DebounceRuleIndex rule_index_;
   base::FilePath resource_dir_;
 
   base::WeakPtrFactory<DebounceComponentInstaller> weak_factory_{this};
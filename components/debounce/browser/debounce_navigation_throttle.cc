@@ -8,9 +8,8 @@
 #include <memory>
 #include <string>
 #include <utility>
-#include <vector>
 
-#include "base/containers/contains.h"
+#include "base/containers/flat_set.h"
 #include "base/functional/bind.h"
 #include "base/memory/weak_ptr.h"
 #include "base/task/sequenced_task_runner.h"
@@ -50,16 +49,14 @@ class DebounceTabHelper
   DebounceTabHelper(const DebounceTabHelper&) = delete;
   DebounceTabHelper& operator=(const DebounceTabHelper&) = delete;
 
-  void AddToRedirectChain(const GURL& url) { redirects_.push_back(url.host()); }
+  // The hosts debounced to since the last navigation that wasn't a redirect.
+  base::flat_set<std::string>* redirect_chain() { return &redirects_; }
   void ClearRedirectChain() { redirects_.clear(); }
-  bool IsInRedirectChain(const GURL& url) {
-    return base::Contains(redirects_, url.host());
-  }
 
  private:
   friend class content::WebContentsUserData<DebounceTabHelper>;
 
-  std::vector<const std::string> redirects_;
+  base::flat_set<std::string> redirects_;
   WEB_CONTENTS_USER_DATA_KEY_DECL();
 };
 
@@ -125,17 +122,17 @@ DebounceNavigationThrottle::MaybeRedirect() {
   if (!web_contents || !navigation_handle()->IsInMainFrame())
     return NavigationThrottle::PROCEED;
 
+  auto* debounce_helper = DebounceTabHelper::FromWebContents(web_contents);
+  if (!debounce_helper)
+    return NavigationThrottle::PROCEED;
+
   GURL debounced_url;
   GURL original_url = navigation_handle()->GetURL();
 
-  if (!debounce_service_->Debounce(original_url, &debounced_url)) {
-    return NavigationThrottle::PROCEED;
-  }
-
-  auto* debounce_helper = DebounceTabHelper::FromWebContents(web_contents);
-  if (debounce_helper && !debounce_helper->IsInRedirectChain(debounced_url)) {
-    debounce_helper->AddToRedirectChain(debounced_url);
-  } else {
+  // Chained bounces are all followed here, so that only the final URL is
+  // navigated to.
+  if (!debounce_service_->Debounce(original_url, &debounced_url,
+                                   debounce_helper->redirect_chain())) {
     return NavigationThrottle::PROCEED;
   }
 
@@ -128,9 +128,7 @@ bool DebounceRule::IsSameETLDForDebounce(const GURL& url1, const GURL& url2) {
 }
 
 // static
-base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                         base::flat_set<std::string>>,
-               std::string>
+base::expected<std::vector<std::unique_ptr<DebounceRule>>, std::string>
 DebounceRule::ParseRules(const std::string& contents) {
   if (contents.empty()) {
     return base::unexpected("Could not obtain debounce configuration");
@@ -139,25 +137,16 @@ DebounceRule::ParseRules(const std::string& contents) {
   if (!root) {
     return base::unexpected("Failed to parse debounce configuration");
   }
-  std::vector<std::string> hosts;
   std::vector<std::unique_ptr<DebounceRule>> rules;
   base::JSONValueConverter<DebounceRule> converter;
   for (base::Value& it : root->GetList()) {
     std::unique_ptr<DebounceRule> rule = std::make_unique<DebounceRule>();
     if (!converter.Convert(it, rule.get()))
       continue;
-    for (const URLPattern& pattern : rule->include_pattern_set()) {
-      if (!pattern.host().empty()) {
-        const std::string etldp1 =
-            DebounceRule::GetETLDForDebounce(pattern.host());
-        if (!etldp1.empty())
-          hosts.push_back(std::move(etldp1));
-      }
-    }
+    rule->CompileParamRegex();
     rules.push_back(std::move(rule));
   }
-  return std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                   base::flat_set<std::string>>(std::move(rules), hosts);
+  return rules;
 }
 
 bool DebounceRule::CheckPrefForRule(const PrefService* prefs) const {
@@ -177,36 +166,43 @@ bool DebounceRule::CheckPrefForRule(const PrefService* prefs) const {
   return true;
 }
 
-bool DebounceRule::ValidateAndParsePatternRegex(
-    const std::string& pattern,
-    const std::string& path,
-    std::string* parsed_value) const {
-  if (pattern.length() > kMaxLengthRegexPattern) {
+void DebounceRule::CompileParamRegex() {
+  if (action_ != kDebounceRegexPath)
+    return;
+  if (param_.length() > kMaxLengthRegexPattern) {
     VLOG(1) << "Debounce regex pattern exceeds max length: "
             << kMaxLengthRegexPattern;
-    return false;
+    return;
   }
   re2::RE2::Options options;
   options.set_max_mem(kMaxMemoryPerRegexPattern);
-  const re2::RE2 pattern_regex(pattern, options);
+  auto pattern_regex = std::make_unique<re2::RE2>(param_, options);
 
-  if (!pattern_regex.ok()) {
-    VLOG(1) << "Debounce rule has param: " << pattern
+  if (!pattern_regex->ok()) {
+    VLOG(1) << "Debounce rule has param: " << param_
             << " which is an invalid regex pattern";
-    return false;
+    return;
   }
-  if (pattern_regex.NumberOfCapturingGroups() < 1) {
-    VLOG(1) << "Debounce rule has param: " << pattern
+  if (pattern_regex->NumberOfCapturingGroups() < 1) {
+    VLOG(1) << "Debounce rule has param: " << param_
             << " which captures < 1 groups";
-    return false;
+    return;
   }
+  param_regex_ = std::move(pattern_regex);
+}
+
+bool DebounceRule::ParsePathWithRegex(const std::string& path,
+                                      std::string* parsed_value) const {
+  // The pattern was rejected when the rules were loaded.
+  if (!param_regex_)
+    return false;
 
   // Get matching capture groups by applying regex to the path
   size_t number_of_capturing_groups =
-      pattern_regex.NumberOfCapturingGroups() + 1;
+      param_regex_->NumberOfCapturingGroups() + 1;
   std::vector<re2::StringPiece> match_results(number_of_capturing_groups);
 
-  if (!pattern_regex.Match(path, 0, path.size(), RE2::UNANCHORED,
+  if (!param_regex_->Match(path, 0, path.size(), RE2::UNANCHORED,
                            match_results.data(), match_results.size())) {
     VLOG(1) << "Debounce rule with param: " << param_
             << " was unable to capture string";
@@ -258,7 +254,7 @@ bool DebounceRule::Apply(const GURL& original_url,
     // Important: Apply param regex to ONLY the path of original URL.
     auto path = original_url.path();
 
-    if (!ValidateAndParsePatternRegex(param_, path, &unescaped_value)) {
+    if (!ParsePathWithRegex(path, &unescaped_value)) {
       VLOG(1) << "Debounce regex parsing failed";
       return false;
     }
@@ -8,10 +8,8 @@
 
 #include <memory>
 #include <string>
-#include <utility>
 #include <vector>
 
-#include "base/containers/flat_set.h"
 #include "base/json/json_value_converter.h"
 #include "base/strings/escape.h"
 #include "base/types/expected.h"
@@ -21,6 +19,10 @@
 
 class GURL;
 
+namespace re2 {
+class RE2;
+}  // namespace re2
+
 namespace debounce {
 
 enum DebounceAction {
@@ -49,8 +51,7 @@ class DebounceRule {
                                   DebounceAction* field);
   static bool ParsePrependScheme(base::StringPiece value,
                                  DebouncePrependScheme* field);
-  static base::expected<std::pair<std::vector<std::unique_ptr<DebounceRule>>,
-                                  base::flat_set<std::string>>,
+  static base::expected<std::vector<std::unique_ptr<DebounceRule>>,
                         std::string>
   ParseRules(const std::string& contents);
   static const std::string GetETLDForDebounce(const std::string& host);
@@ -67,15 +68,18 @@ class DebounceRule {
 
  private:
   bool CheckPrefForRule(const PrefService* prefs) const;
-  bool ValidateAndParsePatternRegex(const std::string& pattern,
-                                    const std::string& path,
-                                    std::string* parsed_value) const;
+  // Compiles |param_| for regex-path rules, leaving |param_regex_| unset if
+  // it isn't a valid pattern.
+  void CompileParamRegex();
+  bool ParsePathWithRegex(const std::string& path,
+                          std::string* parsed_value) const;
   extensions::URLPatternSet include_pattern_set_;
   extensions::URLPatternSet exclude_pattern_set_;
   DebounceAction action_;
   DebouncePrependScheme prepend_scheme_;
   std::string param_;
   std::string pref_;
+  std::unique_ptr<re2::RE2> param_regex_;
 };
 
 }  // namespace debounce
@@ -0,0 +1,115 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/debounce/browser/debounce_rule_index.h"
+
+#include <iterator>
+#include <map>
+#include <utility>
+
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_util.h"
+#include "extensions/common/url_pattern.h"
+#include "url/gurl.h"
+
+namespace debounce {
+
+namespace {
+
+std::string GetPathPrefix(const std::string& path) {
+  std::string prefix = path.substr(0, path.find('*'));
+  // A pattern path of "/foo/*" also matches "/foo".
+  if (base::EndsWith(prefix, "/"))
+    prefix.pop_back();
+  return prefix;
+}
+
+}  // namespace
+
+DebounceRuleIndex::DebounceRuleIndex() = default;
+
+DebounceRuleIndex::DebounceRuleIndex(
+    std::vector<std::unique_ptr<DebounceRule>> rules)
+    : rules_(std::move(rules)) {
+  std::map<std::string, std::vector<Entry>> buckets;
+  // Patterns without an eTLD+1 of their own, such as "*.co.uk", were never
+  // enough for a URL to be considered. They are tried for any URL that is.
+  std::vector<Entry> unkeyed;
+  for (size_t index = 0; index < rules_.size(); ++index) {
+    for (const URLPattern& pattern : rules_[index]->include_pattern_set()) {
+      Entry entry{index, GetPathPrefix(pattern.path())};
+      const std::string etldp1 =
+          pattern.host().empty()
+              ? std::string()
+              : DebounceRule::GetETLDForDebounce(pattern.host());
+      if (etldp1.empty()) {
+        unkeyed.push_back(std::move(entry));
+      } else {
+        buckets[etldp1].push_back(std::move(entry));
+      }
+    }
+  }
+
+  for (auto& [etldp1, entries] : buckets) {
+    entries.insert(entries.end(), unkeyed.begin(), unkeyed.end());
+    base::ranges::stable_sort(entries, {}, &Entry::rule_index);
+  }
+  buckets_ = base::flat_map<std::string, std::vector<Entry>>(
+      std::make_move_iterator(buckets.begin()),
+      std::make_move_iterator(buckets.end()));
+}
+
+DebounceRuleIndex::DebounceRuleIndex(DebounceRuleIndex&&) = default;
+DebounceRuleIndex& DebounceRuleIndex::operator=(DebounceRuleIndex&&) = default;
+DebounceRuleIndex::~DebounceRuleIndex() = default;
+
+bool DebounceRuleIndex::Apply(const GURL& original_url,
+                              GURL* final_url,
+                              const PrefService* prefs) const {
+  const auto bucket =
+      buckets_.find(DebounceRule::GetETLDForDebounce(original_url.host()));
+  if (bucket == buckets_.end())
+    return false;
+
+  const std::string path = original_url.PathForRequest();
+  size_t last_tried = rules_.size();
+  for (const Entry& entry : bucket->second) {
+    // Entries of the same rule are next to each other.
+    if (entry.rule_index == last_tried ||
+        !base::StartsWith(path, entry.path_prefix)) {
+      continue;
+    }
+    last_tried = entry.rule_index;
+    GURL url;
+    if (rules_[entry.rule_index]->Apply(original_url, &url, prefs) &&
+        url != original_url) {
+      *final_url = std::move(url);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool DebounceRuleIndex::Debounce(
+    const GURL& original_url,
+    GURL* final_url,
+    const PrefService* prefs,
+    base::flat_set<std::string>* visited_hosts) const {
+  GURL url = original_url;
+  for (size_t i = 0; i < kMaxChainLength; ++i) {
+    GURL next_url;
+    if (!Apply(url, &next_url, prefs) ||
+        !visited_hosts->insert(next_url.host()).second) {
+      break;
+    }
+    url = std::move(next_url);
+  }
+  if (url == original_url)
+    return false;
+  *final_url = std::move(url);
+  return true;
+}
+
+}  // namespace debounce
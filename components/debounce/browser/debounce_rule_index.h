@@ -0,0 +1,66 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_DEBOUNCE_BROWSER_DEBOUNCE_RULE_INDEX_H_
+#define BRAVE_COMPONENTS_DEBOUNCE_BROWSER_DEBOUNCE_RULE_INDEX_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
+#include "brave/components/debounce/browser/debounce_rule.h"
+
+class GURL;
+class PrefService;
+
+namespace debounce {
+
+// The debounce rules, indexed by the eTLD+1 of the hosts their include
+// patterns are for and by the literal start of their paths, so that a URL is
+// only tested against the rules that may apply to it.
+class DebounceRuleIndex {
+ public:
+  // Upper bound on the number of bounces followed for a single URL.
+  static constexpr size_t kMaxChainLength = 16;
+
+  DebounceRuleIndex();
+  explicit DebounceRuleIndex(std::vector<std::unique_ptr<DebounceRule>> rules);
+  DebounceRuleIndex(DebounceRuleIndex&&);
+  DebounceRuleIndex& operator=(DebounceRuleIndex&&);
+  ~DebounceRuleIndex();
+
+  bool empty() const { return rules_.empty(); }
+
+  // Applies the first rule, in file order, that debounces |original_url| to a
+  // different URL.
+  bool Apply(const GURL& original_url,
+             GURL* final_url,
+             const PrefService* prefs) const;
+
+  // Follows a chain of bounces from |original_url| to its final destination.
+  // |visited_hosts| holds the hosts already debounced to, and is updated with
+  // each new one; the walk stops before revisiting any of them.
+  bool Debounce(const GURL& original_url,
+                GURL* final_url,
+                const PrefService* prefs,
+                base::flat_set<std::string>* visited_hosts) const;
+
+ private:
+  struct Entry {
+    size_t rule_index;
+    // The path of the include pattern up to its first wildcard.
+    std::string path_prefix;
+  };
+
+  std::vector<std::unique_ptr<DebounceRule>> rules_;
+  // Entries for the rules with a pattern for each eTLD+1, in rule order.
+  base::flat_map<std::string, std::vector<Entry>> buckets_;
+};
+
+}  // namespace debounce
+
+#endif  // BRAVE_COMPONENTS_DEBOUNCE_BROWSER_DEBOUNCE_RULE_INDEX_H_
@@ -6,6 +6,9 @@
 #ifndef BRAVE_COMPONENTS_DEBOUNCE_BROWSER_DEBOUNCE_SERVICE_H_
 #define BRAVE_COMPONENTS_DEBOUNCE_BROWSER_DEBOUNCE_SERVICE_H_
 
+#include <string>
+
+#include "base/containers/flat_set.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "components/keyed_service/core/keyed_service.h"
@@ -25,7 +28,11 @@ class DebounceService : public KeyedService {
   DebounceService(const DebounceService&) = delete;
   DebounceService& operator=(const DebounceService&) = delete;
   ~DebounceService() override;
-  bool Debounce(const GURL& original_url, GURL* final_url) const;
+  // Debounces |original_url| to the end of its chain of bounces. See
+  // DebounceRuleIndex::Debounce() for |visited_hosts|.
+  bool Debounce(const GURL& original_url,
+                GURL* final_url,
+                base::flat_set<std::string>* visited_hosts) const;
   static void RegisterProfilePrefs(PrefRegistrySimple* registry);
   bool IsEnabled();
 
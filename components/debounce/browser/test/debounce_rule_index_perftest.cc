@@ -0,0 +1,90 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_set.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/path_service.h"
+#include "base/strings/string_split.h"
+#include "base/threading/thread_restrictions.h"
+#include "base/time/time.h"
+#include "base/timer/lap_timer.h"
+#include "brave/components/constants/brave_paths.h"
+#include "brave/components/debounce/browser/debounce_rule.h"
+#include "brave/components/debounce/browser/debounce_rule_index.h"
+#include "components/prefs/testing_pref_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
+
+namespace debounce {
+
+namespace {
+
+constexpr char kMetricPrefixDebounce[] = "DebounceRuleIndex.";
+constexpr char kMetricDebounceTime[] = "debounce_time";
+
+constexpr int kWarmupRuns = 5;
+constexpr int kTimeCheckInterval = 10;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixDebounce, story);
+  reporter.RegisterImportantMetric(kMetricDebounceTime, "us");
+  return reporter;
+}
+
+std::string ReadTestData(const std::string& name) {
+  base::ScopedAllowBlockingForTesting allow_blocking;
+  base::FilePath path;
+  base::PathService::Get(brave::DIR_TEST_DATA, &path);
+  std::string contents;
+  EXPECT_TRUE(base::ReadFileToString(path.AppendASCII("debounce-data")
+                                         .AppendASCII("production")
+                                         .AppendASCII(name),
+                                     &contents));
+  return contents;
+}
+
+}  // namespace
+
+// Debounces a corpus of real navigations with the production rules.
+TEST(DebounceRuleIndexPerfTest, DebounceCorpusOfRealURLs) {
+  auto parsed = DebounceRule::ParseRules(ReadTestData("debounce.json"));
+  ASSERT_TRUE(parsed.has_value());
+  const DebounceRuleIndex index(std::move(parsed.value()));
+  TestingPrefServiceSimple prefs;
+
+  std::vector<GURL> urls;
+  for (const auto& spec :
+       base::SplitString(ReadTestData("urls.txt"), "\n",
+                         base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    urls.emplace_back(spec);
+  }
+  ASSERT_FALSE(urls.empty());
+
+  size_t debounced = 0;
+  base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    for (const GURL& url : urls) {
+      base::flat_set<std::string> visited_hosts;
+      GURL final_url;
+      if (index.Debounce(url, &final_url, &prefs, &visited_hosts))
+        ++debounced;
+    }
+    timer.NextLap();
+  } while (!timer.HasTimeLimitExpired());
+  EXPECT_GT(debounced, 0u);
+
+  auto reporter = SetUpReporter("real_urls");
+  reporter.AddResult(kMetricDebounceTime,
+                     timer.TimePerLap() / static_cast<int>(urls.size()));
+}
+
+}  // namespace debounce
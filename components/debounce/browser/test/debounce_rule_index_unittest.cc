@@ -0,0 +1,171 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/debounce/browser/debounce_rule_index.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/contains.h"
+#include "base/containers/flat_set.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/path_service.h"
+#include "base/strings/string_split.h"
+#include "base/threading/thread_restrictions.h"
+#include "brave/components/constants/brave_paths.h"
+#include "brave/components/debounce/browser/debounce_rule.h"
+#include "components/prefs/testing_pref_service.h"
+#include "extensions/common/url_pattern.h"
+#include "net/base/url_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace debounce {
+
+namespace {
+
+const char kChainRules[] = R"json(
+    [{
+        "include": [
+            "*://a.com/?url=*",
+            "*://b.com/?url=*",
+            "*://c.com/?url=*"
+        ],
+        "exclude": [],
+        "action": "redirect",
+        "param": "url"
+    }]
+  )json";
+
+std::string ReadTestData(const std::string& name) {
+  base::ScopedAllowBlockingForTesting allow_blocking;
+  base::FilePath path;
+  base::PathService::Get(brave::DIR_TEST_DATA, &path);
+  std::string contents;
+  EXPECT_TRUE(base::ReadFileToString(path.AppendASCII("debounce-data")
+                                         .AppendASCII("production")
+                                         .AppendASCII(name),
+                                     &contents));
+  return contents;
+}
+
+std::vector<GURL> ReadTestURLs() {
+  std::vector<GURL> urls;
+  for (const auto& spec :
+       base::SplitString(ReadTestData("urls.txt"), "\n",
+                         base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    urls.emplace_back(spec);
+  }
+  return urls;
+}
+
+DebounceRuleIndex CreateIndex(const std::string& contents) {
+  auto parsed = DebounceRule::ParseRules(contents);
+  EXPECT_TRUE(parsed.has_value());
+  return DebounceRuleIndex(std::move(parsed.value()));
+}
+
+// The eTLD+1s of the hosts that |rules| include, which every rule used to be
+// tried for.
+base::flat_set<std::string> GetRuleHosts(
+    const std::vector<std::unique_ptr<DebounceRule>>& rules) {
+  std::vector<std::string> hosts;
+  for (const auto& rule : rules) {
+    for (const URLPattern& pattern : rule->include_pattern_set()) {
+      if (pattern.host().empty())
+        continue;
+      std::string etldp1 = DebounceRule::GetETLDForDebounce(pattern.host());
+      if (!etldp1.empty())
+        hosts.push_back(std::move(etldp1));
+    }
+  }
+  return base::flat_set<std::string>(std::move(hosts));
+}
+
+GURL AddRedirectParam(const std::string& host, const GURL& landing_url) {
+  return net::AppendOrReplaceQueryParameter(GURL("https://" + host + "/"),
+                                            "url", landing_url.spec());
+}
+
+}  // namespace
+
+// The index has to pick the same rule as trying each of them in turn, for
+// URLs on a host the rules are for.
+TEST(DebounceRuleIndexUnitTest, MatchesScanOfProductionRules) {
+  const std::string contents = ReadTestData("debounce.json");
+  auto parsed = DebounceRule::ParseRules(contents);
+  ASSERT_TRUE(parsed.has_value());
+  const auto& rules = parsed.value();
+  const base::flat_set<std::string> hosts = GetRuleHosts(rules);
+  const DebounceRuleIndex index = CreateIndex(contents);
+  TestingPrefServiceSimple prefs;
+
+  const std::vector<GURL> urls = ReadTestURLs();
+  ASSERT_FALSE(urls.empty());
+  size_t debounced = 0;
+  for (const GURL& url : urls) {
+    GURL expected_url;
+    bool expected = false;
+    if (base::Contains(hosts, DebounceRule::GetETLDForDebounce(url.host()))) {
+      for (const auto& rule : rules) {
+        if (rule->Apply(url, &expected_url, &prefs) && expected_url != url) {
+          expected = true;
+          break;
+        }
+      }
+    }
+
+    GURL final_url;
+    EXPECT_EQ(expected, index.Apply(url, &final_url, &prefs)) << url;
+    if (expected) {
+      EXPECT_EQ(expected_url, final_url) << url;
+      ++debounced;
+    }
+  }
+  EXPECT_GT(debounced, 0u);
+}
+
+TEST(DebounceRuleIndexUnitTest, FollowsChain) {
+  const DebounceRuleIndex index = CreateIndex(kChainRules);
+  TestingPrefServiceSimple prefs;
+  const GURL landing_url("https://z.com/");
+  const GURL url = AddRedirectParam(
+      "a.com",
+      AddRedirectParam("b.com", AddRedirectParam("c.com", landing_url)));
+
+  base::flat_set<std::string> visited_hosts;
+  GURL final_url;
+  EXPECT_TRUE(index.Debounce(url, &final_url, &prefs, &visited_hosts));
+  EXPECT_EQ(landing_url, final_url);
+  EXPECT_EQ(base::flat_set<std::string>({"b.com", "c.com", "z.com"}),
+            visited_hosts);
+
+  // Nothing left to debounce.
+  GURL next_url;
+  EXPECT_FALSE(index.Debounce(final_url, &next_url, &prefs, &visited_hosts));
+}
+
+TEST(DebounceRuleIndexUnitTest, StopsBeforeRevisitingHost) {
+  const DebounceRuleIndex index = CreateIndex(kChainRules);
+  TestingPrefServiceSimple prefs;
+  const GURL loop_url = AddRedirectParam(
+      "a.com", AddRedirectParam("b.com", GURL("https://z.com/")));
+  const GURL url =
+      AddRedirectParam("a.com", AddRedirectParam("b.com", loop_url));
+
+  base::flat_set<std::string> visited_hosts;
+  GURL final_url;
+  EXPECT_TRUE(index.Debounce(url, &final_url, &prefs, &visited_hosts));
+  EXPECT_EQ(loop_url, final_url);
+
+  // A later navigation in the same chain doesn't go back to a visited host.
+  GURL next_url;
+  EXPECT_FALSE(index.Debounce(loop_url, &next_url, &prefs, &visited_hosts));
+}
+
+}  // namespace debounce
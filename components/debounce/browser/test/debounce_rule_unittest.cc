@@ -17,7 +17,7 @@ namespace debounce {
 std::vector<std::unique_ptr<DebounceRule>> StringToRules(std::string contents) {
   auto parsed = DebounceRule::ParseRules(contents);
   EXPECT_TRUE(parsed.has_value());
-  return std::move(parsed.value().first);
+  return std::move(parsed.value());
 }
 
 void CheckApplyResult(DebounceRule* rule,
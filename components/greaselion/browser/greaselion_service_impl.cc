@@ -6,8 +6,11 @@
 #include "brave/components/greaselion/browser/greaselion_service_impl.h"
 
 #include <stddef.h>
+#include <algorithm>
 #include <memory>
+#include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -15,16 +18,21 @@
 #include "base/command_line.h"
 #include "base/containers/contains.h"
 #include "base/feature_list.h"
+#include "base/files/file.h"
+#include "base/files/file_enumerator.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback_helpers.h"
 #include "base/json/json_file_value_serializer.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/one_shot_event.h"
 #include "base/ranges/algorithm.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/timer/elapsed_timer.h"
 #include "base/values.h"
 #include "base/version.h"
 #include "brave/components/brave_component_updater/browser/features.h"
@@ -33,6 +41,7 @@
 #include "brave/components/version_info//version_info.h"
 #include "chrome/browser/extensions/extension_service.h"
 #include "components/version_info/version_info.h"
+#include "crypto/secure_hash.h"
 #include "crypto/sha2.h"
 #include "extensions/browser/computed_hashes.h"
 #include "extensions/browser/extension_registry.h"
@@ -52,6 +61,116 @@ namespace {
 
 constexpr char kRunAtDocumentStart[] = "document_start";
 
+// Generated extensions are kept under this directory of the install directory,
+// one subdirectory per hash of everything the extension is generated from.
+constexpr char kExtensionCacheDirName[] = "Cache";
+// Bump this whenever the layout of generated extensions changes, so that
+// previously cached ones get regenerated.
+constexpr char kExtensionCacheVersion[] = "1";
+
+base::FilePath GetExtensionCacheDir(const base::FilePath& install_dir) {
+  return install_dir.AppendASCII(kExtensionCacheDirName);
+}
+
+// Greaselion scripts are not signed, but the public key for an extension
+// doubles as its unique identity, and we need one of those, so we add the
+// rule name to a known Brave domain and hash the result to create a
+// public key.
+std::string GetExtensionPublicKey(const std::string& script_name) {
+  char raw[crypto::kSHA256Length] = {0};
+  std::string key;
+  const base::CommandLine& command_line =
+      *base::CommandLine::ForCurrentProcess();
+  if (!command_line.HasSwitch(brave_component_updater::kUseGoUpdateDev) &&
+      !base::FeatureList::IsEnabled(
+          brave_component_updater::kUseDevUpdaterUrl)) {
+    crypto::SHA256HashString(BUILDFLAG(UPDATER_DEV_ENDPOINT) + script_name, raw,
+                             crypto::kSHA256Length);
+  } else {
+    crypto::SHA256HashString(BUILDFLAG(UPDATER_PROD_ENDPOINT) + script_name,
+                             raw, crypto::kSHA256Length);
+  }
+  base::Base64Encode(base::StringPiece(raw, crypto::kSHA256Length), &key);
+  return key;
+}
+
+// Returns a hash of the rule and of the path, size and modification time of
+// its scripts and messages, or an empty string if any of those files is
+// missing. The files are only stat'ed: they come from the versioned install
+// directory of the Greaselion component, so an update changes their paths.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+std::string ComputeRuleHash(const greaselion::GreaselionRule& rule) {
+  std::unique_ptr<crypto::SecureHash> hash =
+      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
+  // Every field is prefixed by its size so that different rules can't
+  // serialize to the same bytes.
+  auto update = [&hash](base::StringPiece data) {
+    const std::string size = base::NumberToString(data.size()) + ":";
+    hash->Update(size.data(), size.size());
+    hash->Update(data.data(), data.size());
+  };
+  auto update_file = [&update](const base::FilePath& path) {
+    base::File::Info info;
+    if (!base::GetFileInfo(path, &info))
+      return false;
+    update(path.AsUTF8Unsafe());
+    update(base::NumberToString(info.size));
+    update(base::NumberToString(
+        info.last_modified.ToDeltaSinceWindowsEpoch().InMicroseconds()));
+    return true;
+  };
+
+  update(kExtensionCacheVersion);
+  update(rule.name());
+  update(GetExtensionPublicKey(rule.name()));
+  update(rule.run_at());
+  const std::vector<std::string> url_patterns = rule.url_patterns();
+  update(base::NumberToString(url_patterns.size()));
+  for (const auto& url_pattern : url_patterns)
+    update(url_pattern);
+
+  const std::vector<base::FilePath> scripts = rule.scripts();
+  update(base::NumberToString(scripts.size()));
+  for (const auto& script : scripts) {
+    if (!update_file(script))
+      return std::string();
+  }
+
+  const base::FilePath messages = rule.messages();
+  if (!messages.empty()) {
+    std::vector<base::FilePath> files;
+    base::FileEnumerator enumerator(messages, true,
+                                    base::FileEnumerator::FILES);
+    for (base::FilePath path = enumerator.Next(); !path.empty();
+         path = enumerator.Next()) {
+      files.push_back(path);
+    }
+    std::sort(files.begin(), files.end());
+    update(base::NumberToString(files.size()));
+    for (const auto& path : files) {
+      if (!update_file(path))
+        return std::string();
+    }
+  }
+
+  uint8_t digest[crypto::kSHA256Length];
+  hash->Finish(digest, sizeof(digest));
+  return base::HexEncode(digest, sizeof(digest));
+}
+
+scoped_refptr<Extension> LoadGreaselionExtension(
+    const base::FilePath& extension_dir) {
+  std::string error;
+  scoped_refptr<Extension> extension = extensions::file_util::LoadExtension(
+      extension_dir, ManifestLocation::kComponent, Extension::NO_FLAGS, &error);
+  if (!extension.get()) {
+    LOG(ERROR) << "Could not load Greaselion extension";
+    LOG(ERROR) << error;
+  }
+  return extension;
+}
+
 bool ShouldComputeHashesForResource(
     const base::FilePath& relative_resource_path) {
   std::vector<base::FilePath::StringType> components =
@@ -60,25 +179,46 @@ bool ShouldComputeHashesForResource(
 }
 
 // Wraps a Greaselion rule in a component. The component is stored as
-// an unpacked extension in the user data dir. Returns a valid
-// extension that the caller should take ownership of, or nullptr.
+// an unpacked extension in the profile directory, keyed by a hash of the rule
+// and its files, so that an unchanged rule is loaded directly from the
+// previously generated extension. Returns a valid extension, or nullptr.
 //
 // NOTE: This function does file IO and should not be called on the UI thread.
-absl::optional<greaselion::GreaselionServiceImpl::GreaselionConvertedExtension>
-ConvertGreaselionRuleToExtensionOnTaskRunner(
+scoped_refptr<Extension> ConvertGreaselionRuleToExtensionOnTaskRunner(
     const greaselion::GreaselionRule& rule,
     const base::FilePath& install_dir) {
+  const base::ElapsedTimer timer;
+  const std::string rule_hash = ComputeRuleHash(rule);
+  if (rule_hash.empty()) {
+    LOG(ERROR) << "Could not read Greaselion rule files";
+    return nullptr;
+  }
+
+  const base::FilePath extension_dir =
+      GetExtensionCacheDir(install_dir).AppendASCII(rule_hash);
+  if (base::PathExists(extension_dir.Append(extensions::kManifestFilename))) {
+    scoped_refptr<Extension> extension = LoadGreaselionExtension(extension_dir);
+    if (extension) {
+      UMA_HISTOGRAM_BOOLEAN("Brave.Greaselion.ExtensionCacheHit", true);
+      UMA_HISTOGRAM_TIMES("Brave.Greaselion.ExtensionConversionTime",
+                          timer.Elapsed());
+      return extension;
+    }
+  }
+  // Drop whatever is left of a broken cache entry before regenerating it.
+  base::DeletePathRecursively(extension_dir);
+
   base::FilePath install_temp_dir =
       extensions::file_util::GetInstallTempDir(install_dir);
   if (install_temp_dir.empty()) {
     LOG(ERROR) << "Could not get path to profile temp directory";
-    return absl::nullopt;
+    return nullptr;
   }
 
   base::ScopedTempDir temp_dir;
   if (!temp_dir.CreateUniqueTempDirUnderPath(install_temp_dir)) {
     LOG(ERROR) << "Could not create Greaselion temp directory";
-    return absl::nullopt;
+    return nullptr;
   }
 
   // Create the manifest
@@ -89,25 +229,8 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
   root.SetByDottedPath(extensions::manifest_keys::kManifestVersion, 2);
 
   // Create the public key.
-  // Greaselion scripts are not signed, but the public key for an extension
-  // doubles as its unique identity, and we need one of those, so we add the
-  // rule name to a known Brave domain and hash the result to create a
-  // public key.
-  char raw[crypto::kSHA256Length] = {0};
-  std::string key;
   std::string script_name = rule.name();
-  const base::CommandLine& command_line =
-      *base::CommandLine::ForCurrentProcess();
-  if (!command_line.HasSwitch(brave_component_updater::kUseGoUpdateDev) &&
-      !base::FeatureList::IsEnabled(
-          brave_component_updater::kUseDevUpdaterUrl)) {
-    crypto::SHA256HashString(BUILDFLAG(UPDATER_DEV_ENDPOINT) + script_name, raw,
-                             crypto::kSHA256Length);
-  } else {
-    crypto::SHA256HashString(BUILDFLAG(UPDATER_PROD_ENDPOINT) + script_name,
-                             raw, crypto::kSHA256Length);
-  }
-  base::Base64Encode(base::StringPiece(raw, crypto::kSHA256Length), &key);
+  std::string key = GetExtensionPublicKey(script_name);
 
   root.SetByDottedPath(extensions::manifest_keys::kName, script_name);
   root.SetByDottedPath(extensions::manifest_keys::kVersion, "1.0");
@@ -154,7 +277,7 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
   // files to disk.
   if (!serializer.Serialize(base::Value(std::move(root)))) {
     LOG(ERROR) << "Could not write Greaselion manifest";
-    return absl::nullopt;
+    return nullptr;
   }
 
   // Copy the messages directory to our extension directory.
@@ -164,7 +287,7 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
             temp_dir.GetPath().AppendASCII("_locales"), true)) {
       LOG(ERROR) << "Could not copy Greaselion messages directory at path: "
                  << rule.messages().LossyDisplayName();
-      return absl::nullopt;
+      return nullptr;
     }
   }
 
@@ -174,18 +297,25 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
                         temp_dir.GetPath().Append(script.BaseName()))) {
       LOG(ERROR) << "Could not copy Greaselion script at path: "
           << script.LossyDisplayName();
-      return absl::nullopt;
+      return nullptr;
     }
   }
 
-  std::string error;
-  scoped_refptr<Extension> extension = extensions::file_util::LoadExtension(
-      temp_dir.GetPath(), ManifestLocation::kComponent, Extension::NO_FLAGS,
-      &error);
+  // Publish the generated extension in the cache. The temp directory lives
+  // under the install directory as well, so this is a rename.
+  if (!base::CreateDirectory(extension_dir.DirName()) ||
+      !base::Move(temp_dir.GetPath(), extension_dir)) {
+    LOG(ERROR) << "Could not move Greaselion extension to "
+               << extension_dir.LossyDisplayName();
+    return nullptr;
+  }
+  // The temp directory has been moved, there is nothing left to delete.
+  std::ignore = temp_dir.Take();
+
+  scoped_refptr<Extension> extension = LoadGreaselionExtension(extension_dir);
   if (!extension.get()) {
-    LOG(ERROR) << "Could not load Greaselion extension";
-    LOG(ERROR) << error;
-    return absl::nullopt;
+    base::DeletePathRecursively(extension_dir);
+    return nullptr;
   }
 
   // Calculate and write computed hashes.
@@ -201,15 +331,38 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
             extensions::file_util::GetComputedHashesPath(extension->path()));
   }
 
-  // Take ownership of this temporary directory; the service will delete it on
-  // exit
-  return std::make_pair(extension, temp_dir.Take());
+  UMA_HISTOGRAM_BOOLEAN("Brave.Greaselion.ExtensionCacheHit", false);
+  UMA_HISTOGRAM_TIMES("Brave.Greaselion.ExtensionConversionTime",
+                      timer.Elapsed());
+  return extension;
 }
 
-void DeleteExtensionDirs(const std::vector<base::FilePath>& extension_dirs) {
-  for (const auto& extension_dir : extension_dirs) {
-    base::DeletePathRecursively(extension_dir);
+// Deletes cached extensions which don't match any of |rules| anymore, along
+// with anything left in the install temp directory.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+void PruneExtensionCacheOnTaskRunner(
+    const std::vector<greaselion::GreaselionRule>& rules,
+    const base::FilePath& install_dir) {
+  std::set<std::string> rule_hashes;
+  for (const auto& rule : rules) {
+    std::string rule_hash = ComputeRuleHash(rule);
+    if (!rule_hash.empty())
+      rule_hashes.insert(std::move(rule_hash));
   }
+
+  base::FileEnumerator enumerator(GetExtensionCacheDir(install_dir), false,
+                                  base::FileEnumerator::DIRECTORIES);
+  for (base::FilePath path = enumerator.Next(); !path.empty();
+       path = enumerator.Next()) {
+    if (!base::Contains(rule_hashes, path.BaseName().AsUTF8Unsafe()))
+      base::DeletePathRecursively(path);
+  }
+
+  const base::FilePath install_temp_dir =
+      extensions::file_util::GetInstallTempDir(install_dir);
+  if (!install_temp_dir.empty())
+    base::DeletePathRecursively(install_temp_dir);
 }
 
 }  // namespace
@@ -248,8 +401,6 @@ GreaselionServiceImpl::~GreaselionServiceImpl() = default;
 void GreaselionServiceImpl::Shutdown() {
   download_service_->RemoveObserver(this);
   extension_registry_->RemoveObserver(this);
-  task_runner_->PostTask(FROM_HERE,
-                         base::BindOnce(&DeleteExtensionDirs, extension_dirs_));
 }
 
 bool GreaselionServiceImpl::IsGreaselionExtension(const std::string& id) {
@@ -292,17 +443,25 @@ void GreaselionServiceImpl::CreateAndInstallExtensions() {
   DCHECK(update_in_progress_);
   all_rules_installed_successfully_ = true;
   pending_installs_ = 0;
+  install_start_time_ = base::TimeTicks::Now();
+
+  std::vector<std::unique_ptr<GreaselionRule>>* rules =
+      download_service_->rules();
 
   // At this point, any GL extensions that were previously loaded have now been
-  // unloaded. We can now clean up their corresponding temp folders.
-  if (!extension_dirs_.empty()) {
+  // unloaded. If the rules changed, we can now clean up the cached extensions
+  // generated for the previous ones.
+  if (extension_cache_prune_pending_ && !rules->empty()) {
+    extension_cache_prune_pending_ = false;
+    std::vector<GreaselionRule> rules_copy;
+    rules_copy.reserve(rules->size());
+    for (const std::unique_ptr<GreaselionRule>& rule : *rules)
+      rules_copy.push_back(*rule);
     task_runner_->PostTask(
-        FROM_HERE,
-        base::BindOnce(&DeleteExtensionDirs, std::move(extension_dirs_)));
+        FROM_HERE, base::BindOnce(&PruneExtensionCacheOnTaskRunner,
+                                  std::move(rules_copy), install_directory_));
   }
 
-  std::vector<std::unique_ptr<GreaselionRule>>* rules =
-      download_service_->rules();
   for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
     if (rule->Matches(state_, browser_version_) &&
         rule->has_unknown_preconditions() == false) {
@@ -331,19 +490,18 @@ void GreaselionServiceImpl::CreateAndInstallExtensions() {
 }
 
 void GreaselionServiceImpl::PostConvert(
-    absl::optional<GreaselionConvertedExtension> converted_extension) {
-  if (!converted_extension) {
+    scoped_refptr<extensions::Extension> extension) {
+  if (!extension) {
     all_rules_installed_successfully_ = false;
     pending_installs_ -= 1;
     MaybeNotifyObservers();
     LOG(ERROR) << "Could not load Greaselion script";
   } else {
-    greaselion_extensions_.push_back(converted_extension->first->id());
-    extension_dirs_.push_back(converted_extension->second);
+    greaselion_extensions_.push_back(extension->id());
     extension_system_->ready().Post(
-        FROM_HERE, base::BindOnce(&GreaselionServiceImpl::Install,
-                                  weak_factory_.GetWeakPtr(),
-                                  std::move(converted_extension->first)));
+        FROM_HERE,
+        base::BindOnce(&GreaselionServiceImpl::Install,
+                       weak_factory_.GetWeakPtr(), std::move(extension)));
   }
 }
 
@@ -396,6 +554,8 @@ void GreaselionServiceImpl::MaybeNotifyObservers() {
       update_pending_ = false;
       UpdateInstalledExtensions();
     } else {
+      UMA_HISTOGRAM_TIMES("Brave.Greaselion.ExtensionsReadyTime",
+                          base::TimeTicks::Now() - install_start_time_);
       for (auto& observer : observers_)
         observer.OnExtensionsReady(this, all_rules_installed_successfully_);
     }
@@ -404,6 +564,7 @@ void GreaselionServiceImpl::MaybeNotifyObservers() {
 
 void GreaselionServiceImpl::OnRulesReady(
     GreaselionDownloadService* download_service) {
+  extension_cache_prune_pending_ = true;
   for (auto& observer : observers_) {
     observer.OnRulesReady(this);
   }
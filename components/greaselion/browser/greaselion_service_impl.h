@@ -14,11 +14,11 @@
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/task/sequenced_task_runner.h"
+#include "base/time/time.h"
 #include "base/version.h"
 #include "brave/components/greaselion/browser/greaselion_download_service.h"
 #include "brave/components/greaselion/browser/greaselion_service.h"
 #include "extensions/common/extension_id.h"
-#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace base {
 class SequencedTaskRunner;
@@ -66,14 +66,10 @@ class GreaselionServiceImpl : public GreaselionService,
                            const extensions::Extension* extension,
                            extensions::UnloadedExtensionReason reason) override;
 
-  using GreaselionConvertedExtension =
-      std::pair<scoped_refptr<extensions::Extension>, base::FilePath>;
-
  private:
   void SetBrowserVersionForTesting(const base::Version& version) override;
   void CreateAndInstallExtensions();
-  void PostConvert(
-      absl::optional<GreaselionConvertedExtension> converted_extension);
+  void PostConvert(scoped_refptr<extensions::Extension> extension);
   void Install(scoped_refptr<extensions::Extension> extension);
   void MaybeNotifyObservers();
 
@@ -96,7 +92,10 @@ class GreaselionServiceImpl : public GreaselionService,
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   base::ObserverList<GreaselionService::Observer> observers_;
   std::vector<extensions::ExtensionId> greaselion_extensions_;
-  std::vector<base::FilePath> extension_dirs_;
+  // Whether generated extensions for older rules still have to be removed
+  // from the cache since the rules were last updated.
+  bool extension_cache_prune_pending_ = true;
+  base::TimeTicks install_start_time_;
   base::Version browser_version_;
   base::WeakPtrFactory<GreaselionServiceImpl> weak_factory_;
 };
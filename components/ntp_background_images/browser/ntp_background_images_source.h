@@ -9,9 +9,8 @@
 #include <string>
 
 #include "base/memory/raw_ptr.h"
-#include "base/memory/weak_ptr.h"
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
 #include "content/public/browser/url_data_source.h"
-#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace base {
 class FilePath;
@@ -46,12 +45,10 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
 
   void GetImageFile(const base::FilePath& image_file_path,
                     GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback,
-                      absl::optional<std::string> input);
   int GetWallpaperIndexFromPath(const std::string& path) const;
 
   raw_ptr<NTPBackgroundImagesService> service_ = nullptr;  // not owned
-  base::WeakPtrFactory<NTPBackgroundImagesSource> weak_factory_;
+  NTPImageFileCache image_file_cache_;
 };
 
 }  // namespace ntp_background_images
@@ -9,11 +9,7 @@
 #include <vector>
 
 #include "base/files/file_path.h"
-#include "base/files/file_util.h"
-#include "base/functional/bind.h"
-#include "base/memory/ref_counted_memory.h"
 #include "base/strings/stringprintf.h"
-#include "base/task/thread_pool.h"
 #include "brave/components/ntp_background_images/browser/brave_ntp_custom_background_service.h"
 #include "brave/components/ntp_background_images/browser/url_constants.h"
 #include "content/public/browser/browser_task_traits.h"
@@ -21,19 +17,9 @@
 
 namespace ntp_background_images {
 
-namespace {
-
-std::string ReadFileToString(const base::FilePath& path) {
-  std::string contents;
-  base::ReadFileToString(path, &contents);
-  return contents;
-}
-
-}  // namespace
-
 NTPCustomImagesSource::NTPCustomImagesSource(
     BraveNTPCustomBackgroundService* service)
-    : service_(service), weak_factory_(this) {
+    : service_(service) {
   DCHECK(service_);
 }
 
@@ -61,20 +47,7 @@ bool NTPCustomImagesSource::AllowCaching() {
 
 void NTPCustomImagesSource::GetImageFile(const base::FilePath& image_file_path,
                                          GotDataCallback callback) {
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&ReadFileToString, image_file_path),
-      base::BindOnce(&NTPCustomImagesSource::OnGotImageFile,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
-}
-
-void NTPCustomImagesSource::OnGotImageFile(GotDataCallback callback,
-                                           const std::string& input) {
-  scoped_refptr<base::RefCountedMemory> bytes;
-  bytes = new base::RefCountedBytes(
-      reinterpret_cast<const unsigned char*>(input.c_str()), input.length());
-  std::move(callback).Run(std::move(bytes));
-  return;
+  image_file_cache_.GetImage(image_file_path, std::move(callback));
 }
 
 }  // namespace ntp_background_images
@@ -10,7 +10,7 @@
 #include <string>
 
 #include "base/memory/raw_ptr.h"
-#include "base/memory/weak_ptr.h"
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
 #include "content/public/browser/url_data_source.h"
 
 namespace base {
@@ -41,10 +41,9 @@ class NTPCustomImagesSource : public content::URLDataSource {
 
   void GetImageFile(const base::FilePath& image_file_path,
                     GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback, const std::string& input);
 
   raw_ptr<BraveNTPCustomBackgroundService> service_ = nullptr;  // not owned
-  base::WeakPtrFactory<NTPCustomImagesSource> weak_factory_;
+  NTPImageFileCache image_file_cache_;
 };
 
 }  // namespace ntp_background_images
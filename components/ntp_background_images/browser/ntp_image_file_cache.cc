@@ -0,0 +1,83 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
+
+#include <string>
+#include <utility>
+
+#include "base/files/file.h"
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/task/thread_pool.h"
+
+namespace ntp_background_images {
+
+NTPImageFileCache::Entry::Entry() = default;
+NTPImageFileCache::Entry::Entry(const Entry&) = default;
+NTPImageFileCache::Entry& NTPImageFileCache::Entry::operator=(const Entry&) =
+    default;
+NTPImageFileCache::Entry::~Entry() = default;
+
+NTPImageFileCache::NTPImageFileCache() : entries_(kMaxEntries) {}
+
+NTPImageFileCache::~NTPImageFileCache() = default;
+
+void NTPImageFileCache::GetImage(const base::FilePath& path,
+                                 GetImageCallback callback) {
+  Entry cached;
+  if (auto iter = entries_.Get(path); iter != entries_.end()) {
+    cached = iter->second;
+  }
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock()},
+      base::BindOnce(&NTPImageFileCache::ReadImageFile, path,
+                     std::move(cached)),
+      base::BindOnce(&NTPImageFileCache::OnReadImageFile,
+                     weak_factory_.GetWeakPtr(), path, std::move(callback)));
+}
+
+// static
+NTPImageFileCache::Entry NTPImageFileCache::ReadImageFile(
+    const base::FilePath& path,
+    Entry cached) {
+  base::File::Info info;
+  if (!base::GetFileInfo(path, &info) || info.is_directory) {
+    return {};
+  }
+
+  if (cached.bytes && cached.size == info.size &&
+      cached.last_modified == info.last_modified) {
+    return cached;
+  }
+
+  Entry entry;
+  entry.size = info.size;
+  entry.last_modified = info.last_modified;
+  // Big files are read like small ones, they just aren't kept afterwards.
+  // Mapping them instead would fault if a component update truncated the
+  // file while its bytes are being sent.
+  std::string contents;
+  if (base::ReadFileToString(path, &contents)) {
+    entry.bytes =
+        base::MakeRefCounted<base::RefCountedString>(std::move(contents));
+  }
+  return entry;
+}
+
+void NTPImageFileCache::OnReadImageFile(const base::FilePath& path,
+                                        GetImageCallback callback,
+                                        Entry entry) {
+  if (entry.bytes && entry.size <= kMaxCacheableFileSize) {
+    entries_.Put(path, entry);
+  } else if (auto iter = entries_.Peek(path); iter != entries_.end()) {
+    entries_.Erase(iter);
+  }
+
+  std::move(callback).Run(std::move(entry.bytes));
+}
+
+}  // namespace ntp_background_images
@@ -0,0 +1,70 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_FILE_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_FILE_CACHE_H_
+
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+
+namespace ntp_background_images {
+
+// Reads image files for the NTP data sources. The bytes of small files, such
+// as the current wallpapers, are kept in a bounded LRU cache so that opening
+// a new tab doesn't read them from disk again. A cached entry is used only
+// while the file's size and last modified time are unchanged. Files too big
+// to be cached are read on every request.
+class NTPImageFileCache {
+ public:
+  using GetImageCallback =
+      base::OnceCallback<void(scoped_refptr<base::RefCountedMemory>)>;
+
+  static constexpr size_t kMaxEntries = 8;
+  static constexpr int64_t kMaxCacheableFileSize = 4 * 1024 * 1024;
+
+  NTPImageFileCache();
+  ~NTPImageFileCache();
+
+  NTPImageFileCache(const NTPImageFileCache&) = delete;
+  NTPImageFileCache& operator=(const NTPImageFileCache&) = delete;
+
+  // Runs |callback| with the contents of |path|, or nullptr if it can't be
+  // read.
+  void GetImage(const base::FilePath& path, GetImageCallback callback);
+
+  size_t size() const { return entries_.size(); }
+
+ private:
+  struct Entry {
+    Entry();
+    Entry(const Entry&);
+    Entry& operator=(const Entry&);
+    ~Entry();
+
+    int64_t size = 0;
+    base::Time last_modified;
+    scoped_refptr<base::RefCountedMemory> bytes;
+  };
+
+  // Returns |cached| when it's still up to date, or the file read anew.
+  static Entry ReadImageFile(const base::FilePath& path, Entry cached);
+
+  void OnReadImageFile(const base::FilePath& path,
+                       GetImageCallback callback,
+                       Entry entry);
+
+  base::LRUCache<base::FilePath, Entry> entries_;
+
+  base::WeakPtrFactory<NTPImageFileCache> weak_factory_{this};
+};
+
+}  // namespace ntp_background_images
+
+#endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_FILE_CACHE_H_
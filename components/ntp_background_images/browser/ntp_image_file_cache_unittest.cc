@@ -0,0 +1,81 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_file_cache.h"
+
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "base/test/test_future.h"
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_background_images {
+
+class NTPImageFileCacheTest : public testing::Test {
+ public:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+ protected:
+  base::FilePath WriteImage(const std::string& name,
+                            const std::string& contents) {
+    const auto path = temp_dir_.GetPath().AppendASCII(name);
+    EXPECT_TRUE(base::WriteFile(path, contents));
+    EXPECT_TRUE(base::TouchFile(path, kLastModified, kLastModified));
+    return path;
+  }
+
+  std::string GetImage(const base::FilePath& path) {
+    base::test::TestFuture<scoped_refptr<base::RefCountedMemory>> future;
+    cache_.GetImage(path, future.GetCallback());
+    const auto& bytes = future.Get();
+    if (!bytes) {
+      return "<null>";
+    }
+    return std::string(bytes->front_as<char>(), bytes->size());
+  }
+
+  const base::Time kLastModified = base::Time::Now() - base::Days(1);
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  NTPImageFileCache cache_;
+};
+
+TEST_F(NTPImageFileCacheTest, CachesUntilFileChanges) {
+  const auto path = WriteImage("wallpaper.jpg", "image");
+  EXPECT_EQ("image", GetImage(path));
+  EXPECT_EQ(1u, cache_.size());
+
+  // Same size and time, so the cached bytes are still served.
+  WriteImage("wallpaper.jpg", "IMAGE");
+  EXPECT_EQ("image", GetImage(path));
+
+  // A new last modified time invalidates the entry.
+  ASSERT_TRUE(base::TouchFile(path, base::Time::Now(), base::Time::Now()));
+  EXPECT_EQ("IMAGE", GetImage(path));
+
+  ASSERT_TRUE(base::DeleteFile(path));
+  EXPECT_EQ("<null>", GetImage(path));
+  EXPECT_EQ(0u, cache_.size());
+}
+
+TEST_F(NTPImageFileCacheTest, BoundedByEntriesAndFileSize) {
+  for (size_t i = 0; i < NTPImageFileCache::kMaxEntries + 2; ++i) {
+    const std::string name = "wallpaper-" + std::to_string(i) + ".jpg";
+    EXPECT_EQ(name, GetImage(WriteImage(name, name)));
+  }
+  EXPECT_EQ(NTPImageFileCache::kMaxEntries, cache_.size());
+
+  // Big files are served from disk but not kept.
+  const std::string big_image(NTPImageFileCache::kMaxCacheableFileSize + 1,
+                              'x');
+  EXPECT_EQ(big_image, GetImage(WriteImage("big.jpg", big_image)));
+  EXPECT_EQ(NTPImageFileCache::kMaxEntries, cache_.size());
+}
+
+}  // namespace ntp_background_images
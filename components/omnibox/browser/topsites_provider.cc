@@ -9,7 +9,11 @@
 
 #include <algorithm>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/components/omnibox/browser/brave_omnibox_prefs.h"
@@ -17,6 +21,38 @@
 #include "components/omnibox/browser/history_provider.h"
 #include "components/prefs/pref_service.h"
 
+namespace {
+
+struct SiteSuffix {
+  // Points into the top sites list, which is never modified.
+  base::StringPiece suffix;
+  size_t site_index;
+  size_t position;
+};
+
+// Returns every suffix of every site, sorted. The sites containing a given
+// text are the ones with a suffix starting with it, which are all adjacent in
+// this list, so a lookup is a binary search instead of a scan of every site.
+const std::vector<SiteSuffix>& GetSiteSuffixes(
+    const std::vector<std::string>& sites) {
+  static const base::NoDestructor<std::vector<SiteSuffix>> suffixes([&sites] {
+    std::vector<SiteSuffix> suffixes;
+    for (size_t site_index = 0; site_index < sites.size(); ++site_index) {
+      const base::StringPiece site = sites[site_index];
+      for (size_t position = 0; position < site.size(); ++position)
+        suffixes.push_back({site.substr(position), site_index, position});
+    }
+    std::sort(suffixes.begin(), suffixes.end(),
+              [](const SiteSuffix& a, const SiteSuffix& b) {
+                return a.suffix < b.suffix;
+              });
+    return suffixes;
+  }());
+  return *suffixes;
+}
+
+}  // namespace
+
 // As from autocomplete_provider.h:
 // Search Secondary Provider (suggestion)                              |  100++
 const int TopSitesProvider::kRelevance = 100;
@@ -42,15 +78,52 @@ void TopSitesProvider::Start(const AutocompleteInput& input,
   const std::string input_text =
       base::ToLowerASCII(base::UTF16ToUTF8(input.text()));
 
-  for (std::vector<std::string>::const_iterator i = top_sites_.begin();
-       (i != top_sites_.end()) && (matches_.size() < provider_max_matches());
-       ++i) {
-    const std::string &current_site = *i;
-    size_t foundPos = current_site.find(input_text);
-    if (std::string::npos != foundPos) {
-      ACMatchClassifications styles =
-          StylesForSingleMatch(input_text, current_site, foundPos);
-      AddMatch(base::ASCIIToUTF16(current_site), styles);
+  const std::vector<SiteSuffix>& suffixes = GetSiteSuffixes(top_sites_);
+  const auto begin = std::lower_bound(
+      suffixes.begin(), suffixes.end(), input_text,
+      [](const SiteSuffix& entry, const std::string& text) {
+        return entry.suffix < text;
+      });
+  const auto end =
+      std::partition_point(begin, suffixes.end(), [&](const SiteSuffix& entry) {
+        return base::StartsWith(entry.suffix, input_text);
+      });
+  const size_t occurrences_count = static_cast<size_t>(end - begin);
+
+  // Short inputs occur in most sites, so walking the list in order finds
+  // enough matches after a few sites, while collecting and sorting every
+  // occurrence would touch a large part of the index. Rare inputs are cheaper
+  // to resolve through the index. Matches are the same either way.
+  if (occurrences_count * occurrences_count >=
+      provider_max_matches() * suffixes.size()) {
+    for (size_t site_index = 0; (site_index < top_sites_.size()) &&
+                                (matches_.size() < provider_max_matches());
+         ++site_index) {
+      const std::string& current_site = top_sites_[site_index];
+      const size_t foundPos = current_site.find(input_text);
+      if (foundPos == std::string::npos)
+        continue;
+      AddMatch(base::ASCIIToUTF16(current_site),
+               StylesForSingleMatch(input_text, current_site, foundPos));
+    }
+  } else {
+    // Sorting (site index, position) pairs puts sites back in list order,
+    // each with its first occurrence first.
+    std::vector<std::pair<size_t, size_t>> occurrences;
+    occurrences.reserve(occurrences_count);
+    for (auto it = begin; it != end; ++it)
+      occurrences.emplace_back(it->site_index, it->position);
+    std::sort(occurrences.begin(), occurrences.end());
+
+    for (size_t i = 0; (i < occurrences.size()) &&
+                       (matches_.size() < provider_max_matches());
+         ++i) {
+      if (i > 0 && occurrences[i].first == occurrences[i - 1].first)
+        continue;
+      const auto& [site_index, foundPos] = occurrences[i];
+      const std::string& current_site = top_sites_[site_index];
+      AddMatch(base::ASCIIToUTF16(current_site),
+               StylesForSingleMatch(input_text, current_site, foundPos));
     }
   }
 
@@ -27,6 +27,8 @@ class TopSitesProvider : public AutocompleteProvider {
   void Start(const AutocompleteInput& input, bool minimal_changes) override;
 
  private:
+  friend class TopSitesProviderTest;
+
   ~TopSitesProvider() override;
 
   static const int kRelevance;
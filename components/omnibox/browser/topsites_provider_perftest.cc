@@ -0,0 +1,78 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <vector>
+
+#include "base/memory/scoped_refptr.h"
+#include "base/strings/utf_string_conversions.h"
+#include "base/time/time.h"
+#include "base/timer/lap_timer.h"
+#include "brave/components/omnibox/browser/brave_fake_autocomplete_provider_client.h"
+#include "brave/components/omnibox/browser/topsites_provider.h"
+#include "components/omnibox/browser/autocomplete_input.h"
+#include "components/omnibox/browser/test_scheme_classifier.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace {
+
+constexpr char kMetricPrefixTopSitesProvider[] = "TopSitesProvider.";
+constexpr char kMetricKeystrokeTime[] = "keystroke_time";
+
+constexpr int kWarmupRuns = 5;
+constexpr int kTimeCheckInterval = 10;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixTopSitesProvider, story);
+  reporter.RegisterImportantMetric(kMetricKeystrokeTime, "us");
+  return reporter;
+}
+
+}  // namespace
+
+class TopSitesProviderPerfTest : public testing::Test {
+ public:
+  TopSitesProviderPerfTest() : provider_(new TopSitesProvider(&client_)) {}
+
+ protected:
+  // Types out each of |texts| one keystroke at a time.
+  void RunTypingTest(const std::string& story,
+                     const std::vector<std::string>& texts) {
+    std::vector<AutocompleteInput> inputs;
+    for (const auto& text : texts) {
+      for (size_t length = 1; length <= text.size(); ++length) {
+        inputs.emplace_back(base::UTF8ToUTF16(text.substr(0, length)),
+                            metrics::OmniboxEventProto::OTHER, classifier_);
+      }
+    }
+
+    base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+    do {
+      for (const auto& input : inputs)
+        provider_->Start(input, false);
+      timer.NextLap();
+    } while (!timer.HasTimeLimitExpired());
+
+    auto reporter = SetUpReporter(story);
+    reporter.AddResult(kMetricKeystrokeTime,
+                       timer.TimePerLap() / static_cast<int>(inputs.size()));
+  }
+
+  TestSchemeClassifier classifier_;
+  BraveFakeAutocompleteProviderClient client_;
+  scoped_refptr<TopSitesProvider> provider_;
+};
+
+TEST_F(TopSitesProviderPerfTest, TypeRealisticPrefixes) {
+  RunTypingTest("realistic_prefixes",
+                {"youtube.com", "wikipedia.org", "amazon.com", "reddit.com",
+                 "github.com", "mail.google.com"});
+}
+
+TEST_F(TopSitesProviderPerfTest, TypeOneCharacter) {
+  RunTypingTest("one_character", {"a", "e", "o", "x"});
+}
@@ -5,6 +5,9 @@
 
 #include "brave/components/omnibox/browser/topsites_provider.h"
 
+#include <string>
+#include <vector>
+
 #include "base/strings/utf_string_conversions.h"
 #include "brave/components/omnibox/browser/brave_fake_autocomplete_provider_client.h"
 #include "brave/components/omnibox/browser/brave_omnibox_prefs.h"
@@ -29,6 +32,29 @@ class TopSitesProviderTest : public testing::Test {
     return client_.GetPrefs();
   }
 
+  const std::vector<std::string>& top_sites() {
+    return TopSitesProvider::top_sites_;
+  }
+
+  // Sites containing |text|, in the order a scan of the whole list finds them.
+  std::vector<std::u16string> ScanTopSites(const std::string& text) {
+    std::vector<std::u16string> sites;
+    for (const auto& site : top_sites()) {
+      if (sites.size() == provider_->provider_max_matches())
+        break;
+      if (site.find(text) != std::string::npos)
+        sites.push_back(base::UTF8ToUTF16(site));
+    }
+    return sites;
+  }
+
+  std::vector<std::u16string> GetMatchContents() {
+    std::vector<std::u16string> contents;
+    for (const auto& match : provider_->matches())
+      contents.push_back(match.contents);
+    return contents;
+  }
+
  protected:
   TestSchemeClassifier classifier_;
   BraveFakeAutocompleteProviderClient client_;
@@ -56,3 +82,46 @@ TEST_F(TopSitesProviderTest, NoMatchingWhenPrefIsOff) {
   provider_->Start(CreateAutocompleteInput("dex"), false);
   EXPECT_TRUE(provider_->matches().empty());
 }
+
+TEST_F(TopSitesProviderTest, MatchesSitesInListOrder) {
+  for (const auto& site : top_sites()) {
+    // Prefixes of the site, as well as texts from the middle of it.
+    for (size_t start = 0; start < site.size(); start += 3) {
+      for (size_t length = 1; start + length <= site.size(); ++length) {
+        const std::string text = site.substr(start, length);
+        const AutocompleteInput input = CreateAutocompleteInput(text);
+        // The provider doesn't handle search queries.
+        if (input.type() == metrics::OmniboxInputType::QUERY)
+          continue;
+        provider_->Start(input, false);
+        EXPECT_EQ(ScanTopSites(text), GetMatchContents()) << text;
+      }
+    }
+  }
+}
+
+// One character is found in more sites than can be shown, the first ones in
+// the list are kept.
+TEST_F(TopSitesProviderTest, MatchesOneCharacterInListOrder) {
+  for (const char* text : {"a", "e", "o", "x"}) {
+    provider_->Start(CreateAutocompleteInput(text), false);
+    EXPECT_EQ(provider_->provider_max_matches(), provider_->matches().size())
+        << text;
+    EXPECT_EQ(ScanTopSites(text), GetMatchContents()) << text;
+  }
+}
+
+TEST_F(TopSitesProviderTest, TypeRealisticPrefixes) {
+  const std::vector<std::string> kTypedTexts = {
+      "youtube.com", "wikipedia.org", "amazon.com", "reddit.com",
+      "github.com",  "mail.google.com"};
+
+  for (const auto& text : kTypedTexts) {
+    for (size_t length = 1; length <= text.size(); ++length) {
+      const std::string typed_text = text.substr(0, length);
+      provider_->Start(CreateAutocompleteInput(typed_text), false);
+      EXPECT_EQ(ScanTopSites(typed_text), GetMatchContents()) << typed_text;
+    }
+    EXPECT_FALSE(provider_->matches().empty()) << text;
+  }
+}
@@ -58,34 +58,41 @@ void ConstellationHelper::UpdateRandomnessServerInfo() {
   rand_meta_manager_.RequestServerInfo();
 }
 
-bool ConstellationHelper::StartMessagePreparation(std::string histogram_name,
-                                                  std::string serialized_log) {
+bool ConstellationHelper::StartMessagePreparation(
+    base::flat_map<std::string, std::string> serialized_logs) {
   auto* rnd_server_info = rand_meta_manager_.GetCachedRandomnessServerInfo();
   if (rnd_server_info == nullptr) {
     LOG(ERROR) << "ConstellationHelper: measurement preparation failed due to "
                   "unavailable server info";
     return false;
   }
-  std::vector<std::string> layers =
-      base::SplitString(serialized_log, kP3AMessageConstellationLayerSeparator,
-                        base::WhitespaceHandling::TRIM_WHITESPACE,
-                        base::SplitResult::SPLIT_WANT_NONEMPTY);
-
   uint8_t epoch = rnd_server_info->current_epoch;
 
-  auto prepare_res = constellation::prepare_measurement(layers, epoch);
-  if (!prepare_res.error.empty()) {
-    LOG(ERROR) << "ConstellationHelper: measurement preparation failed: "
-               << prepare_res.error.c_str();
-    return false;
+  std::vector<StarRandomnessPoints::Measurement> measurements;
+  measurements.reserve(serialized_logs.size());
+  for (const auto& [histogram_name, serialized_log] : serialized_logs) {
+    std::vector<std::string> layers = base::SplitString(
+        serialized_log, kP3AMessageConstellationLayerSeparator,
+        base::WhitespaceHandling::TRIM_WHITESPACE,
+        base::SplitResult::SPLIT_WANT_NONEMPTY);
+
+    auto prepare_res = constellation::prepare_measurement(layers, epoch);
+    if (!prepare_res.error.empty()) {
+      LOG(ERROR) << "ConstellationHelper: measurement preparation failed: "
+                 << prepare_res.error.c_str();
+      message_callback_.Run(histogram_name, epoch, nullptr);
+      continue;
+    }
+
+    auto req = constellation::construct_randomness_request(*prepare_res.state);
+    measurements.emplace_back(histogram_name, std::move(prepare_res.state),
+                              std::move(req));
   }
 
-  auto req = constellation::construct_randomness_request(*prepare_res.state);
-
-  rand_points_manager_.SendRandomnessRequest(
-      histogram_name, &rand_meta_manager_, rnd_server_info->current_epoch,
-      std::move(prepare_res.state), req);
-
+  if (!measurements.empty()) {
+    rand_points_manager_.SendRandomnessRequest(&rand_meta_manager_, epoch,
+                                               std::move(measurements));
+  }
   return true;
 }
 
@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 
+#include "base/containers/flat_map.h"
 #include "base/functional/callback.h"
 #include "base/memory/ref_counted.h"
 #include "base/strings/string_piece_forward.h"
@@ -51,8 +52,12 @@ class ConstellationHelper {
 
   void UpdateRandomnessServerInfo();
 
-  bool StartMessagePreparation(std::string histogram_name,
-                               std::string serialized_log);
+  // Prepares messages for all |serialized_logs| (keyed by histogram name)
+  // using a single randomness request. |message_callback| is run once for
+  // every histogram, with a null message if preparation failed. Returns false
+  // without running any callbacks if no preparation could be started.
+  bool StartMessagePreparation(
+      base::flat_map<std::string, std::string> serialized_logs);
 
  private:
   void HandleRandomnessData(
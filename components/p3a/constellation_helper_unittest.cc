@@ -5,6 +5,7 @@
 
 #include "brave/components/p3a/constellation_helper.h"
 
+#include <map>
 #include <memory>
 #include <utility>
 
@@ -61,7 +62,7 @@ class P3AConstellationHelperTest : public testing::Test {
           } else if (request.url ==
                      GURL(std::string(kTestHost) + "/randomness")) {
             response = HandleRandomnessRequest(request, kTestEpoch);
-            points_request_made = true;
+            points_requests_made++;
           }
           if (!response.empty()) {
             if (interceptor_send_bad_response) {
@@ -80,6 +81,9 @@ class P3AConstellationHelperTest : public testing::Test {
                    std::unique_ptr<std::string> serialized_message) {
               histogram_name_from_callback = histogram_name;
               epoch_from_callback = epoch;
+              if (serialized_message) {
+                messages_from_callback[histogram_name] = *serialized_message;
+              }
               serialized_message_from_callback = std::move(serialized_message);
             }),
         base::BindLambdaForTesting([this](RandomnessServerInfo* server_info) {
@@ -99,12 +103,13 @@ class P3AConstellationHelperTest : public testing::Test {
 
   raw_ptr<RandomnessServerInfo> server_info_from_callback = nullptr;
   std::unique_ptr<std::string> serialized_message_from_callback;
+  std::map<std::string, std::string> messages_from_callback;
 
   std::string histogram_name_from_callback;
   uint8_t epoch_from_callback;
 
   bool info_request_made = false;
-  bool points_request_made = false;
+  size_t points_requests_made = 0;
 };
 
 TEST_F(P3AConstellationHelperTest, CanRetrieveServerInfo) {
@@ -166,11 +171,12 @@ TEST_F(P3AConstellationHelperTest, GenerateBasicMessage) {
   meta_info.Init(&local_state, "release", "2022-01-01");
 
   helper->StartMessagePreparation(
-      kTestHistogramName, GenerateP3AConstellationMessage(
-                              kTestHistogramName, kTestEpoch, meta_info));
+      {{kTestHistogramName,
+        GenerateP3AConstellationMessage(kTestHistogramName, kTestEpoch,
+                                        meta_info)}});
   task_environment_.RunUntilIdle();
 
-  ASSERT_TRUE(points_request_made);
+  ASSERT_EQ(points_requests_made, 1U);
 
   EXPECT_NE(serialized_message_from_callback, nullptr);
   EXPECT_NE(serialized_message_from_callback->size(), 0U);
@@ -179,4 +185,31 @@ TEST_F(P3AConstellationHelperTest, GenerateBasicMessage) {
   EXPECT_EQ(epoch_from_callback, kTestEpoch);
 }
 
+TEST_F(P3AConstellationHelperTest, GenerateBatchedMessages) {
+  SetUpHelper();
+  helper->UpdateRandomnessServerInfo();
+  task_environment_.RunUntilIdle();
+
+  MessageMetainfo meta_info;
+  meta_info.Init(&local_state, "release", "2022-01-01");
+
+  base::flat_map<std::string, std::string> logs;
+  for (size_t i = 0; i < 5; i++) {
+    std::string histogram_name =
+        std::string(kTestHistogramName) + base::NumberToString(i);
+    logs[histogram_name] =
+        GenerateP3AConstellationMessage(histogram_name, i, meta_info);
+  }
+  ASSERT_TRUE(helper->StartMessagePreparation(logs));
+  task_environment_.RunUntilIdle();
+
+  // All measurements should get their points from one request.
+  EXPECT_EQ(points_requests_made, 1U);
+  ASSERT_EQ(messages_from_callback.size(), logs.size());
+  for (const auto& [histogram_name, message] : messages_from_callback) {
+    EXPECT_TRUE(logs.contains(histogram_name));
+    EXPECT_FALSE(message.empty());
+  }
+}
+
 }  // namespace p3a
@@ -5,6 +5,8 @@
 
 #include "brave/components/p3a/message_manager.h"
 
+#include <utility>
+
 #include "base/functional/bind.h"
 #include "base/json/json_writer.h"
 #include "base/logging.h"
@@ -190,15 +192,19 @@ void MessageManager::OnNewConstellationMessage(
     std::unique_ptr<std::string> serialized_message) {
   VLOG(2) << "MessageManager::OnNewConstellationMessage: has val? "
           << (serialized_message != nullptr);
-  if (!serialized_message) {
-    constellation_prep_scheduler_->UploadFinished(false);
-    return;
+  if (serialized_message) {
+    constellation_send_log_store_->UpdateMessage(histogram_name, epoch,
+                                                 *serialized_message);
+    constellation_prep_log_store_->MarkAsSent(histogram_name);
+    delegate_->OnMetricCycled(histogram_name, true);
+  } else {
+    constellation_batch_failed_ = true;
+  }
+
+  DCHECK_GT(pending_constellation_messages_, 0u);
+  if (--pending_constellation_messages_ == 0) {
+    constellation_prep_scheduler_->UploadFinished(!constellation_batch_failed_);
   }
-  constellation_send_log_store_->UpdateMessage(histogram_name, epoch,
-                                               *serialized_message);
-  constellation_prep_log_store_->DiscardStagedLog();
-  constellation_prep_scheduler_->UploadFinished(true);
-  delegate_->OnMetricCycled(histogram_name, true);
 }
 
 void MessageManager::OnRandomnessServerInfoReady(
@@ -288,16 +294,17 @@ void MessageManager::StartScheduledConstellationPrep() {
                "stage.";
     return;
   }
-  if (!constellation_prep_log_store_->has_staged_log()) {
-    constellation_prep_log_store_->StageNextLog();
-  }
 
-  const std::string log = constellation_prep_log_store_->staged_log();
-  const std::string log_key = constellation_prep_log_store_->staged_log_key();
+  // All pending values share one randomness request.
+  base::flat_map<std::string, std::string> logs =
+      constellation_prep_log_store_->SerializeUnsentLogs();
   VLOG(2) << "MessageManager::StartScheduledConstellationPrep - Requesting "
-             "randomness for histogram: "
-          << log_key;
-  if (!constellation_helper_->StartMessagePreparation(log_key.c_str(), log)) {
+             "randomness for "
+          << logs.size() << " histograms";
+  pending_constellation_messages_ = logs.size();
+  constellation_batch_failed_ = false;
+  if (!constellation_helper_->StartMessagePreparation(std::move(logs))) {
+    pending_constellation_messages_ = 0;
     constellation_upload_scheduler_->UploadFinished(false);
   }
 }
@@ -130,6 +130,9 @@ class MessageManager : public MetricLogStore::Delegate {
   std::unique_ptr<Scheduler> constellation_upload_scheduler_;
 
   std::unique_ptr<ConstellationHelper> constellation_helper_;
+  // Messages of the current preparation batch that are not ready yet.
+  size_t pending_constellation_messages_ = 0;
+  bool constellation_batch_failed_ = false;
 
   std::unique_ptr<RotationScheduler> rotation_scheduler_;
 
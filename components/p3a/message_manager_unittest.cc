@@ -304,7 +304,7 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellation) {
 
   task_environment_.FastForwardBy(base::Seconds(kUploadIntervalSeconds * 100));
 
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   // Should not send metrics, since they are in current epoch
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 0U);
 
@@ -315,7 +315,7 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellation) {
                                   base::Seconds(kUploadIntervalSeconds * 100));
 
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 
   ResetInterceptorStores();
@@ -325,7 +325,7 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellation) {
                                   base::Seconds(kUploadIntervalSeconds * 100));
 
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 }
 
@@ -379,7 +379,7 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellationInvalidResponse) {
   // unavailability. randomness points should be requested for the current
   // epoch. messages from the first epoch should be sent.
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 }
 
@@ -422,7 +422,7 @@ TEST_F(P3AMessageManagerTest,
   // unavailability. randomness points should be requested for the current
   // epoch. messages from the first epoch should be sent.
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 }
 
@@ -464,7 +464,7 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellationUnavailable) {
   // randomness points should be requested for the current epoch.
   // messages from the first epoch should be sent.
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 }
 
@@ -5,6 +5,7 @@
 
 #include "brave/components/p3a/metric_log_store.h"
 
+#include <utility>
 #include <vector>
 
 #include "base/check_op.h"
@@ -28,6 +29,7 @@ constexpr char kConstellationPrepPrefName[] = "p3a.logs_constellation_prep";
 constexpr char kLogValueKey[] = "value";
 constexpr char kLogSentKey[] = "sent";
 constexpr char kLogTimestampKey[] = "timestamp";
+constexpr base::TimeDelta kPendingUpdatesCommitDelay = base::Seconds(5);
 
 void RecordSentAnswersCount(uint64_t answers_count) {
   int answer = 0;
@@ -71,7 +73,9 @@ MetricLogStore::MetricLogStore(Delegate& delegate,
       type_(type),
       is_constellation_(is_constellation) {}
 
-MetricLogStore::~MetricLogStore() = default;
+MetricLogStore::~MetricLogStore() {
+  CommitPendingUpdates();
+}
 
 void MetricLogStore::RegisterPrefs(PrefRegistrySimple* registry) {
   registry->RegisterDictionaryPref(kTypicalJsonLogPrefName);
@@ -112,19 +116,13 @@ void MetricLogStore::UpdateValue(const std::string& histogram_name,
     unsent_entries_.insert(histogram_name);
   }
 
-  // Update the persistent value.
-  ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
-  base::Value::Dict* log_dict = update->EnsureDict(histogram_name);
-  log_dict->Set(kLogValueKey, base::NumberToString(value));
-  log_dict->Set(kLogSentKey, entry.sent);
+  SchedulePendingUpdatesCommit(histogram_name);
 }
 
 void MetricLogStore::RemoveValueIfExists(const std::string& histogram_name) {
   log_.erase(histogram_name);
   unsent_entries_.erase(histogram_name);
-
-  // Update the persistent value.
-  ScopedDictPrefUpdate(&*local_state_, GetPrefName())->Remove(histogram_name);
+  SchedulePendingUpdatesCommit(histogram_name);
 
   if (has_staged_log() && staged_entry_key_ == histogram_name) {
     staged_entry_key_.clear();
@@ -134,7 +132,6 @@ void MetricLogStore::RemoveValueIfExists(const std::string& histogram_name) {
 
 void MetricLogStore::ResetUploadStamps() {
   // Clear log entries flags.
-  ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
   for (auto it = log_.begin(); it != log_.end();) {
     if (it->second.sent) {
       DCHECK(!it->second.sent_timestamp.is_null());
@@ -144,17 +141,13 @@ void MetricLogStore::ResetUploadStamps() {
         // Ephemeral metrics should only be sent once.
         // Remove value from log store so it doesn't get
         // sent again (unless another histogram value is recorded)
-        update->Remove(it->first);
+        SchedulePendingUpdatesCommit(it->first);
         it = log_.erase(it);
         continue;
       }
 
       it->second.ResetSentState();
-
-      // Update persistent values.
-      base::Value::Dict* log_dict = update->EnsureDict(it->first);
-      log_dict->Set(kLogSentKey, it->second.sent);
-      log_dict->Set(kLogTimestampKey, it->second.sent_timestamp.ToDoubleT());
+      SchedulePendingUpdatesCommit(it->first);
     }
     it++;
   }
@@ -171,6 +164,70 @@ void MetricLogStore::ResetUploadStamps() {
   }
 }
 
+base::flat_map<std::string, std::string>
+MetricLogStore::SerializeUnsentLogs() {
+  std::vector<std::pair<std::string, std::string>> logs;
+  logs.reserve(unsent_entries_.size());
+  for (const std::string& histogram_name : unsent_entries_) {
+    logs.emplace_back(histogram_name,
+                      delegate_->SerializeLog(
+                          histogram_name, log_[histogram_name].value, type_,
+                          is_constellation_, GetUploadType(histogram_name)));
+  }
+  return base::flat_map<std::string, std::string>(std::move(logs));
+}
+
+void MetricLogStore::MarkAsSent(const std::string& histogram_name) {
+  auto log_iter = log_.find(histogram_name);
+  if (log_iter == log_.end() || log_iter->second.sent) {
+    // The value was removed or rotated while it was being sent.
+    return;
+  }
+  log_iter->second.MarkAsSent();
+  unsent_entries_.erase(histogram_name);
+  SchedulePendingUpdatesCommit(histogram_name);
+
+  if (staged_entry_key_ == histogram_name) {
+    staged_entry_key_.clear();
+    staged_log_.clear();
+  }
+}
+
+void MetricLogStore::SchedulePendingUpdatesCommit(
+    const std::string& histogram_name) {
+  pending_updates_.insert(histogram_name);
+  if (!commit_timer_.IsRunning()) {
+    commit_timer_.Start(FROM_HERE, kPendingUpdatesCommitDelay, this,
+                        &MetricLogStore::CommitPendingUpdates);
+  }
+}
+
+void MetricLogStore::CommitPendingUpdates() {
+  commit_timer_.Stop();
+  if (pending_updates_.empty()) {
+    return;
+  }
+
+  ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
+  for (const std::string& histogram_name : pending_updates_) {
+    auto log_iter = log_.find(histogram_name);
+    if (log_iter == log_.end()) {
+      update->Remove(histogram_name);
+      continue;
+    }
+    const LogEntry& entry = log_iter->second;
+    base::Value::Dict* log_dict = update->EnsureDict(histogram_name);
+    log_dict->Set(kLogValueKey, base::NumberToString(entry.value));
+    log_dict->Set(kLogSentKey, entry.sent);
+    if (entry.sent_timestamp.is_null()) {
+      log_dict->Remove(kLogTimestampKey);
+    } else {
+      log_dict->Set(kLogTimestampKey, entry.sent_timestamp.ToDoubleT());
+    }
+  }
+  pending_updates_.clear();
+}
+
 bool MetricLogStore::has_unsent_logs() const {
   return !unsent_entries_.empty();
 }
@@ -240,12 +297,7 @@ void MetricLogStore::DiscardStagedLog() {
   auto log_iter = log_.find(staged_entry_key_);
   DCHECK(log_iter != log_.end());
   log_iter->second.MarkAsSent();
-
-  // Update the persistent value.
-  ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
-  base::Value::Dict* log_dict = update->EnsureDict(log_iter->first);
-  log_dict->Set(kLogSentKey, log_iter->second.sent);
-  log_dict->Set(kLogTimestampKey, log_iter->second.sent_timestamp.ToDoubleT());
+  SchedulePendingUpdatesCommit(log_iter->first);
 
   // Erase the entry from the unsent queue.
   auto unsent_entries_iter = unsent_entries_.find(staged_entry_key_);
@@ -13,6 +13,7 @@
 #include "base/memory/raw_ref.h"
 #include "base/strings/string_piece.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "components/metrics/log_store.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -22,7 +23,9 @@ class PrefRegistrySimple;
 
 namespace p3a {
 
-// Stores all given values in memory and persists in prefs on the fly.
+// Stores all given values in memory and persists them in prefs. Changes are
+// buffered and committed in a single pref update shortly after, so a burst of
+// histogram updates results in one pref write.
 // All logs (not only unsent are persistent), and all logs could be loaded
 // using |LoadPersistedUnsentLogs()|. We should fix this at some point since
 // for now persisted entries never expire.
@@ -59,6 +62,15 @@ class MetricLogStore : public metrics::LogStore {
   // Marks all saved values as unsent.
   void ResetUploadStamps();
 
+  // Serializes all unsent values at once, keyed by histogram name, for
+  // callers that send them in a single batch instead of staging them one by
+  // one. The values stay unsent until |MarkAsSent| is called for them.
+  base::flat_map<std::string, std::string> SerializeUnsentLogs();
+  void MarkAsSent(const std::string& histogram_name);
+
+  // Writes buffered changes to prefs right away.
+  void CommitPendingUpdates();
+
   // metrics::LogStore:
   bool has_unsent_logs() const override;
   bool has_staged_log() const override;
@@ -97,6 +109,7 @@ class MetricLogStore : public metrics::LogStore {
   };
 
   const char* GetPrefName() const;
+  void SchedulePendingUpdatesCommit(const std::string& histogram_name);
 
   const raw_ref<Delegate> delegate_;
   const raw_ref<PrefService> local_state_;
@@ -106,6 +119,10 @@ class MetricLogStore : public metrics::LogStore {
   // TODO(iefremov): Try to replace with base::StringPiece?
   base::flat_map<std::string, LogEntry> log_;
   base::flat_set<std::string> unsent_entries_;
+  // Entries changed since the last commit, entries missing from |log_| are
+  // removed from prefs.
+  base::flat_set<std::string> pending_updates_;
+  base::OneShotTimer commit_timer_;
 
   std::string staged_entry_key_;
   std::string staged_log_;
@@ -9,8 +9,11 @@
 #include <set>
 
 #include "base/strings/string_number_conversions.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/metric_names.h"
+#include "components/prefs/pref_change_registrar.h"
 #include "components/prefs/testing_pref_service.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -81,8 +84,10 @@ class P3AMetricLogStoreTest : public testing::Test,
     ASSERT_FALSE(log_store->has_staged_log());
   }
 
-  std::unique_ptr<MetricLogStore> log_store;
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   TestingPrefServiceSimple local_state;
+  std::unique_ptr<MetricLogStore> log_store;
 };
 
 TEST_F(P3AMetricLogStoreTest, GetAllLogs) {
@@ -107,6 +112,31 @@ TEST_F(P3AMetricLogStoreTest, GetAllLogsAfterTimeReset) {
   ConsumeMessages(15);
 }
 
+TEST_F(P3AMetricLogStoreTest, BuffersPrefUpdates) {
+  const std::string histogram_name(*p3a::kCollectedTypicalHistograms.begin());
+  size_t pref_changes = 0;
+  PrefChangeRegistrar registrar;
+  registrar.Init(&local_state);
+  registrar.Add("p3a.logs",
+                base::BindLambdaForTesting([&] { pref_changes++; }));
+
+  for (uint64_t i = 0; i < 50; i++) {
+    log_store->UpdateValue(histogram_name, i);
+  }
+  UpdateSomeValues(10);
+  EXPECT_EQ(pref_changes, 0U);
+  EXPECT_TRUE(local_state.GetDict("p3a.logs").empty());
+
+  task_environment_.FastForwardBy(base::Seconds(5));
+  EXPECT_EQ(pref_changes, 1U);
+  EXPECT_EQ(local_state.GetDict("p3a.logs").size(), 10U);
+
+  log_store->RemoveValueIfExists(histogram_name);
+  log_store->CommitPendingUpdates();
+  EXPECT_EQ(pref_changes, 2U);
+  EXPECT_EQ(local_state.GetDict("p3a.logs").size(), 9U);
+}
+
 TEST_F(P3AMetricLogStoreTest, ShouldNotLoadUnknownMetric) {
   log_store->UpdateValue("Brave.UnknownMetric", 3);
 
@@ -53,6 +53,22 @@ std::unique_ptr<rust::Vec<constellation::VecU8>> DecodeBase64List(
 
 }  // namespace
 
+StarRandomnessPoints::Measurement::Measurement(
+    std::string metric_name,
+    ::rust::Box<constellation::RandomnessRequestStateWrapper>
+        randomness_request_state,
+    rust::Vec<constellation::VecU8> rand_req_points)
+    : metric_name(std::move(metric_name)),
+      randomness_request_state(std::move(randomness_request_state)),
+      rand_req_points(std::move(rand_req_points)) {}
+
+StarRandomnessPoints::Measurement::~Measurement() = default;
+
+StarRandomnessPoints::Measurement::Measurement(Measurement&&) = default;
+
+StarRandomnessPoints::Measurement&
+StarRandomnessPoints::Measurement::operator=(Measurement&&) = default;
+
 StarRandomnessPoints::StarRandomnessPoints(
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
     RandomnessDataCallback data_callback,
@@ -64,12 +80,10 @@ StarRandomnessPoints::StarRandomnessPoints(
 StarRandomnessPoints::~StarRandomnessPoints() = default;
 
 void StarRandomnessPoints::SendRandomnessRequest(
-    std::string metric_name,
     StarRandomnessMeta* randomness_meta,
     uint8_t epoch,
-    rust::Box<constellation::RandomnessRequestStateWrapper>
-        randomness_request_state,
-    const rust::Vec<constellation::VecU8>& rand_req_points) {
+    std::vector<Measurement> measurements) {
+  DCHECK(!measurements.empty());
   auto resource_request = std::make_unique<network::ResourceRequest>();
   resource_request->url = GURL(config_->star_randomness_host + "/randomness");
   resource_request->method = "POST";
@@ -79,8 +93,10 @@ void StarRandomnessPoints::SendRandomnessRequest(
 
   base::Value::Dict payload_dict;
   base::Value::List points_list;
-  for (const auto& point_data : rand_req_points) {
-    points_list.Append(base::Base64Encode(point_data.data));
+  for (const Measurement& measurement : measurements) {
+    for (const auto& point_data : measurement.rand_req_points) {
+      points_list.Append(base::Base64Encode(point_data.data));
+    }
   }
   payload_dict.Set("points", std::move(points_list));
   payload_dict.Set("epoch", epoch);
@@ -89,8 +105,8 @@ void StarRandomnessPoints::SendRandomnessRequest(
   if (!base::JSONWriter::Write(payload_dict, &payload_str)) {
     LOG(ERROR) << "StarRandomnessPoints: failed to serialize "
                   "randomness req payload";
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    url_loader_ = nullptr;
+    RunFailureCallbacks(epoch, std::move(measurements));
     return;
   }
 
@@ -98,20 +114,20 @@ void StarRandomnessPoints::SendRandomnessRequest(
   url_loader_->SetURLLoaderFactoryOptions(
       network::mojom::kURLLoadOptionSendSSLInfoWithResponse);
 
+  const size_t max_response_size =
+      kMaxRandomnessResponseSize * measurements.size();
   url_loader_->DownloadToString(
       url_loader_factory_.get(),
       base::BindOnce(&StarRandomnessPoints::HandleRandomnessResponse,
-                     base::Unretained(this), metric_name, randomness_meta,
-                     epoch, std::move(randomness_request_state)),
-      kMaxRandomnessResponseSize);
+                     base::Unretained(this), randomness_meta, epoch,
+                     std::move(measurements)),
+      max_response_size);
 }
 
 void StarRandomnessPoints::HandleRandomnessResponse(
-    std::string metric_name,
     StarRandomnessMeta* randomness_meta,
     uint8_t epoch,
-    rust::Box<constellation::RandomnessRequestStateWrapper>
-        randomness_request_state,
+    std::vector<Measurement> measurements,
     std::unique_ptr<std::string> response_body) {
   if (!response_body || response_body->empty()) {
     std::string error_str = net::ErrorToShortString(url_loader_->NetError());
@@ -119,14 +135,12 @@ void StarRandomnessPoints::HandleRandomnessResponse(
     LOG(ERROR) << "StarRandomnessPoints: no response body for "
                   "randomness request, "
                << "net error: " << error_str;
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    RunFailureCallbacks(epoch, std::move(measurements));
     return;
   }
   if (!randomness_meta->VerifyRandomnessCert(url_loader_.get())) {
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
     url_loader_ = nullptr;
+    RunFailureCallbacks(epoch, std::move(measurements));
     return;
   }
   url_loader_ = nullptr;
@@ -136,8 +150,7 @@ void StarRandomnessPoints::HandleRandomnessResponse(
     LOG(ERROR) << "StarRandomnessPoints: failed to parse randomness "
                   "response json: "
                << parsed_body.error().message;
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    RunFailureCallbacks(epoch, std::move(measurements));
     return;
   }
   const base::Value* points_value = parsed_body.value().FindListKey("points");
@@ -145,30 +158,65 @@ void StarRandomnessPoints::HandleRandomnessResponse(
   if (points_value == nullptr) {
     LOG(ERROR) << "StarRandomnessPoints: failed to find points list in "
                   "randomness response";
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    RunFailureCallbacks(epoch, std::move(measurements));
     return;
   }
   std::unique_ptr<rust::Vec<constellation::VecU8>> points_vec =
       DecodeBase64List(points_value);
   if (points_vec == nullptr) {
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    RunFailureCallbacks(epoch, std::move(measurements));
     return;
   }
   std::unique_ptr<rust::Vec<constellation::VecU8>> proofs_vec;
   if (proofs_value != nullptr) {
     proofs_vec = DecodeBase64List(proofs_value);
     if (!proofs_vec) {
-      data_callback_.Run(metric_name, epoch,
-                         std::move(randomness_request_state), nullptr, nullptr);
+      RunFailureCallbacks(epoch, std::move(measurements));
       return;
     }
   } else {
     proofs_vec = std::make_unique<rust::Vec<constellation::VecU8>>();
   }
-  data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                     std::move(points_vec), std::move(proofs_vec));
+
+  size_t req_points_count = 0;
+  for (const Measurement& measurement : measurements) {
+    req_points_count += measurement.rand_req_points.size();
+  }
+  if (points_vec->size() != req_points_count ||
+      (!proofs_vec->empty() && proofs_vec->size() != req_points_count)) {
+    LOG(ERROR) << "StarRandomnessPoints: randomness response does not match "
+                  "the request";
+    RunFailureCallbacks(epoch, std::move(measurements));
+    return;
+  }
+
+  // Hand every measurement its own slice of the response.
+  size_t offset = 0;
+  for (Measurement& measurement : measurements) {
+    const size_t count = measurement.rand_req_points.size();
+    auto resp_points = std::make_unique<rust::Vec<constellation::VecU8>>();
+    auto resp_proofs = std::make_unique<rust::Vec<constellation::VecU8>>();
+    for (size_t i = offset; i < offset + count; i++) {
+      resp_points->push_back((*points_vec)[i]);
+      if (!proofs_vec->empty()) {
+        resp_proofs->push_back((*proofs_vec)[i]);
+      }
+    }
+    offset += count;
+    data_callback_.Run(measurement.metric_name, epoch,
+                       std::move(measurement.randomness_request_state),
+                       std::move(resp_points), std::move(resp_proofs));
+  }
+}
+
+void StarRandomnessPoints::RunFailureCallbacks(
+    uint8_t epoch,
+    std::vector<Measurement> measurements) {
+  for (Measurement& measurement : measurements) {
+    data_callback_.Run(measurement.metric_name, epoch,
+                       std::move(measurement.randomness_request_state),
+                       nullptr, nullptr);
+  }
 }
 
 }  // namespace p3a
@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
@@ -26,8 +27,25 @@ struct P3AConfig;
 
 // Handles sending requests/handling responses to/from the randomness
 // server in order to receive randomness point data for STAR measurements.
+// Points of several measurements are sent in a single request, the server
+// answers with the points (and proofs) in the same order.
 class StarRandomnessPoints {
  public:
+  struct Measurement {
+    Measurement(std::string metric_name,
+                ::rust::Box<constellation::RandomnessRequestStateWrapper>
+                    randomness_request_state,
+                rust::Vec<constellation::VecU8> rand_req_points);
+    ~Measurement();
+    Measurement(Measurement&&);
+    Measurement& operator=(Measurement&&);
+
+    std::string metric_name;
+    ::rust::Box<constellation::RandomnessRequestStateWrapper>
+        randomness_request_state;
+    rust::Vec<constellation::VecU8> rand_req_points;
+  };
+
   using RandomnessDataCallback = base::RepeatingCallback<void(
       std::string metric_name,
       uint8_t epoch,
@@ -44,22 +62,18 @@ class StarRandomnessPoints {
   StarRandomnessPoints(const StarRandomnessPoints&) = delete;
   StarRandomnessPoints& operator=(const StarRandomnessPoints&) = delete;
 
-  void SendRandomnessRequest(
-      std::string metric_name,
-      StarRandomnessMeta* randomness_meta,
-      uint8_t epoch,
-      ::rust::Box<constellation::RandomnessRequestStateWrapper>
-          randomness_request_state,
-      const rust::Vec<constellation::VecU8>& rand_req_points);
+  // |data_callback| is run once for every measurement.
+  void SendRandomnessRequest(StarRandomnessMeta* randomness_meta,
+                             uint8_t epoch,
+                             std::vector<Measurement> measurements);
 
  private:
-  void HandleRandomnessResponse(
-      std::string metric_name,
-      StarRandomnessMeta* randomness_meta,
-      uint8_t epoch,
-      ::rust::Box<constellation::RandomnessRequestStateWrapper>
-          randomness_request_state,
-      std::unique_ptr<std::string> response_body);
+  void HandleRandomnessResponse(StarRandomnessMeta* randomness_meta,
+                                uint8_t epoch,
+                                std::vector<Measurement> measurements,
+                                std::unique_ptr<std::string> response_body);
+  void RunFailureCallbacks(uint8_t epoch,
+                           std::vector<Measurement> measurements);
 
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   std::unique_ptr<network::SimpleURLLoader> url_loader_;
@@ -0,0 +1,124 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/playlist/browser/playlist_data_url_loader_factory.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_split.h"
+#include "brave/components/playlist/browser/playlist_service.h"
+#include "content/public/browser/file_url_loader.h"
+#include "net/base/filename_util.h"
+#include "net/base/net_errors.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
+#include "services/network/public/mojom/url_loader.mojom.h"
+#include "url/gurl.h"
+
+namespace playlist {
+
+namespace {
+
+constexpr char kPlaylistDataHost[] = "playlist-data";
+
+// Resolves /<playlist-id>/{thumbnail,media}/ to the cached file.
+bool GetDataFilePath(PlaylistService* service,
+                     const GURL& url,
+                     base::FilePath* data_path) {
+  const std::vector<base::StringPiece> components = base::SplitStringPiece(
+      url.path_piece(), "/", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  if (components.size() != 2u) {
+    VLOG(2) << "path is not in expected form: /id/{thumbnail,media}/ vs "
+            << url.path_piece();
+    return false;
+  }
+
+  const std::string id(components[0]);
+  if (components[1] == "thumbnail")
+    return service->GetThumbnailPath(id, data_path);
+  if (components[1] == "media")
+    return service->GetMediaPath(id, data_path);
+
+  VLOG(2) << "type is neither of {thumbnail,media}/ : " << components[1];
+  return false;
+}
+
+void CompleteWithError(
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    net::Error error) {
+  mojo::Remote<network::mojom::URLLoaderClient>(std::move(client))
+      ->OnComplete(network::URLLoaderCompletionStatus(error));
+}
+
+}  // namespace
+
+// static
+mojo::PendingRemote<network::mojom::URLLoaderFactory>
+PlaylistDataURLLoaderFactory::Create(
+    base::WeakPtr<PlaylistService> service,
+    mojo::PendingRemote<network::mojom::URLLoaderFactory> fallback_factory) {
+  mojo::PendingRemote<network::mojom::URLLoaderFactory> pending_remote;
+
+  // The factory is self-owned - it will delete itself once there are no more
+  // receivers (including the receiver associated with the returned
+  // mojo::PendingRemote and the receivers bound by the Clone method).
+  new PlaylistDataURLLoaderFactory(
+      std::move(service), std::move(fallback_factory),
+      pending_remote.InitWithNewPipeAndPassReceiver());
+
+  return pending_remote;
+}
+
+PlaylistDataURLLoaderFactory::PlaylistDataURLLoaderFactory(
+    base::WeakPtr<PlaylistService> service,
+    mojo::PendingRemote<network::mojom::URLLoaderFactory> fallback_factory,
+    mojo::PendingReceiver<network::mojom::URLLoaderFactory> factory_receiver)
+    : network::SelfDeletingURLLoaderFactory(std::move(factory_receiver)),
+      service_(std::move(service)) {
+  if (fallback_factory)
+    fallback_factory_.Bind(std::move(fallback_factory));
+}
+
+PlaylistDataURLLoaderFactory::~PlaylistDataURLLoaderFactory() = default;
+
+void PlaylistDataURLLoaderFactory::CreateLoaderAndStart(
+    mojo::PendingReceiver<network::mojom::URLLoader> loader,
+    int32_t request_id,
+    uint32_t options,
+    const network::ResourceRequest& request,
+    mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+    const net::MutableNetworkTrafficAnnotationTag& traffic_annotation) {
+  if (request.url.host_piece() != kPlaylistDataHost) {
+    if (!fallback_factory_) {
+      CompleteWithError(std::move(client), net::ERR_INVALID_URL);
+      return;
+    }
+    fallback_factory_->CreateLoaderAndStart(std::move(loader), request_id,
+                                            options, request, std::move(client),
+                                            traffic_annotation);
+    return;
+  }
+
+  base::FilePath data_path;
+  if (!service_ || !GetDataFilePath(service_.get(), request.url, &data_path)) {
+    CompleteWithError(std::move(client), net::ERR_FILE_NOT_FOUND);
+    return;
+  }
+
+  // The file loader streams the file from a blocking sequence and answers
+  // Range requests with only the requested bytes. Files are read rather than
+  // mapped, since media may still be written or removed by its download.
+  network::ResourceRequest file_request(request);
+  file_request.url = net::FilePathToFileURL(data_path);
+  content::CreateFileURLLoaderBypassingSecurityChecks(
+      file_request, std::move(loader), std::move(client),
+      /*observer=*/nullptr, /*allow_directory_listing=*/false);
+}
+
+}  // namespace playlist
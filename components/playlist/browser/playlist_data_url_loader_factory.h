@@ -0,0 +1,60 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_PLAYLIST_BROWSER_PLAYLIST_DATA_URL_LOADER_FACTORY_H_
+#define BRAVE_COMPONENTS_PLAYLIST_BROWSER_PLAYLIST_DATA_URL_LOADER_FACTORY_H_
+
+#include "base/memory/weak_ptr.h"
+#include "mojo/public/cpp/bindings/pending_receiver.h"
+#include "mojo/public/cpp/bindings/pending_remote.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "services/network/public/cpp/self_deleting_url_loader_factory.h"
+#include "services/network/public/mojom/url_loader_factory.mojom.h"
+
+namespace playlist {
+
+class PlaylistService;
+
+// Serves chrome-untrusted://playlist-data/<playlist-id>/{thumbnail,media}/
+// resources by streaming the cached files, like file:// URLs are. Range
+// requests only read the requested bytes, so seeking in a long video doesn't
+// read the whole file into memory. Requests for any other host of the scheme
+// go to the factory this one replaces.
+class PlaylistDataURLLoaderFactory
+    : public network::SelfDeletingURLLoaderFactory {
+ public:
+  // |fallback_factory| may be unbound, in which case other hosts fail.
+  static mojo::PendingRemote<network::mojom::URLLoaderFactory> Create(
+      base::WeakPtr<PlaylistService> service,
+      mojo::PendingRemote<network::mojom::URLLoaderFactory> fallback_factory);
+
+  PlaylistDataURLLoaderFactory(const PlaylistDataURLLoaderFactory&) = delete;
+  PlaylistDataURLLoaderFactory& operator=(const PlaylistDataURLLoaderFactory&) =
+      delete;
+
+ private:
+  PlaylistDataURLLoaderFactory(
+      base::WeakPtr<PlaylistService> service,
+      mojo::PendingRemote<network::mojom::URLLoaderFactory> fallback_factory,
+      mojo::PendingReceiver<network::mojom::URLLoaderFactory> factory_receiver);
+  ~PlaylistDataURLLoaderFactory() override;
+
+  // network::mojom::URLLoaderFactory:
+  void CreateLoaderAndStart(
+      mojo::PendingReceiver<network::mojom::URLLoader> loader,
+      int32_t request_id,
+      uint32_t options,
+      const network::ResourceRequest& request,
+      mojo::PendingRemote<network::mojom::URLLoaderClient> client,
+      const net::MutableNetworkTrafficAnnotationTag& traffic_annotation)
+      override;
+
+  base::WeakPtr<PlaylistService> service_;
+  mojo::Remote<network::mojom::URLLoaderFactory> fallback_factory_;
+};
+
+}  // namespace playlist
+
+#endif  // BRAVE_COMPONENTS_PLAYLIST_BROWSER_PLAYLIST_DATA_URL_LOADER_FACTORY_H_
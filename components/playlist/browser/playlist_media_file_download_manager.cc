@@ -7,8 +7,10 @@
 
 #include <utility>
 
+#include "base/containers/contains.h"
 #include "base/files/file_path.h"
 #include "base/logging.h"
+#include "base/ranges/algorithm.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "brave/components/playlist/browser/playlist_constants.h"
@@ -31,11 +33,8 @@ PlaylistMediaFileDownloadManager::PlaylistMediaFileDownloadManager(
     content::BrowserContext* context,
     Delegate* delegate,
     const base::FilePath& base_dir)
-    : base_dir_(base_dir), delegate_(delegate) {
+    : context_(context), base_dir_(base_dir), delegate_(delegate) {
   DCHECK(delegate_) << "We don't consider where |delegate| is null";
-  // TODO(pilgrim) dynamically set file extensions based on format.
-  media_file_downloader_ = std::make_unique<PlaylistMediaFileDownloader>(
-      this, context, kMediaFileName);
 }
 
 PlaylistMediaFileDownloadManager::~PlaylistMediaFileDownloadManager() = default;
@@ -45,86 +44,130 @@ void PlaylistMediaFileDownloadManager::DownloadMediaFile(
   DCHECK(request);
   DCHECK(request->item);
 
-  pending_media_file_creation_jobs_.push(std::move(request));
+  pending_media_file_creation_jobs_.push_back(std::move(request));
 
-  // If either media file controller is generating a playlist media file,
-  // delay the next playlist generation. It will be triggered when the current
-  // one is finished.
-  if (!IsCurrentDownloadingInProgress())
-    TryStartingDownloadTask();
+  // If all downloaders are busy, the request waits in the queue. It will be
+  // started when one of the current ones is finished.
+  TryStartingDownloadTask();
 }
 
 void PlaylistMediaFileDownloadManager::CancelDownloadRequest(
     const std::string& id) {
   VLOG(2) << __func__ << " " << id;
 
-  // Cancel if currently downloading item is id.
-  // Otherwise, GetNextPlaylistItemTarget() will drop canceled one.
-  if (GetCurrentDownloadingPlaylistItemID() == id) {
-    CancelCurrentDownloadingPlaylistItem();
+  // Cancel if the item is being downloaded.
+  // Otherwise, PopNextJob() will drop canceled one.
+  if (base::Contains(current_jobs_, id)) {
+    CancelDownloadingPlaylistItem(id);
     TryStartingDownloadTask();
     return;
   }
 }
 
 void PlaylistMediaFileDownloadManager::CancelAllDownloadRequests() {
-  CancelCurrentDownloadingPlaylistItem();
-  pending_media_file_creation_jobs_ = {};
+  for (auto& downloader : media_file_downloaders_) {
+    downloader->RequestCancelCurrentPlaylistGeneration();
+  }
+  current_jobs_.clear();
+  pending_media_file_creation_jobs_.clear();
 }
 
 void PlaylistMediaFileDownloadManager::TryStartingDownloadTask() {
-  if (IsCurrentDownloadingInProgress())
-    return;
+  while (current_jobs_.size() < kMaxConcurrentDownloads) {
+    auto job = PopNextJob();
+    if (!job) {
+      return;
+    }
 
-  if (pending_media_file_creation_jobs_.empty())
-    return;
+    DCHECK(job->item);
+    // Pass a copy of the item, as the downloader could notify the result
+    // synchronously and the job is gone by then.
+    auto item = job->item.Clone();
 
-  current_job_ = PopNextJob();
-  if (!current_job_) {
-    return;
-  }
+    if (pause_download_for_testing_) {
+      current_jobs_[item->id] = std::move(job);
+      continue;
+    }
 
-  DCHECK(current_job_->item);
+    auto* downloader = GetIdleDownloader();
+    if (!downloader) {
+      // A downloader that just notified its result hasn't reset itself yet.
+      // The next call will pick this job up.
+      pending_media_file_creation_jobs_.push_front(std::move(job));
+      return;
+    }
 
-  if (!pause_download_for_testing_) {
-    VLOG(2) << __func__ << ": " << current_job_->item->name;
-    media_file_downloader_->DownloadMediaFileForPlaylistItem(current_job_->item,
-                                                             base_dir_);
+    VLOG(2) << __func__ << ": " << item->name;
+    current_jobs_[item->id] = std::move(job);
+    downloader->DownloadMediaFileForPlaylistItem(item, base_dir_);
   }
 }
 
 std::unique_ptr<PlaylistMediaFileDownloadManager::DownloadJob>
 PlaylistMediaFileDownloadManager::PopNextJob() {
-  while (!pending_media_file_creation_jobs_.empty()) {
-    auto request = std::move(pending_media_file_creation_jobs_.front());
-    DCHECK(request);
-    DCHECK(request->item);
-
-    pending_media_file_creation_jobs_.pop();
+  auto iter = pending_media_file_creation_jobs_.begin();
+  while (iter != pending_media_file_creation_jobs_.end()) {
+    DCHECK(*iter);
+    const auto& item = (*iter)->item;
+    DCHECK(item);
+
+    if (!delegate_->IsValidPlaylistItem(item->id)) {
+      iter = pending_media_file_creation_jobs_.erase(iter);
+      continue;
+    }
 
-    if (delegate_->IsValidPlaylistItem(request->item->id)) {
-      return request;
+    // Skip jobs whose host is saturated, or whose item is already being
+    // downloaded, without losing their place in the queue.
+    if (base::Contains(current_jobs_, item->id) ||
+        GetDownloadCountForHost(item->media_source.host()) >=
+            kMaxConcurrentDownloadsPerHost) {
+      ++iter;
+      continue;
     }
+
+    auto request = std::move(*iter);
+    pending_media_file_creation_jobs_.erase(iter);
+    return request;
   }
 
   return {};
 }
 
-std::string
-PlaylistMediaFileDownloadManager::GetCurrentDownloadingPlaylistItemID() const {
-  if (IsCurrentDownloadingInProgress())
-    return media_file_downloader_->current_playlist_id();
-
-  return {};
+size_t PlaylistMediaFileDownloadManager::GetDownloadCountForHost(
+    const std::string& host) const {
+  return base::ranges::count_if(current_jobs_, [&host](const auto& pair) {
+    const auto& item = pair.second->item;
+    return item && item->media_source.host_piece() == host;
+  });
 }
 
-void PlaylistMediaFileDownloadManager::CancelCurrentDownloadingPlaylistItem() {
-  media_file_downloader_->RequestCancelCurrentPlaylistGeneration();
-  current_job_.reset();
+PlaylistMediaFileDownloader*
+PlaylistMediaFileDownloadManager::GetIdleDownloader() {
+  for (auto& downloader : media_file_downloaders_) {
+    if (!downloader->in_progress()) {
+      return downloader.get();
+    }
+  }
+
+  if (media_file_downloaders_.size() >= kMaxConcurrentDownloads) {
+    return nullptr;
+  }
+
+  // TODO(pilgrim) dynamically set file extensions based on format.
+  media_file_downloaders_.push_back(
+      std::make_unique<PlaylistMediaFileDownloader>(this, context_,
+                                                    kMediaFileName));
+  return media_file_downloaders_.back().get();
 }
 
-bool PlaylistMediaFileDownloadManager::IsCurrentDownloadingInProgress() const {
-  return media_file_downloader_->in_progress();
+void PlaylistMediaFileDownloadManager::CancelDownloadingPlaylistItem(
+    const std::string& id) {
+  for (auto& downloader : media_file_downloaders_) {
+    if (downloader->in_progress() && downloader->current_playlist_id() == id) {
+      downloader->RequestCancelCurrentPlaylistGeneration();
+    }
+  }
+  current_jobs_.erase(id);
 }
 
 void PlaylistMediaFileDownloadManager::OnMediaFileDownloadProgressed(
@@ -133,18 +176,15 @@ void PlaylistMediaFileDownloadManager::OnMediaFileDownloadProgressed(
     int64_t received_bytes,
     int percent_complete,
     base::TimeDelta time_remaining) {
-  if (!current_job_ || !current_job_->item) {
-    return;
-  }
-
-  if (current_job_->item->id != id) {
+  auto iter = current_jobs_.find(id);
+  if (iter == current_jobs_.end() || !iter->second->item) {
     return;
   }
 
-  if (current_job_->on_progress_callback) {
-    current_job_->on_progress_callback.Run(current_job_->item, total_bytes,
-                                           received_bytes, percent_complete,
-                                           time_remaining);
+  const auto& job = iter->second;
+  if (job->on_progress_callback) {
+    job->on_progress_callback.Run(job->item, total_bytes, received_bytes,
+                                  percent_complete, time_remaining);
   }
 }
 
@@ -152,43 +192,30 @@ void PlaylistMediaFileDownloadManager::OnMediaFileReady(
     const std::string& id,
     const std::string& media_file_path) {
   VLOG(2) << __func__ << ": " << id << " is ready.";
-  if (!current_job_ || !current_job_->item) {
-    return;
-  }
-
-  if (current_job_->item->id != id) {
-    return;
-  }
-
-  if (current_job_->on_finish_callback) {
-    std::move(current_job_->on_finish_callback)
-        .Run(std::move(current_job_->item), media_file_path);
-  }
-  current_job_.reset();
-
-  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE,
-      base::BindOnce(&PlaylistMediaFileDownloadManager::TryStartingDownloadTask,
-                     weak_factory_.GetWeakPtr()));
+  OnDownloadJobFinished(id, media_file_path);
 }
 
 void PlaylistMediaFileDownloadManager::OnMediaFileGenerationFailed(
     const std::string& id) {
   VLOG(2) << __func__ << ": " << id;
-  if (!current_job_ || !current_job_->item) {
-    return;
-  }
+  OnDownloadJobFinished(id, {});
+}
 
-  if (current_job_->item && current_job_->item->id != id) {
+void PlaylistMediaFileDownloadManager::OnDownloadJobFinished(
+    const std::string& id,
+    const std::string& media_file_path) {
+  auto iter = current_jobs_.find(id);
+  if (iter == current_jobs_.end() || !iter->second->item) {
     return;
   }
 
-  if (current_job_->on_finish_callback) {
-    std::move(current_job_->on_finish_callback)
-        .Run(std::move(current_job_->item), {});
+  auto job = std::move(iter->second);
+  current_jobs_.erase(iter);
+
+  if (job->on_finish_callback) {
+    std::move(job->on_finish_callback)
+        .Run(std::move(job->item), media_file_path);
   }
-  current_job_.reset();
-  CancelCurrentDownloadingPlaylistItem();
 
   base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
       FROM_HERE,
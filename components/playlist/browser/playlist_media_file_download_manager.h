@@ -8,8 +8,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
-#include "base/containers/queue.h"
+#include "base/containers/circular_deque.h"
+#include "base/containers/flat_map.h"
 #include "brave/components/playlist/browser/playlist_media_file_downloader.h"
 #include "brave/components/playlist/common/mojom/playlist.mojom.h"
 
@@ -20,9 +22,9 @@ class BrowserContext;
 namespace playlist {
 
 // Download youtube playlist item's audio/video media files.
-// This handles one request at once. So, it has pending queue.
-// And PlaylistMediaFileDownloader does file download task.
-// TODO(simonhong): Download multiple media files simultaneously.
+// Up to kMaxConcurrentDownloads requests run at once, each on its own
+// PlaylistMediaFileDownloader, and at most kMaxConcurrentDownloadsPerHost of
+// them hit the same host. Others wait in the pending queue.
 class PlaylistMediaFileDownloadManager
     : public PlaylistMediaFileDownloader::Delegate {
  public:
@@ -62,6 +64,9 @@ class PlaylistMediaFileDownloadManager
   static constexpr base::FilePath::CharType kMediaFileName[] =
       FILE_PATH_LITERAL("media_file.mp4");
 
+  static constexpr size_t kMaxConcurrentDownloads = 3;
+  static constexpr size_t kMaxConcurrentDownloadsPerHost = 2;
+
   PlaylistMediaFileDownloadManager(content::BrowserContext* context,
                                    Delegate* delegate,
                                    const base::FilePath& base_dir);
@@ -76,10 +81,12 @@ class PlaylistMediaFileDownloadManager
   void CancelDownloadRequest(const std::string& id);
   void CancelAllDownloadRequests();
 
-  bool has_download_requests() const { return !!current_job_; }
+  bool has_download_requests() const { return !current_jobs_.empty(); }
 
  private:
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, ResetAll);
+  FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest,
+                           MediaDownloadsAreLimitedPerHost);
 
   // PlaylistMediaFileDownloader::Delegate overrides:
   void OnMediaFileDownloadProgressed(const std::string& id,
@@ -93,17 +100,24 @@ class PlaylistMediaFileDownloadManager
 
   void TryStartingDownloadTask();
   std::unique_ptr<DownloadJob> PopNextJob();
-  std::string GetCurrentDownloadingPlaylistItemID() const;
-  void CancelCurrentDownloadingPlaylistItem();
-  bool IsCurrentDownloadingInProgress() const;
+  size_t GetDownloadCountForHost(const std::string& host) const;
+  PlaylistMediaFileDownloader* GetIdleDownloader();
+  void CancelDownloadingPlaylistItem(const std::string& id);
+  void OnDownloadJobFinished(const std::string& id,
+                             const std::string& media_file_path);
 
+  const raw_ptr<content::BrowserContext> context_;
   const base::FilePath base_dir_;
   raw_ptr<Delegate> delegate_;
-  base::queue<std::unique_ptr<DownloadJob>> pending_media_file_creation_jobs_;
+  base::circular_deque<std::unique_ptr<DownloadJob>>
+      pending_media_file_creation_jobs_;
 
-  std::unique_ptr<DownloadJob> current_job_;
+  // Jobs being downloaded, keyed by item id.
+  base::flat_map<std::string, std::unique_ptr<DownloadJob>> current_jobs_;
 
-  std::unique_ptr<PlaylistMediaFileDownloader> media_file_downloader_;
+  // Created on demand, up to kMaxConcurrentDownloads.
+  std::vector<std::unique_ptr<PlaylistMediaFileDownloader>>
+      media_file_downloaders_;
 
   bool pause_download_for_testing_ = false;
 
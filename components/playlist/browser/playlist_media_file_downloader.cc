@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/containers/contains.h"
 #include "base/files/file.h"
 #include "base/files/file_util.h"
 #include "base/functional/bind.h"
@@ -49,8 +50,95 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTagForURLLoad() {
       })");
 }
 
+constexpr base::FilePath::CharType kResumeInfoFileExtension[] =
+    FILE_PATH_LITERAL(".resume");
+constexpr char kResumeInfoETagKey[] = "etag";
+constexpr char kResumeInfoLastModifiedKey[] = "lastModified";
+
+base::FilePath GetResumeInfoPath(const base::FilePath& media_file_path) {
+  return media_file_path.AddExtension(kResumeInfoFileExtension);
+}
+
+void WriteResumeInfo(const base::FilePath& media_file_path,
+                     const std::string& etag,
+                     const std::string& last_modified) {
+  base::Value::Dict resume_info;
+  resume_info.Set(kResumeInfoETagKey, etag);
+  resume_info.Set(kResumeInfoLastModifiedKey, last_modified);
+
+  std::string json;
+  if (!base::JSONWriter::Write(resume_info, &json) ||
+      !base::WriteFile(GetResumeInfoPath(media_file_path), json)) {
+    // A partial file can't be resumed safely without its validators.
+    base::DeleteFile(media_file_path);
+  }
+}
+
+// Interruptions after which the bytes received so far are still valid.
+bool CanResumeAfter(download::DownloadInterruptReason reason) {
+  switch (reason) {
+    case download::DOWNLOAD_INTERRUPT_REASON_NETWORK_FAILED:
+    case download::DOWNLOAD_INTERRUPT_REASON_NETWORK_TIMEOUT:
+    case download::DOWNLOAD_INTERRUPT_REASON_NETWORK_DISCONNECTED:
+    case download::DOWNLOAD_INTERRUPT_REASON_NETWORK_SERVER_DOWN:
+    case download::DOWNLOAD_INTERRUPT_REASON_SERVER_FAILED:
+    case download::DOWNLOAD_INTERRUPT_REASON_SERVER_CONTENT_LENGTH_MISMATCH:
+    case download::DOWNLOAD_INTERRUPT_REASON_CRASH:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Interruptions that mean the partial file doesn't match the resource on the
+// server anymore.
+bool IsStalePartialFile(download::DownloadInterruptReason reason) {
+  switch (reason) {
+    case download::DOWNLOAD_INTERRUPT_REASON_SERVER_NO_RANGE:
+    case download::DOWNLOAD_INTERRUPT_REASON_SERVER_PRECONDITION:
+    case download::DOWNLOAD_INTERRUPT_REASON_FILE_TOO_SHORT:
+    case download::DOWNLOAD_INTERRUPT_REASON_FILE_HASH_MISMATCH:
+      return true;
+    default:
+      return false;
+  }
+}
+
 }  // namespace
 
+// static
+PlaylistMediaFileDownloader::ResumeInfo
+PlaylistMediaFileDownloader::ReadResumeInfo(
+    const base::FilePath& media_file_path,
+    bool discard_partial_file) {
+  ResumeInfo resume_info;
+  std::string json;
+  if (!discard_partial_file &&
+      base::ReadFileToString(GetResumeInfoPath(media_file_path), &json) &&
+      base::GetFileSize(media_file_path, &resume_info.offset)) {
+    if (auto dict = base::JSONReader::ReadDict(json)) {
+      if (const auto* etag = dict->FindString(kResumeInfoETagKey)) {
+        resume_info.etag = *etag;
+      }
+      if (const auto* last_modified =
+              dict->FindString(kResumeInfoLastModifiedKey)) {
+        resume_info.last_modified = *last_modified;
+      }
+    }
+  }
+
+  // The info is consumed here. It's written again if this attempt is
+  // interrupted, too.
+  base::DeleteFile(GetResumeInfoPath(media_file_path));
+  if (resume_info.offset > 0 &&
+      (!resume_info.etag.empty() || !resume_info.last_modified.empty())) {
+    return resume_info;
+  }
+
+  base::DeleteFile(media_file_path);
+  return {};
+}
+
 PlaylistMediaFileDownloader::PlaylistMediaFileDownloader(
     Delegate* delegate,
     content::BrowserContext* context,
@@ -71,7 +159,8 @@ PlaylistMediaFileDownloader::~PlaylistMediaFileDownloader() {
     }
 
     while (!download_items_to_be_detached_.empty()) {
-      DetachCachedFile(download_items_to_be_detached_.front().get());
+      DetachCachedFile(download_items_to_be_detached_.front().get(),
+                       /*keep_partial_file=*/false);
     }
 
     download_manager_->ShutDown();
@@ -94,20 +183,22 @@ void PlaylistMediaFileDownloader::NotifySucceed(
 }
 
 void PlaylistMediaFileDownloader::ScheduleToDetachCachedFile(
-    download::DownloadItem* item) {
+    download::DownloadItem* item,
+    bool keep_partial_file) {
   for (auto& download : download_manager_->TakeInProgressDownloads()) {
     DCHECK(download_item_observation_.IsObservingSource(download.get()));
     download_items_to_be_detached_.push_back(std::move(download));
   }
 
   base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
-      FROM_HERE, base::BindOnce(&PlaylistMediaFileDownloader::DetachCachedFile,
-                                weak_factory_.GetWeakPtr(), item));
+      FROM_HERE,
+      base::BindOnce(&PlaylistMediaFileDownloader::DetachCachedFile,
+                     weak_factory_.GetWeakPtr(), item, keep_partial_file));
 }
 
 void PlaylistMediaFileDownloader::DetachCachedFile(
-    download::DownloadItem* item) {
-  // We allow only one item to be downloaded at a time.
+    download::DownloadItem* item,
+    bool keep_partial_file) {
   auto iter = base::ranges::find_if(
       download_items_to_be_detached_,
       [item](const auto& download) { return download.get() == item; });
@@ -125,9 +216,11 @@ void PlaylistMediaFileDownloader::DetachCachedFile(
           download::DownloadInterruptReason::DOWNLOAD_INTERRUPT_REASON_NONE &&
       item->IsDone()) {
     will_be_detached->MarkAsComplete();
-  } else {
+  } else if (!keep_partial_file) {
     will_be_detached->Remove();
   }
+  // Otherwise, the interrupted item is dropped without touching its file so
+  // that the next attempt can resume from it.
 }
 
 void PlaylistMediaFileDownloader::DownloadMediaFileForPlaylistItem(
@@ -139,7 +232,7 @@ void PlaylistMediaFileDownloader::DownloadMediaFileForPlaylistItem(
 
   if (item->cached) {
     DVLOG(2) << __func__ << ": media file is already downloaded";
-    NotifySucceed(current_item_->id, current_item_->media_path.spec());
+    NotifySucceed(item->id, item->media_path.spec());
     return;
   }
 
@@ -165,7 +258,7 @@ void PlaylistMediaFileDownloader::DownloadMediaFileForPlaylistItem(
 
   if (GURL media_url(current_item_->media_source); media_url.is_valid()) {
     playlist_dir_path_ = base_dir.AppendASCII(current_item_->id);
-    DownloadMediaFile(media_url);
+    StartDownload(media_url, /*discard_partial_file=*/false);
   } else {
     DVLOG(2) << __func__ << ": media file is empty";
     NotifyFail(current_item_->id);
@@ -190,12 +283,36 @@ void PlaylistMediaFileDownloader::OnDownloadUpdated(
     return;
   }
 
-  if (item->GetLastReason() !=
-      download::DownloadInterruptReason::DOWNLOAD_INTERRUPT_REASON_NONE) {
+  if (base::Contains(download_items_to_be_detached_, item,
+                     &std::unique_ptr<download::DownloadItemImpl>::get)) {
+    // A late update from an item we're already done with.
+    return;
+  }
+
+  if (const auto reason = item->GetLastReason();
+      reason != download::DOWNLOAD_INTERRUPT_REASON_NONE) {
     LOG(ERROR) << __func__ << ": Download interrupted - reason: "
-               << download::DownloadInterruptReasonToString(
-                      item->GetLastReason());
-    ScheduleToDetachCachedFile(item);
+               << download::DownloadInterruptReasonToString(reason);
+    if (resuming_partial_file_ && IsStalePartialFile(reason)) {
+      // The server can't continue from our partial file. Download the whole
+      // file once more.
+      resuming_partial_file_ = false;
+      ScheduleToDetachCachedFile(item, /*keep_partial_file=*/true);
+      StartDownload(GURL(current_item_->media_source),
+                    /*discard_partial_file=*/true);
+      return;
+    }
+
+    const bool keep_partial_file =
+        CanResumeAfter(reason) && item->GetReceivedBytes() > 0 &&
+        (!item->GetETag().empty() || !item->GetLastModifiedTime().empty());
+    if (keep_partial_file) {
+      task_runner()->PostTask(
+          FROM_HERE,
+          base::BindOnce(&WriteResumeInfo, GetMediaFilePath(), item->GetETag(),
+                         item->GetLastModifiedTime()));
+    }
+    ScheduleToDetachCachedFile(item, keep_partial_file);
     OnMediaFileDownloaded({});
     return;
   }
@@ -207,8 +324,8 @@ void PlaylistMediaFileDownloader::OnDownloadUpdated(
       item->PercentComplete(), time_remaining);
 
   if (item->IsDone()) {
-    ScheduleToDetachCachedFile(item);
-    OnMediaFileDownloaded(playlist_dir_path_.Append(media_file_name_));
+    ScheduleToDetachCachedFile(item, /*keep_partial_file=*/false);
+    OnMediaFileDownloaded(GetMediaFilePath());
     return;
   }
 }
@@ -219,16 +336,48 @@ void PlaylistMediaFileDownloader::OnDownloadRemoved(
       << "`item` was removed out of this class. This could cause flaky tests";
 }
 
-void PlaylistMediaFileDownloader::DownloadMediaFile(const GURL& url) {
-  DVLOG(2) << __func__ << ": " << url.spec();
+void PlaylistMediaFileDownloader::StartDownload(const GURL& url,
+                                                bool discard_partial_file) {
+  DCHECK(current_item_);
+  task_runner()->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&PlaylistMediaFileDownloader::ReadResumeInfo,
+                     GetMediaFilePath(), discard_partial_file),
+      base::BindOnce(&PlaylistMediaFileDownloader::OnGetResumeInfo,
+                     weak_factory_.GetWeakPtr(), current_item_->id, url));
+}
+
+void PlaylistMediaFileDownloader::OnGetResumeInfo(const std::string& id,
+                                                  const GURL& url,
+                                                  ResumeInfo resume_info) {
+  if (!current_item_ || current_item_->id != id) {
+    // Canceled while we were looking for the partial file.
+    return;
+  }
+
+  DownloadMediaFile(url, resume_info);
+}
+
+void PlaylistMediaFileDownloader::DownloadMediaFile(
+    const GURL& url,
+    const ResumeInfo& resume_info) {
+  DVLOG(2) << __func__ << ": " << url.spec() << " from "
+           << resume_info.offset;
 
-  const base::FilePath file_path = playlist_dir_path_.Append(media_file_name_);
   auto params = std::make_unique<download::DownloadUrlParameters>(
       url, GetNetworkTrafficAnnotationTagForURLLoad());
-  params->set_file_path(file_path);
+  params->set_file_path(GetMediaFilePath());
   params->set_guid(current_item_->id);
   params->set_transient(true);
   params->set_require_safety_checks(false);
+  resuming_partial_file_ = resume_info.offset > 0;
+  if (resuming_partial_file_) {
+    // The download system sends "Range" with "If-Range" built from these, so
+    // the server answers with the whole file if ours is stale.
+    params->set_offset(resume_info.offset);
+    params->set_etag(resume_info.etag);
+    params->set_last_modified(resume_info.last_modified);
+  }
   DCHECK(download_manager_->CanDownload(params.get()));
   download_manager_->DownloadUrl(std::move(params));
 }
@@ -251,6 +400,10 @@ void PlaylistMediaFileDownloader::OnMediaFileDownloaded(base::FilePath path) {
   NotifySucceed(current_item_->id, path.AsUTF8Unsafe());
 }
 
+base::FilePath PlaylistMediaFileDownloader::GetMediaFilePath() const {
+  return playlist_dir_path_.Append(media_file_name_);
+}
+
 void PlaylistMediaFileDownloader::RequestCancelCurrentPlaylistGeneration() {
   ResetDownloadStatus();
 }
@@ -266,6 +419,7 @@ base::SequencedTaskRunner* PlaylistMediaFileDownloader::task_runner() {
 
 void PlaylistMediaFileDownloader::ResetDownloadStatus() {
   in_progress_ = false;
+  resuming_partial_file_ = false;
   current_item_.reset();
   playlist_dir_path_.clear();
 }
@@ -43,7 +43,12 @@ class GURL;
 
 namespace playlist {
 
-// Handle one Playlist at once.
+// Downloads one playlist item's media file at a time.
+// PlaylistMediaFileDownloadManager owns a pool of these to download several
+// items in parallel. An interrupted download keeps its partial file next to a
+// small resume info file, and the next attempt for the same item continues
+// from there with a Range request validated by the ETag or Last-Modified the
+// server sent.
 class PlaylistMediaFileDownloader
     : public download::SimpleDownloadManager::Observer,
       public download::DownloadItem::Observer {
@@ -92,15 +97,38 @@ class PlaylistMediaFileDownloader
   void OnDownloadRemoved(download::DownloadItem* item) override;
 
  private:
+  // Validators of a partial media file that is left from an interrupted
+  // download.
+  struct ResumeInfo {
+    int64_t offset = 0;
+    std::string etag;
+    std::string last_modified;
+  };
+
+  // Reads and deletes the resume info of |media_file_path|. When
+  // |discard_partial_file| is true or the partial file can't be resumed, the
+  // file is deleted and an empty info is returned so that the download starts
+  // from zero.
+  static ResumeInfo ReadResumeInfo(const base::FilePath& media_file_path,
+                                   bool discard_partial_file);
+
   void ResetDownloadStatus();
-  void DownloadMediaFile(const GURL& url);
+  void StartDownload(const GURL& url, bool discard_partial_file);
+  void OnGetResumeInfo(const std::string& id,
+                       const GURL& url,
+                       ResumeInfo resume_info);
+  void DownloadMediaFile(const GURL& url, const ResumeInfo& resume_info);
   void OnMediaFileDownloaded(base::FilePath path);
+  base::FilePath GetMediaFilePath() const;
 
   void NotifyFail(const std::string& id);
   void NotifySucceed(const std::string& id, const std::string& media_file_path);
 
-  void ScheduleToDetachCachedFile(download::DownloadItem* item);
-  void DetachCachedFile(download::DownloadItem* item);
+  // When |keep_partial_file| is true, the file of an interrupted |item| is
+  // left on disk so that it can be resumed later.
+  void ScheduleToDetachCachedFile(download::DownloadItem* item,
+                                  bool keep_partial_file);
+  void DetachCachedFile(download::DownloadItem* item, bool keep_partial_file);
 
   base::SequencedTaskRunner* task_runner();
 
@@ -127,6 +155,10 @@ class PlaylistMediaFileDownloader
   // true when this class is working for playlist now.
   bool in_progress_ = false;
 
+  // true when the current download continues from a partial file. Cleared
+  // once the partial file is discarded so that we restart only once.
+  bool resuming_partial_file_ = false;
+
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
 
   base::WeakPtrFactory<PlaylistMediaFileDownloader> weak_factory_{this};
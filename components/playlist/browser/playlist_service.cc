@@ -19,7 +19,6 @@
 #include "base/task/thread_pool.h"
 #include "base/token.h"
 #include "brave/components/playlist/browser/playlist_constants.h"
-#include "brave/components/playlist/browser/playlist_data_source.h"
 #include "brave/components/playlist/browser/playlist_service_observer.h"
 #include "brave/components/playlist/browser/playlist_types.h"
 #include "brave/components/playlist/browser/pref_names.h"
@@ -59,8 +58,6 @@ PlaylistService::PlaylistService(content::BrowserContext* context,
     : delegate_(std::move(delegate)),
       base_dir_(context->GetPath().Append(kBaseDirName)),
       prefs_(user_prefs::UserPrefs::Get(context)) {
-  content::URLDataSource::Add(context,
-                              std::make_unique<PlaylistDataSource>(this));
   media_file_download_manager_ =
       std::make_unique<PlaylistMediaFileDownloadManager>(context, this,
                                                          base_dir_);
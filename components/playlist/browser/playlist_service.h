@@ -108,6 +108,10 @@ class PlaylistService : public KeyedService,
 
   base::FilePath GetPlaylistItemDirPath(const std::string& id) const;
 
+  base::WeakPtr<PlaylistService> GetWeakPtr() {
+    return weak_factory_.GetWeakPtr();
+  }
+
   // Update |web_prefs| if we want for |web_contents|.
   void ConfigureWebPrefsForBackgroundWebContents(
       content::WebContents* web_contents,
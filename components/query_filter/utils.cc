@@ -0,0 +1,69 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/query_filter/utils.h"
+
+namespace query_filter {
+
+namespace {
+
+// Returns the key of |kv| if it has a value. This is how parameters have
+// always been split: empty pieces between '=' are ignored, the first of the
+// remaining ones is the key and there has to be at least one more.
+absl::optional<base::StringPiece> GetKeyWithValue(base::StringPiece kv) {
+  const size_t key_start = kv.find_first_not_of('=');
+  if (key_start == base::StringPiece::npos)
+    return absl::nullopt;
+  const size_t key_end = kv.find('=', key_start);
+  if (key_end == base::StringPiece::npos ||
+      kv.find_first_not_of('=', key_end) == base::StringPiece::npos) {
+    return absl::nullopt;
+  }
+  return kv.substr(key_start, key_end - key_start);
+}
+
+}  // namespace
+
+absl::optional<std::string> StripQueryParameters(
+    base::StringPiece query,
+    base::FunctionRef<bool(base::StringPiece key)> is_tracker) {
+  // Walk the query string by ampersands once, dropping tracking parameters
+  // and copying the others, untouched, into the new query string. Nothing is
+  // copied until the first tracking parameter is found.
+  std::string result;
+  bool stripped = false;
+  bool first = true;
+  for (size_t start = 0; start <= query.size();) {
+    const size_t kv_start = start;
+    size_t end = query.find('&', start);
+    if (end == base::StringPiece::npos)
+      end = query.size();
+    const base::StringPiece kv = query.substr(start, end - start);
+    start = end + 1;
+
+    const absl::optional<base::StringPiece> key = GetKeyWithValue(kv);
+    if (key && is_tracker(*key)) {
+      if (!stripped && kv_start > 0) {
+        // Everything before it is kept, without the last ampersand.
+        result.reserve(query.size());
+        result.assign(query.data(), kv_start - 1);
+        first = false;
+      }
+      stripped = true;
+      continue;
+    }
+    if (!stripped)
+      continue;
+    if (!first)
+      result.push_back('&');
+    result.append(kv.data(), kv.size());
+    first = false;
+  }
+  if (stripped)
+    return result;
+  return absl::nullopt;
+}
+
+}  // namespace query_filter
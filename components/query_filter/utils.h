@@ -0,0 +1,30 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_QUERY_FILTER_UTILS_H_
+#define BRAVE_COMPONENTS_QUERY_FILTER_UTILS_H_
+
+#include <string>
+
+#include "base/functional/function_ref.h"
+#include "base/strings/string_piece.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace query_filter {
+
+// Removes the parameters with a value whose key |is_tracker| from |query| in
+// a single pass. Everything else, including empty parameters, is kept as is.
+// Returns nullopt if nothing was removed.
+//
+// We are using custom query string parsing code here. See
+// https://github.com/brave/brave-core/pull/13726#discussion_r897712350
+// for more information on why this approach was selected.
+absl::optional<std::string> StripQueryParameters(
+    base::StringPiece query,
+    base::FunctionRef<bool(base::StringPiece key)> is_tracker);
+
+}  // namespace query_filter
+
+#endif  // BRAVE_COMPONENTS_QUERY_FILTER_UTILS_H_
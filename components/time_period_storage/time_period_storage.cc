@@ -41,7 +41,23 @@ TimePeriodStorage::TimePeriodStorage(PrefService* prefs,
   Load();
 }
 
-TimePeriodStorage::~TimePeriodStorage() = default;
+TimePeriodStorage::~TimePeriodStorage() {
+  FlushPendingSave();
+}
+
+void TimePeriodStorage::SetSaveDelay(base::TimeDelta delay) {
+  save_delay_ = delay;
+  if (save_delay_.is_zero()) {
+    FlushPendingSave();
+  }
+}
+
+void TimePeriodStorage::FlushPendingSave() {
+  save_timer_.Stop();
+  if (dirty_) {
+    SaveNow();
+  }
+}
 
 void TimePeriodStorage::AddDelta(uint64_t delta) {
   FilterToPeriod();
@@ -140,7 +156,16 @@ bool TimePeriodStorage::IsOnePeriodPassed() const {
 }
 
 void TimePeriodStorage::FilterToPeriod() {
-  base::Time now_midnight = clock_->Now().LocalMidnight();
+  const base::Time now = clock_->Now();
+  if (!daily_values_.empty() && now >= current_day_start_ &&
+      now < current_day_end_) {
+    return;
+  }
+
+  base::Time now_midnight = now.LocalMidnight();
+  current_day_start_ = now_midnight;
+  // Not just one day later, days are 23 or 25 hours long on DST switches.
+  current_day_end_ = (now_midnight + base::Hours(36)).LocalMidnight();
   base::Time last_saved_midnight;
 
   if (!daily_values_.empty()) {
@@ -177,12 +202,23 @@ void TimePeriodStorage::Load() {
 }
 
 void TimePeriodStorage::Save() {
+  dirty_ = true;
+  if (save_delay_.is_zero()) {
+    SaveNow();
+    return;
+  }
+  if (!save_timer_.IsRunning()) {
+    save_timer_.Start(FROM_HERE, save_delay_, this,
+                      &TimePeriodStorage::SaveNow);
+  }
+}
+
+void TimePeriodStorage::SaveNow() {
   DCHECK(!daily_values_.empty());
   DCHECK_LE(daily_values_.size(), period_days_);
+  dirty_ = false;
 
   base::Value::List list;
-  // TODO(iefremov): Optimize if needed.
-  list.clear();
   for (const auto& u : daily_values_) {
     base::Value::Dict value;
     value.Set("day", u.day.ToDoubleT());
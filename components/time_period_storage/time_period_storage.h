@@ -11,6 +11,7 @@
 
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 
 namespace base {
 class Clock;
@@ -47,6 +48,13 @@ class TimePeriodStorage {
   uint64_t GetHighestValueInPeriod() const;
   bool IsOnePeriodPassed() const;
 
+  // By default every update is written to prefs right away. With a non-zero
+  // |delay| updates only mark the storage dirty and all of them are written
+  // at most once per |delay|, which suits hot counters in long-lived owners.
+  // Owners must call |FlushPendingSave| before |prefs| goes away.
+  void SetSaveDelay(base::TimeDelta delay);
+  void FlushPendingSave();
+
  protected:
   std::unique_ptr<base::Clock> clock_;
 
@@ -58,12 +66,21 @@ class TimePeriodStorage {
   void FilterToPeriod();
   void Load();
   void Save();
+  void SaveNow();
 
   const raw_ptr<PrefService> prefs_;
   const char* pref_name_ = nullptr;
   size_t period_days_;
 
   std::list<DailyValue> daily_values_;
+  // [start, end) of the day |FilterToPeriod| was last run for, it doesn't
+  // have to do anything until the clock leaves it.
+  base::Time current_day_start_;
+  base::Time current_day_end_;
+
+  base::TimeDelta save_delay_;
+  bool dirty_ = false;
+  base::OneShotTimer save_timer_;
 };
 
 #endif  // BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
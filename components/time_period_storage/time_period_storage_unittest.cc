@@ -10,6 +10,7 @@
 
 #include "base/memory/raw_ptr.h"
 #include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
 #include "base/time/time.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/testing_pref_service.h"
@@ -126,6 +127,32 @@ TEST_F(TimePeriodStorageTest, GetSumInCustomPeriod) {
             0u);
 }
 
+TEST_F(TimePeriodStorageTest, CoalescesDelayedSaves) {
+  base::test::TaskEnvironment task_environment(
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME);
+  InitStorage(7);
+  state_->SetSaveDelay(base::Minutes(1));
+
+  for (int i = 0; i < 100; i++) {
+    state_->AddDelta(10);
+  }
+  EXPECT_EQ(state_->GetPeriodSum(), 1000U);
+  EXPECT_TRUE(pref_service_.GetList(kPrefName).empty());
+
+  task_environment.FastForwardBy(base::Minutes(1));
+  ASSERT_EQ(pref_service_.GetList(kPrefName).size(), 1U);
+  EXPECT_EQ(
+      pref_service_.GetList(kPrefName)[0].GetDict().FindDouble("value"),
+      1000);
+
+  // Pending updates are written out when the storage goes away.
+  state_->AddDelta(10);
+  state_.reset();
+  EXPECT_EQ(
+      pref_service_.GetList(kPrefName)[0].GetDict().FindDouble("value"),
+      1010);
+}
+
 TEST_F(TimePeriodStorageTest, ForgetsOldSavingsWeekly) {
   InitStorage(7);
   uint64_t saving = 10000;
@@ -5,6 +5,10 @@
 
 #include "brave/components/time_period_storage/weekly_storage.h"
 
+#include <utility>
+
+#include "base/time/clock.h"
+
 namespace {
 constexpr size_t kDaysInWeek = 7;
 }
@@ -12,6 +16,11 @@ constexpr size_t kDaysInWeek = 7;
 WeeklyStorage::WeeklyStorage(PrefService* prefs, const char* pref_name)
     : TimePeriodStorage(prefs, pref_name, kDaysInWeek) {}
 
+WeeklyStorage::WeeklyStorage(PrefService* prefs,
+                             const char* pref_name,
+                             std::unique_ptr<base::Clock> clock)
+    : TimePeriodStorage(prefs, pref_name, kDaysInWeek, std::move(clock)) {}
+
 uint64_t WeeklyStorage::GetWeeklySum() const {
   return GetPeriodSum();
 }
@@ -6,13 +6,22 @@
 #ifndef BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_WEEKLY_STORAGE_H_
 #define BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_WEEKLY_STORAGE_H_
 
+#include <memory>
+
 #include "brave/components/time_period_storage/time_period_storage.h"
 
+namespace base {
+class Clock;
+}
+
 class PrefService;
 
 class WeeklyStorage : public TimePeriodStorage {
  public:
   WeeklyStorage(PrefService* prefs, const char* pref_name);
+  WeeklyStorage(PrefService* prefs,
+                const char* pref_name,
+                std::unique_ptr<base::Clock> clock);
 
   WeeklyStorage(const WeeklyStorage&) = delete;
   WeeklyStorage& operator=(const WeeklyStorage&) = delete;
@@ -40,8 +40,6 @@ const net::NetworkTrafficAnnotationTag tor_control_traffic_annotation =
     }
   )");
 
-const size_t kTorBufferSize = 4096;
-
 constexpr char kGetVersionCmd[] = "GETINFO version";
 constexpr char kGetVersionReply[] = "version=";
 constexpr char kGetSOCKSListenersCmd[] = "GETINFO net/listeners/socks";
@@ -91,8 +89,6 @@ TorControl::TorControl(base::WeakPtr<TorControl::Delegate> delegate,
       io_task_runner_(task_runner),
       writing_(false),
       reading_(false),
-      read_start_(-1),
-      read_cr_(false),
       delegate_(delegate) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(owner_sequence_checker_);
   DETACH_FROM_SEQUENCE(io_sequence_checker_);
@@ -727,33 +723,29 @@ void TorControl::StartRead() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
   DCHECK(reading_);
   DCHECK(!cmdq_.empty() || !async_events_.empty());
-  readiobuf_ = base::MakeRefCounted<net::GrowableIOBuffer>();
-  readiobuf_->SetCapacity(kTorBufferSize);
-  read_start_ = 0;
-  DCHECK(readiobuf_->RemainingCapacity());
+  line_reader_.Reset();
 }
 
 // DoReads()
 //
-//      Issue reads into readiobuf_ and process them.
+//      Issue reads into line_reader_ and process them.
 //
-//      Caller must ensure reading_ is true and readiobuf_ is
-//      initialized.
+//      Caller must ensure reading_ is true.
 //
 void TorControl::DoReads() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
   DCHECK(reading_);
-  DCHECK(readiobuf_);
   int rv;
-  DCHECK(readiobuf_->RemainingCapacity());
-  while ((rv = socket_->Read(readiobuf_.get(), readiobuf_->RemainingCapacity(),
+  DCHECK(line_reader_.read_capacity());
+  while ((rv = socket_->Read(line_reader_.read_buffer(),
+                             line_reader_.read_capacity(),
                              base::BindOnce(&TorControl::ReadDoneAsync,
                                             weak_ptr_factory_.GetWeakPtr()))) !=
          net::ERR_IO_PENDING) {
     ReadDone(rv);
     if (!reading_)
       break;
-    DCHECK(readiobuf_->RemainingCapacity());
+    DCHECK(line_reader_.read_capacity());
   }
 }
 
@@ -762,32 +754,29 @@ void TorControl::DoReads() {
 //      Asynchronous callback for read completion.  Defer to
 //      ReadDone() and then start up DoReads() again if need be.
 //
-//      Caller must ensure reading_ is true and readiobuf_ is
-//      initialized.
+//      Caller must ensure reading_ is true.
 //
 void TorControl::ReadDoneAsync(int rv) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
   DCHECK(reading_);
-  DCHECK(readiobuf_);
   ReadDone(rv);
   if (reading_) {
-    DCHECK(readiobuf_->RemainingCapacity());
+    DCHECK(line_reader_.read_capacity());
     DoReads();
   }
 }
 
 // ReadDone()
 //
-//      A read into readiobuf_ just completed.  Process it.  If
-//      there's no more reads to do, disable reading_.
+//      A read into line_reader_ just completed.  Process the lines
+//      it completes.  If there's no more reads to do, disable
+//      reading_.
 //
-//      Caller must ensure reading_ is true and readiobuf_ is
-//      initialized.
+//      Caller must ensure reading_ is true.
 //
 void TorControl::ReadDone(int rv) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
   DCHECK(reading_);
-  DCHECK(readiobuf_);
   if (rv < 0) {
     VLOG(1) << "tor: control read error: " << net::ErrorToString(rv);
     Error();
@@ -798,73 +787,35 @@ void TorControl::ReadDone(int rv) {
     Error();
     return;
   }
-  const char* data = readiobuf_->data();
-  for (int i = 0; i < rv; i++) {
-    if (!read_cr_) {
-      // No CR yet.  Accept CR or non-LF; reject LF.
-      if (data[i] == 0x0d) {  // CR
-        read_cr_ = true;
-      } else if (data[i] == 0x0a) {  // LF
-        VLOG(1) << "tor: stray line feed";
-        Error();
-        return;
-      } else {
-        // Anything else: Just accept it and move on.
-      }
-    } else {
-      // CR seen.  Accept LF; reject all else.
-      if (data[i] == 0x0a) {  // LF
-        // CRLF seen, so we must have i >= 2.  Emit a line and advance
-        // to the next one, unless anything went wrong with the line.
-        assert(i >= 1);
-        std::string line(readiobuf_->StartOfBuffer() + read_start_,
-                         readiobuf_->offset() + i - 1 - read_start_);
-        read_start_ = readiobuf_->offset() + i + 1;
-        read_cr_ = false;
-        if (!ReadLine(line)) {
-          reading_ = false;
-          return;
-        }
-      } else {
-        // CR seen, but not LF.  Bad.
-        VLOG(1) << "tor: stray carriage return";
-        Error();
-        return;
-      }
-    }
-  }
 
-  // If we've walked up to the end of the buffer, try shifting it to
-  // the beginning to make room; if there's no more room, fail --
-  // lines shouldn't be this long.
-  DCHECK(rv <= readiobuf_->RemainingCapacity());
-  if (readiobuf_->RemainingCapacity() == rv) {
-    if (read_start_ == 0) {
-      // Line is too long.
+  switch (line_reader_.DidRead(
+      rv, [this](base::StringPiece line) { return ReadLine(line); })) {
+    case TorControlLineReader::Result::kOk:
+      break;
+    case TorControlLineReader::Result::kStopped:
+      reading_ = false;
+      return;
+    case TorControlLineReader::Result::kStrayLineFeed:
+      VLOG(1) << "tor: stray line feed";
+      Error();
+      return;
+    case TorControlLineReader::Result::kStrayCarriageReturn:
+      VLOG(1) << "tor: stray carriage return";
+      Error();
+      return;
+    case TorControlLineReader::Result::kLineTooLong:
       VLOG(1) << "tor: control line too long";
       Error();
       return;
-    }
-    memmove(readiobuf_->StartOfBuffer(),
-            readiobuf_->StartOfBuffer() + read_start_,
-            readiobuf_->offset() - read_start_ + rv);
-    readiobuf_->set_offset(readiobuf_->offset() - read_start_ + rv);
-    read_start_ = 0;
-  } else {
-    // Otherwise, just advance the offset by the size of this input.
-    readiobuf_->set_offset(readiobuf_->offset() + rv);
   }
-  DCHECK(readiobuf_->RemainingCapacity());
 
   // If we've processed every byte in the input so far, and there's no
   // more command callbacks queued or asynchronous events registered,
   // stop.
-  if (read_start_ == readiobuf_->offset() && cmdq_.empty() &&
+  if (!line_reader_.has_partial_line() && cmdq_.empty() &&
       async_events_.empty()) {
     reading_ = false;
-    readiobuf_.reset();
-    read_start_ = 0;
-    read_cr_ = false;
+    line_reader_.Reset();
     return;
   }
 }
@@ -874,9 +825,29 @@ void TorControl::ReadDone(int rv) {
 //      We have read a line of input; process it.  Return true on
 //      success, false on error.
 //
-bool TorControl::ReadLine(const std::string& line) {
+bool TorControl::ReadLine(base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
 
+  // Inside a data reply, every line up to a lone "." is content, with a
+  // leading "." doubled.  Hand it over as one reply when it's complete.
+  if (data_reply_) {
+    if (line == ".") {
+      NotifyTorRawMid(data_reply_->status, data_reply_->reply);
+      if (!cmdq_.empty()) {
+        PerLineCallback& perline = cmdq_.front().first;
+        perline.Run(data_reply_->status, data_reply_->reply);
+      }
+      data_reply_.reset();
+      return true;
+    }
+    if (base::StartsWith(line, ".")) {
+      line.remove_prefix(1);
+    }
+    data_reply_->reply.push_back('\n');
+    data_reply_->reply.append(line.data(), line.size());
+    return true;
+  }
+
   if (line.size() < 4) {
     // Line is too short.
     VLOG(1) << "tor: control line too short";
@@ -889,9 +860,9 @@ bool TorControl::ReadLine(const std::string& line) {
   // intermediate reply and ` ' for a final reply.
   //
   // TODO(riastradh): parse or check syntax of status
-  std::string status(line, 0, 3);
+  std::string status(line.substr(0, 3));
   char pos = line[3];
-  std::string reply(line, 4);
+  std::string reply(line.substr(4));
 
   // Determine whether it is an asynchronous reply, status 6yz.
   if (status[0] == '6') {
@@ -1022,8 +993,10 @@ bool TorControl::ReadLine(const std::string& line) {
         }
         return true;
       case '+':
-        VLOG(2) << "tor: NYI: control data reply";
-        // XXX Just ignore it for now.
+        // Start of a data reply.  The data follows on the next lines.
+        data_reply_ = std::make_unique<DataReply>();
+        data_reply_->status = std::move(status);
+        data_reply_->reply = std::move(reply);
         return true;
       case ' ':
         NotifyTorRawEnd(status, reply);
@@ -1066,9 +1039,8 @@ void TorControl::Error() {
     cmdq_.pop();
   }
   reading_ = false;
-  readiobuf_.reset();
-  read_start_ = -1;
-  read_cr_ = false;
+  line_reader_.Reset();
+  data_reply_.reset();
 
   // Clear write state.
   writeq_ = {};
@@ -17,7 +17,9 @@
 #include "base/functional/callback_forward.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/tor/tor_control_event.h"
+#include "brave/components/tor/tor_control_line_reader.h"
 
 namespace base {
 class SequencedTaskRunner;
@@ -25,7 +27,6 @@ class SequencedTaskRunner;
 
 namespace net {
 class DrainableIOBuffer;
-class GrowableIOBuffer;
 class TCPClientSocket;
 }  // namespace net
 
@@ -104,6 +105,7 @@ class TorControl {
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ParseQuoted);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ParseKV);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, ReadLine);
+  FRIEND_TEST_ALL_PREFIXES(TorControlTest, ReadDataReply);
   FRIEND_TEST_ALL_PREFIXES(TorControlTest, GetCircuitEstablishedDone);
 
   static bool ParseKV(const std::string& string,
@@ -203,7 +205,7 @@ class TorControl {
   void DoReads();
   void ReadDoneAsync(int rv);
   void ReadDone(int rv);
-  bool ReadLine(const std::string& line);
+  bool ReadLine(base::StringPiece line);
 
   void Error();
 
@@ -227,9 +229,15 @@ class TorControl {
   // Read state machine.
   std::queue<std::pair<PerLineCallback, CmdCallback>> cmdq_;
   bool reading_;
-  scoped_refptr<net::GrowableIOBuffer> readiobuf_;
-  int read_start_;  // offset where the current line starts
-  bool read_cr_;    // true if we have parsed a CR
+  TorControlLineReader line_reader_;
+
+  // Data reply (`xyz+keyword=`) being read. Its lines are joined with LF up
+  // to the terminating ".".
+  struct DataReply {
+    std::string status;
+    std::string reply;
+  };
+  std::unique_ptr<DataReply> data_reply_;
 
   // Asynchronous command response callback state machine.
   std::map<TorControlEvent, size_t> async_events_;
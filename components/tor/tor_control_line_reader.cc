@@ -0,0 +1,118 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/tor/tor_control_line_reader.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "base/check_op.h"
+#include "net/base/io_buffer.h"
+
+namespace tor {
+
+TorControlLineReader::TorControlLineReader() = default;
+
+TorControlLineReader::~TorControlLineReader() = default;
+
+net::IOBuffer* TorControlLineReader::read_buffer() {
+  EnsureBuffer();
+  buffer_->set_offset(end_);
+  return buffer_.get();
+}
+
+int TorControlLineReader::read_capacity() const {
+  return static_cast<int>(kBufferSize - end_);
+}
+
+TorControlLineReader::Result TorControlLineReader::DidRead(
+    size_t size,
+    LineCallback callback) {
+  DCHECK(buffer_);
+  DCHECK_LE(size, kBufferSize - end_);
+
+  // Hold on to the buffer in case |callback| resets us.
+  scoped_refptr<net::GrowableIOBuffer> buffer = buffer_;
+  const char* data = buffer->StartOfBuffer();
+  end_ += size;
+
+  while (scan_start_ < end_) {
+    const char* lf = static_cast<const char*>(
+        memchr(data + scan_start_, '\n', end_ - scan_start_));
+    if (!lf) {
+      scan_start_ = end_;
+      break;
+    }
+
+    const size_t lf_pos = lf - data;
+    if (lf_pos == line_start_ || data[lf_pos - 1] != '\r') {
+      return Result::kStrayLineFeed;
+    }
+    const base::StringPiece line(data + line_start_, lf_pos - 1 - line_start_);
+    if (line.find('\r') != base::StringPiece::npos) {
+      return Result::kStrayCarriageReturn;
+    }
+
+    line_start_ = scan_start_ = lf_pos + 1;
+    if (!callback(line)) {
+      return Result::kStopped;
+    }
+    if (!buffer_) {
+      return Result::kOk;
+    }
+  }
+
+  // Everything is consumed, so the next read can start over from the
+  // beginning of the buffer.
+  if (line_start_ == end_) {
+    line_start_ = scan_start_ = end_ = 0;
+    return Result::kOk;
+  }
+
+  // If the buffer is full, move the incomplete line to the beginning to make
+  // room. If it already starts there, lines shouldn't be this long.
+  if (end_ == kBufferSize) {
+    if (line_start_ == 0) {
+      return Result::kLineTooLong;
+    }
+    memmove(buffer->StartOfBuffer(), data + line_start_, end_ - line_start_);
+    end_ -= line_start_;
+    scan_start_ -= line_start_;
+    line_start_ = 0;
+  }
+
+  return Result::kOk;
+}
+
+TorControlLineReader::Result TorControlLineReader::Append(
+    base::StringPiece data,
+    LineCallback callback) {
+  while (!data.empty()) {
+    const size_t size =
+        std::min(data.size(), static_cast<size_t>(read_capacity()));
+    memcpy(read_buffer()->data(), data.data(), size);
+    data.remove_prefix(size);
+    if (const Result result = DidRead(size, callback); result != Result::kOk) {
+      return result;
+    }
+  }
+  return Result::kOk;
+}
+
+void TorControlLineReader::Reset() {
+  buffer_.reset();
+  line_start_ = scan_start_ = end_ = 0;
+}
+
+void TorControlLineReader::EnsureBuffer() {
+  if (buffer_) {
+    return;
+  }
+  buffer_ = base::MakeRefCounted<net::GrowableIOBuffer>();
+  buffer_->SetCapacity(kBufferSize);
+}
+
+}  // namespace tor
@@ -0,0 +1,83 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_TOR_TOR_CONTROL_LINE_READER_H_
+#define BRAVE_COMPONENTS_TOR_TOR_CONTROL_LINE_READER_H_
+
+#include <stddef.h>
+
+#include "base/functional/function_ref.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/strings/string_piece.h"
+
+namespace net {
+class GrowableIOBuffer;
+class IOBuffer;
+}  // namespace net
+
+namespace tor {
+
+// Splits the byte stream of a Tor control connection into CRLF-terminated
+// lines. Socket reads go straight into read_buffer(), and DidRead() finds
+// line ends with memchr and hands out each complete line as a StringPiece
+// into that buffer. Bytes are copied only when the buffer is full and an
+// incomplete line has to be moved back to its start.
+class TorControlLineReader {
+ public:
+  enum class Result {
+    kOk,
+    // The line callback returned false.
+    kStopped,
+    kStrayLineFeed,
+    kStrayCarriageReturn,
+    kLineTooLong,
+  };
+
+  // Called with each line, without its CRLF. Returning false stops reading.
+  using LineCallback = base::FunctionRef<bool(base::StringPiece line)>;
+
+  static constexpr size_t kBufferSize = 4096;
+
+  TorControlLineReader();
+  ~TorControlLineReader();
+
+  TorControlLineReader(const TorControlLineReader&) = delete;
+  TorControlLineReader& operator=(const TorControlLineReader&) = delete;
+
+  // Where the next read should go and how many bytes it may write. The
+  // buffer is allocated on demand.
+  net::IOBuffer* read_buffer();
+  int read_capacity() const;
+
+  // Processes |size| bytes that were just read into read_buffer(), running
+  // |callback| for every line they complete. Stops at the first malformed
+  // line. It's fine for |callback| to call Reset().
+  Result DidRead(size_t size, LineCallback callback);
+
+  // Convenience for feeding bytes that didn't come from a socket, such as in
+  // tests and fuzzers.
+  Result Append(base::StringPiece data, LineCallback callback);
+
+  // True if some bytes of an incomplete line are buffered.
+  bool has_partial_line() const { return line_start_ < end_; }
+
+  // Drops the buffer and anything in it.
+  void Reset();
+
+ private:
+  void EnsureBuffer();
+
+  scoped_refptr<net::GrowableIOBuffer> buffer_;
+  // Offset of the first byte of the current, incomplete line.
+  size_t line_start_ = 0;
+  // Offset where scanning for the next LF resumes.
+  size_t scan_start_ = 0;
+  // Offset one past the last valid byte.
+  size_t end_ = 0;
+};
+
+}  // namespace tor
+
+#endif  // BRAVE_COMPONENTS_TOR_TOR_CONTROL_LINE_READER_H_
@@ -0,0 +1,85 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <string>
+
+#include "base/base_paths.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/path_service.h"
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "base/time/time.h"
+#include "base/timer/lap_timer.h"
+#include "brave/components/tor/tor_control_line_reader.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace tor {
+
+namespace {
+
+constexpr char kMetricPrefixTorControlLineReader[] = "TorControlLineReader.";
+constexpr char kMetricTranscriptTime[] = "transcript_time";
+
+constexpr int kWarmupRuns = 5;
+constexpr int kTimeCheckInterval = 10;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixTorControlLineReader,
+                                         story);
+  reporter.RegisterImportantMetric(kMetricTranscriptTime, "us");
+  return reporter;
+}
+
+// Transcripts are checked in with LF line endings. Tor sends CRLF.
+std::string ReadTranscript(const std::string& name) {
+  base::FilePath path;
+  EXPECT_TRUE(base::PathService::Get(base::DIR_SOURCE_ROOT, &path));
+  path = path.AppendASCII("brave")
+             .AppendASCII("test")
+             .AppendASCII("data")
+             .AppendASCII("tor")
+             .AppendASCII("control_transcripts")
+             .AppendASCII(name);
+  std::string transcript;
+  EXPECT_TRUE(base::ReadFileToString(path, &transcript));
+  base::ReplaceSubstringsAfterOffset(&transcript, 0, "\n", "\r\n");
+  return transcript;
+}
+
+}  // namespace
+
+// Reads a bootstrap transcript in socket sized chunks.
+TEST(TorControlLineReaderPerfTest, BootstrapTranscript) {
+  const std::string transcript = ReadTranscript("bootstrap.txt");
+  const size_t lines_per_transcript = base::ranges::count(transcript, '\n');
+  ASSERT_GT(lines_per_transcript, 0u);
+
+  TorControlLineReader reader;
+  base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    size_t count = 0;
+    for (size_t i = 0; i < transcript.size();
+         i += TorControlLineReader::kBufferSize) {
+      ASSERT_EQ(TorControlLineReader::Result::kOk,
+                reader.Append(base::StringPiece(transcript)
+                                  .substr(i, TorControlLineReader::kBufferSize),
+                              [&](base::StringPiece) {
+                                ++count;
+                                return true;
+                              }));
+    }
+    ASSERT_EQ(lines_per_transcript, count);
+    timer.NextLap();
+  } while (!timer.HasTimeLimitExpired());
+
+  auto reporter = SetUpReporter("bootstrap");
+  reporter.AddResult(kMetricTranscriptTime, timer.TimePerLap());
+}
+
+}  // namespace tor
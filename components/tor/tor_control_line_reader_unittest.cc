@@ -0,0 +1,138 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/tor/tor_control_line_reader.h"
+
+#include <string>
+#include <vector>
+
+#include "base/base_paths.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/path_service.h"
+#include "base/ranges/algorithm.h"
+#include "base/strings/string_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace tor {
+
+namespace {
+
+using Result = TorControlLineReader::Result;
+
+// Transcripts are checked in with LF line endings. Tor sends CRLF.
+std::string ReadTranscript(const std::string& name) {
+  base::FilePath path;
+  EXPECT_TRUE(base::PathService::Get(base::DIR_SOURCE_ROOT, &path));
+  path = path.AppendASCII("brave")
+             .AppendASCII("test")
+             .AppendASCII("data")
+             .AppendASCII("tor")
+             .AppendASCII("control_transcripts")
+             .AppendASCII(name);
+  std::string transcript;
+  EXPECT_TRUE(base::ReadFileToString(path, &transcript));
+  base::ReplaceSubstringsAfterOffset(&transcript, 0, "\n", "\r\n");
+  return transcript;
+}
+
+}  // namespace
+
+class TorControlLineReaderTest : public testing::Test {
+ protected:
+  // Feeds |data| |chunk_size| bytes at a time, as the socket would.
+  Result Feed(const std::string& data, size_t chunk_size) {
+    for (size_t i = 0; i < data.size(); i += chunk_size) {
+      const Result result =
+          reader_.Append(base::StringPiece(data).substr(i, chunk_size),
+                         [this](base::StringPiece line) {
+                           lines_.emplace_back(line);
+                           return true;
+                         });
+      if (result != Result::kOk) {
+        return result;
+      }
+    }
+    return Result::kOk;
+  }
+
+  TorControlLineReader reader_;
+  std::vector<std::string> lines_;
+};
+
+TEST_F(TorControlLineReaderTest, SplitsLinesAcrossChunks) {
+  const std::string input = "250-version=0.4.7.13\r\n250 OK\r\n\r\n650 ";
+  for (size_t chunk_size : {1u, 2u, 5u, 64u}) {
+    SCOPED_TRACE(chunk_size);
+    reader_.Reset();
+    lines_.clear();
+    EXPECT_EQ(Result::kOk, Feed(input, chunk_size));
+    EXPECT_EQ(
+        (std::vector<std::string>{"250-version=0.4.7.13", "250 OK", ""}),
+        lines_);
+    EXPECT_TRUE(reader_.has_partial_line());
+  }
+}
+
+TEST_F(TorControlLineReaderTest, RejectsMalformedLineEnds) {
+  EXPECT_EQ(Result::kStrayLineFeed, Feed("250 OK\n", 64));
+
+  reader_.Reset();
+  EXPECT_EQ(Result::kStrayLineFeed, Feed("\n", 64));
+
+  reader_.Reset();
+  EXPECT_EQ(Result::kStrayCarriageReturn, Feed("250 O\rK\r\n", 64));
+
+  reader_.Reset();
+  const std::string long_line(TorControlLineReader::kBufferSize, 'x');
+  EXPECT_EQ(Result::kLineTooLong, Feed(long_line, 64));
+}
+
+TEST_F(TorControlLineReaderTest, KeepsPartialLineWhenBufferFills) {
+  // The second line straddles the end of the buffer and has to be moved
+  // back to its beginning.
+  const std::string first(TorControlLineReader::kBufferSize - 10, 'a');
+  const std::string second(100, 'b');
+  EXPECT_EQ(Result::kOk, Feed(first + "\r\n" + second + "\r\n", 1000));
+  EXPECT_EQ((std::vector<std::string>{first, second}), lines_);
+  EXPECT_FALSE(reader_.has_partial_line());
+}
+
+TEST_F(TorControlLineReaderTest, StopsWhenCallbackReturnsFalse) {
+  int calls = 0;
+  EXPECT_EQ(Result::kStopped,
+            reader_.Append("250 OK\r\n250 OK\r\n", [&](base::StringPiece) {
+              ++calls;
+              return false;
+            }));
+  EXPECT_EQ(1, calls);
+}
+
+TEST_F(TorControlLineReaderTest, ResetFromCallback) {
+  EXPECT_EQ(Result::kOk,
+            reader_.Append("250 OK\r\n250 OK\r\n", [&](base::StringPiece) {
+              reader_.Reset();
+              return true;
+            }));
+  EXPECT_FALSE(reader_.has_partial_line());
+}
+
+TEST_F(TorControlLineReaderTest, ReadsTranscriptInSocketSizedChunks) {
+  const std::string transcript = ReadTranscript("bootstrap.txt");
+  const size_t lines_per_transcript = base::ranges::count(transcript, '\n');
+  ASSERT_GT(lines_per_transcript, 0u);
+
+  constexpr int kRepeats = 10;
+  std::string input;
+  for (int i = 0; i < kRepeats; ++i) {
+    input += transcript;
+  }
+
+  EXPECT_EQ(Result::kOk, Feed(input, TorControlLineReader::kBufferSize));
+  EXPECT_EQ(lines_per_transcript * kRepeats, lines_.size());
+  EXPECT_FALSE(reader_.has_partial_line());
+}
+
+}  // namespace tor
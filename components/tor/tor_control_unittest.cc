@@ -186,6 +186,34 @@ TEST(TorControlTest, ReadLine) {
   base::RunLoop().RunUntilIdle();
 }
 
+TEST(TorControlTest, ReadDataReply) {
+  content::BrowserTaskEnvironment task_environment;
+  scoped_refptr<base::SequencedTaskRunner> io_task_runner =
+      content::GetIOThreadTaskRunner({});
+
+  MockTorControlDelegate delegate;
+  std::unique_ptr<TorControl> control =
+      std::make_unique<TorControl>(delegate.AsWeakPtr(), io_task_runner);
+
+  EXPECT_CALL(delegate, OnTorRawMid("250", "config-text=\nControlPort 1\n.dot"))
+      .Times(1);
+  EXPECT_CALL(delegate, OnTorRawEnd("250", "OK")).Times(1);
+  io_task_runner->PostTask(
+      FROM_HERE, base::BindOnce(
+                     [](std::unique_ptr<TorControl> control) {
+                       EXPECT_TRUE(control->ReadLine("250+config-text="));
+                       EXPECT_TRUE(control->data_reply_);
+                       EXPECT_TRUE(control->ReadLine("ControlPort 1"));
+                       EXPECT_TRUE(control->ReadLine("..dot"));
+                       EXPECT_TRUE(control->ReadLine("."));
+                       EXPECT_FALSE(control->data_reply_);
+                       EXPECT_TRUE(control->ReadLine("250 OK"));
+                     },
+                     std::move(control)));
+
+  base::RunLoop().RunUntilIdle();
+}
+
 TEST(TorControlTest, GetCircuitEstablishedDone) {
   content::BrowserTaskEnvironment task_environment;
   scoped_refptr<base::SequencedTaskRunner> io_task_runner =
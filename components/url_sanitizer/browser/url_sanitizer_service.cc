@@ -5,15 +5,18 @@
 
 #include "brave/components/url_sanitizer/browser/url_sanitizer_service.h"
 
+#include <iterator>
+#include <map>
 #include <memory>
 #include <vector>
 
 #include "base/json/json_reader.h"
 #include "base/logging.h"
-#include "base/strings/string_split.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/string_util.h"
 #include "base/task/thread_pool.h"
 #include "base/values.h"
+#include "brave/components/query_filter/utils.h"
 #include "extensions/common/url_pattern.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
@@ -47,8 +50,7 @@ absl::optional<base::flat_set<std::string>> CreateParamsList(
   return result;
 }
 
-base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> ParseFromJson(
-    const std::string& json) {
+URLSanitizerService::RuleIndex ParseFromJson(const std::string& json) {
   auto parsed_json = base::JSONReader::ReadAndReturnValueWithError(json);
   if (!parsed_json.has_value()) {
     VLOG(1) << "Error parsing feature JSON: " << parsed_json.error().message;
@@ -58,7 +60,7 @@ base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> ParseFromJson(
   if (!list) {
     return {};
   }
-  base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> matchers;
+  std::vector<std::unique_ptr<URLSanitizerService::MatchItem>> matchers;
   for (const auto& it : *list) {
     const base::Value::Dict* items = it.GetIfDict();
     if (!items)
@@ -82,10 +84,10 @@ base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> ParseFromJson(
         std::move(include_matcher), std::move(exclude_matcher),
         std::move(*params));
 
-    matchers.insert(std::move(item));
+    matchers.push_back(std::move(item));
   }
 
-  return matchers;
+  return URLSanitizerService::RuleIndex(std::move(matchers));
 }
 
 }  // namespace
@@ -102,6 +104,72 @@ URLSanitizerService::MatchItem::MatchItem(extensions::URLPatternSet in,
                                           base::flat_set<std::string> prm)
     : include(std::move(in)), exclude(std::move(ex)), params(std::move(prm)) {}
 
+URLSanitizerService::RuleIndex::RuleIndex() = default;
+
+URLSanitizerService::RuleIndex::RuleIndex(
+    std::vector<std::unique_ptr<MatchItem>> items)
+    : items_(std::move(items)) {
+  std::map<std::string, std::vector<size_t>> hosts;
+  std::map<std::string, std::vector<size_t>> domains;
+  for (size_t index = 0; index < items_.size(); ++index) {
+    for (const URLPattern& pattern : items_[index]->include) {
+      if (pattern.match_all_urls() ||
+          (pattern.match_subdomains() && pattern.host().empty())) {
+        any_host_.push_back(index);
+      } else if (pattern.match_subdomains()) {
+        domains[pattern.host()].push_back(index);
+      } else {
+        hosts[pattern.host()].push_back(index);
+      }
+    }
+  }
+  hosts_ = HostBuckets(std::make_move_iterator(hosts.begin()),
+                       std::make_move_iterator(hosts.end()));
+  domains_ = HostBuckets(std::make_move_iterator(domains.begin()),
+                         std::make_move_iterator(domains.end()));
+}
+
+URLSanitizerService::RuleIndex::RuleIndex(RuleIndex&&) = default;
+URLSanitizerService::RuleIndex& URLSanitizerService::RuleIndex::operator=(
+    RuleIndex&&) = default;
+URLSanitizerService::RuleIndex::~RuleIndex() = default;
+
+std::vector<const base::flat_set<std::string>*>
+URLSanitizerService::RuleIndex::GetParamsToStrip(const GURL& url) const {
+  const base::StringPiece host =
+      base::TrimString(url.host_piece(), ".", base::TRIM_TRAILING);
+
+  std::vector<size_t> candidates = any_host_;
+  auto add_bucket = [&candidates](const HostBuckets& buckets,
+                                  base::StringPiece key) {
+    auto it = buckets.find(key);
+    if (it != buckets.end()) {
+      candidates.insert(candidates.end(), it->second.begin(),
+                        it->second.end());
+    }
+  };
+  add_bucket(hosts_, host);
+  for (base::StringPiece domain = host;;) {
+    add_bucket(domains_, domain);
+    const size_t dot = domain.find('.');
+    if (dot == base::StringPiece::npos)
+      break;
+    domain.remove_prefix(dot + 1);
+  }
+
+  // A rule may be in several buckets, test it only once.
+  base::ranges::sort(candidates);
+  candidates.erase(base::ranges::unique(candidates), candidates.end());
+
+  std::vector<const base::flat_set<std::string>*> params;
+  for (size_t index : candidates) {
+    const MatchItem& item = *items_[index];
+    if (item.include.MatchesURL(url) && !item.exclude.MatchesURL(url))
+      params.push_back(&item.params);
+  }
+  return params;
+}
+
 void URLSanitizerService::Initialize(const std::string& json) {
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()}, base::BindOnce(&ParseFromJson, json),
@@ -109,69 +177,61 @@ void URLSanitizerService::Initialize(const std::string& json) {
                      weak_factory_.GetWeakPtr()));
 }
 
-void URLSanitizerService::UpdateMatchers(
-    base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> mappings) {
-  matchers_ = std::move(mappings);
+void URLSanitizerService::UpdateMatchers(RuleIndex matchers) {
+  matchers_ = std::move(matchers);
   if (initialization_callback_for_testing_)
     std::move(initialization_callback_for_testing_).Run();
 }
 
 GURL URLSanitizerService::SanitizeURL(const GURL& initial_url) {
-  if (matchers_.empty() || !initial_url.SchemeIsHTTPOrHTTPS())
+  if (matchers_.empty() || !initial_url.SchemeIsHTTPOrHTTPS() ||
+      !initial_url.has_query()) {
     return initial_url;
-  GURL url = initial_url;
-  for (const auto& it : matchers_) {
-    if (!it->include.MatchesURL(url) || it->exclude.MatchesURL(url))
-      continue;
-    auto sanitized_query = StripQueryParameter(url.query(), it->params);
-    GURL::Replacements replacements;
-    if (!sanitized_query.empty()) {
-      replacements.SetQueryStr(sanitized_query);
-    } else {
-      replacements.ClearQuery();
-    }
-    url = url.ReplaceComponents(replacements);
   }
-  return url;
+  // Every rule is tested against the URL as given, and the params of all the
+  // rules that apply are stripped together.
+  const std::vector<const base::flat_set<std::string>*> trackers =
+      matchers_.GetParamsToStrip(initial_url);
+  if (trackers.empty())
+    return initial_url;
+
+  const base::StringPiece query = initial_url.query_piece();
+  const std::string sanitized_query =
+      query_filter::StripQueryParameters(
+          query,
+          [&trackers](base::StringPiece key) {
+            return base::ranges::any_of(trackers, [key](const auto* params) {
+              return params->contains(key);
+            });
+          })
+          .value_or(std::string(query));
+  if (!sanitized_query.empty() && sanitized_query == query)
+    return initial_url;
+
+  GURL::Replacements replacements;
+  if (!sanitized_query.empty()) {
+    replacements.SetQueryStr(sanitized_query);
+  } else {
+    replacements.ClearQuery();
+  }
+  return initial_url.ReplaceComponents(replacements);
 }
 
 void URLSanitizerService::OnRulesReady(const std::string& json_content) {
   Initialize(json_content);
 }
 
-// FIXME: merge with
-// browser/net/brave_site_hacks_network_delegate_helper.cc::StripQueryParameter()
 // Remove tracking query parameters from a GURL, leaving all
 // other parts untouched.
 std::string URLSanitizerService::StripQueryParameter(
     const std::string& query,
     const base::flat_set<std::string>& trackers) {
-  // We are using custom query string parsing code here. See
-  // https://github.com/brave/brave-core/pull/13726#discussion_r897712350
-  // for more information on why this approach was selected.
-  //
-  // Split query string by ampersands, remove tracking parameters,
-  // then join the remaining query parameters, untouched, back into
-  // a single query string.
-  const std::vector<std::string> input_kv_strings =
-      SplitString(query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
-  std::vector<std::string> output_kv_strings;
-  int disallowed_count = 0;
-  for (const std::string& kv_string : input_kv_strings) {
-    const std::vector<std::string> pieces = SplitString(
-        kv_string, "=", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-    const std::string& key = pieces.empty() ? std::string() : pieces[0];
-    if (pieces.size() >= 2 && trackers.count(key) == 1) {
-      ++disallowed_count;
-    } else {
-      output_kv_strings.push_back(kv_string);
-    }
-  }
-  if (disallowed_count > 0) {
-    return base::JoinString(output_kv_strings, "&");
-  } else {
-    return query;
-  }
+  return query_filter::StripQueryParameters(
+             query,
+             [&trackers](base::StringPiece key) {
+               return trackers.contains(key);
+             })
+      .value_or(query);
 }
 
 }  // namespace brave
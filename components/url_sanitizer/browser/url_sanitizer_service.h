@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
@@ -41,6 +42,36 @@ class URLSanitizerService : public KeyedService,
     base::flat_set<std::string> params;
   };
 
+  // The rules from the component, indexed by the hosts their include patterns
+  // can match so that a URL is only tested against the rules that may apply.
+  class RuleIndex {
+   public:
+    RuleIndex();
+    explicit RuleIndex(std::vector<std::unique_ptr<MatchItem>> items);
+    RuleIndex(RuleIndex&&);
+    RuleIndex& operator=(RuleIndex&&);
+    ~RuleIndex();
+
+    bool empty() const { return items_.empty(); }
+
+    // Returns the params of every rule that applies to |url|, or an empty list
+    // if none does.
+    std::vector<const base::flat_set<std::string>*> GetParamsToStrip(
+        const GURL& url) const;
+
+   private:
+    // Maps a host to the indices in |items_| of the rules for it.
+    using HostBuckets = base::flat_map<std::string, std::vector<size_t>>;
+
+    std::vector<std::unique_ptr<MatchItem>> items_;
+    // Rules with a pattern for exactly this host.
+    HostBuckets hosts_;
+    // Rules with a pattern for this host and all of its subdomains.
+    HostBuckets domains_;
+    // Rules with a pattern that matches any host.
+    std::vector<size_t> any_host_;
+  };
+
   GURL SanitizeURL(const GURL& url);
 
   void SetInitializationCallbackForTesting(base::OnceClosure callback) {
@@ -52,14 +83,13 @@ class URLSanitizerService : public KeyedService,
  protected:
   friend class URLSanitizerServiceUnitTest;
 
-  void UpdateMatchers(
-      base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>>);
+  void UpdateMatchers(RuleIndex matchers);
 
   std::string StripQueryParameter(const std::string& query,
                                   const base::flat_set<std::string>& trackers);
 
  private:
-  base::flat_set<std::unique_ptr<URLSanitizerService::MatchItem>> matchers_;
+  RuleIndex matchers_;
   base::OnceClosure initialization_callback_for_testing_;
   base::WeakPtrFactory<URLSanitizerService> weak_factory_{this};
 };
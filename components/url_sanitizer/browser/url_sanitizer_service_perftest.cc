@@ -0,0 +1,86 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/path_service.h"
+#include "base/run_loop.h"
+#include "base/strings/string_split.h"
+#include "base/test/task_environment.h"
+#include "base/threading/thread_restrictions.h"
+#include "base/time/time.h"
+#include "base/timer/lap_timer.h"
+#include "brave/components/constants/brave_paths.h"
+#include "brave/components/url_sanitizer/browser/url_sanitizer_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+constexpr char kMetricPrefixURLSanitizer[] = "URLSanitizer.";
+constexpr char kMetricSanitizeTime[] = "sanitize_time";
+
+constexpr int kWarmupRuns = 5;
+constexpr int kTimeCheckInterval = 10;
+constexpr base::TimeDelta kTimeLimit = base::Seconds(2);
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixURLSanitizer, story);
+  reporter.RegisterImportantMetric(kMetricSanitizeTime, "us");
+  return reporter;
+}
+
+std::string ReadTestData(const std::string& name) {
+  base::ScopedAllowBlockingForTesting allow_blocking;
+  base::FilePath path;
+  base::PathService::Get(brave::DIR_TEST_DATA, &path);
+  std::string contents;
+  EXPECT_TRUE(base::ReadFileToString(
+      path.AppendASCII("url-sanitizer-data").AppendASCII(name), &contents));
+  return contents;
+}
+
+}  // namespace
+
+// Sanitizes a corpus of real URLs with the shipped rules.
+TEST(URLSanitizerServicePerfTest, SanitizeCorpusOfRealURLs) {
+  base::test::TaskEnvironment task_environment;
+  URLSanitizerService service;
+  base::RunLoop loop;
+  service.SetInitializationCallbackForTesting(loop.QuitClosure());
+  service.Initialize(ReadTestData("clean-urls.json"));
+  loop.Run();
+
+  std::vector<GURL> urls;
+  for (const auto& spec :
+       base::SplitString(ReadTestData("urls.txt"), "\n",
+                         base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    urls.emplace_back(spec);
+  }
+  ASSERT_FALSE(urls.empty());
+
+  size_t sanitized = 0;
+  base::LapTimer timer(kWarmupRuns, kTimeLimit, kTimeCheckInterval);
+  do {
+    for (const auto& url : urls) {
+      if (service.SanitizeURL(url) != url)
+        ++sanitized;
+    }
+    timer.NextLap();
+  } while (!timer.HasTimeLimitExpired());
+  EXPECT_GT(sanitized, 0u);
+
+  auto reporter = SetUpReporter("real_urls");
+  reporter.AddResult(kMetricSanitizeTime,
+                     timer.TimePerLap() / static_cast<int>(urls.size()));
+}
+
+}  // namespace brave
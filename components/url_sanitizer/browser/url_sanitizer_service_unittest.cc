@@ -5,11 +5,22 @@
 
 #include "brave/components/url_sanitizer/browser/url_sanitizer_service.h"
 
+#include <string>
 #include <vector>
 
 #include "base/containers/flat_set.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/json/json_reader.h"
+#include "base/path_service.h"
 #include "base/run_loop.h"
+#include "base/strings/string_split.h"
 #include "base/test/task_environment.h"
+#include "base/threading/thread_restrictions.h"
+#include "base/values.h"
+#include "brave/components/constants/brave_paths.h"
+#include "extensions/common/url_pattern.h"
+#include "extensions/common/url_pattern_set.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "url/gurl.h"
 
@@ -51,6 +62,64 @@ const char kTestPatterns[] = R"(
   }
 ])";
 
+std::string ReadTestData(const std::string& name) {
+  base::ScopedAllowBlockingForTesting allow_blocking;
+  base::FilePath path;
+  base::PathService::Get(brave::DIR_TEST_DATA, &path);
+  std::string contents;
+  EXPECT_TRUE(base::ReadFileToString(
+      path.AppendASCII("url-sanitizer-data").AppendASCII(name), &contents));
+  return contents;
+}
+
+// Sanitizes |url| by testing it against every rule in |rules| instead of only
+// the ones indexed for its host.
+GURL ScanRules(const base::Value::List& rules, const GURL& url) {
+  base::flat_set<std::string> params;
+  for (const auto& rule : rules) {
+    const base::Value::Dict& dict = rule.GetDict();
+    std::string error;
+    extensions::URLPatternSet include;
+    extensions::URLPatternSet exclude;
+    EXPECT_TRUE(include.Populate(
+        *dict.FindList("include"),
+        URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, false, &error));
+    if (const auto* exclude_list = dict.FindList("exclude")) {
+      EXPECT_TRUE(exclude.Populate(
+          *exclude_list, URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
+          false, &error));
+    }
+    if (!include.MatchesURL(url) || exclude.MatchesURL(url))
+      continue;
+    for (const auto& param : *dict.FindList("params"))
+      params.insert(param.GetString());
+  }
+  if (params.empty())
+    return url;
+
+  std::vector<std::string> kept;
+  bool stripped = false;
+  for (const std::string& kv : base::SplitString(
+           url.query(), "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL)) {
+    const std::vector<std::string> pieces = base::SplitString(
+        kv, "=", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+    if (pieces.size() >= 2 && params.contains(pieces[0])) {
+      stripped = true;
+    } else {
+      kept.push_back(kv);
+    }
+  }
+  const std::string query = stripped ? base::JoinString(kept, "&")
+                                     : url.query();
+  GURL::Replacements replacements;
+  if (!query.empty()) {
+    replacements.SetQueryStr(query);
+  } else {
+    replacements.ClearQuery();
+  }
+  return url.ReplaceComponents(replacements);
+}
+
 }  // namespace
 
 class URLSanitizerServiceUnitTest : public testing::Test,
@@ -154,4 +223,36 @@ TEST_F(URLSanitizerServiceUnitTest, ClearURLS) {
             GURL("ws://localhost:8080/?utm_source=web"));
 }
 
+TEST_F(URLSanitizerServiceUnitTest, MatchesScanOfShippedRules) {
+  const std::string json = ReadTestData("clean-urls.json");
+  const auto rules = base::JSONReader::Read(json);
+  ASSERT_TRUE(rules && rules->is_list());
+  WaitInitialization(json);
+
+  const std::vector<std::string> urls =
+      base::SplitString(ReadTestData("urls.txt"), "\n",
+                        base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  ASSERT_FALSE(urls.empty());
+  for (const auto& spec : urls) {
+    const GURL url(spec);
+    EXPECT_EQ(ScanRules(rules->GetList(), url), SanitizeURL(url)) << spec;
+  }
+}
+
+TEST_F(URLSanitizerServiceUnitTest, SanitizeCorpusOfRealURLs) {
+  WaitInitialization(ReadTestData("clean-urls.json"));
+
+  size_t sanitized = 0;
+  for (const auto& spec :
+       base::SplitString(ReadTestData("urls.txt"), "\n",
+                         base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    const GURL url(spec);
+    const GURL sanitized_url = SanitizeURL(url);
+    EXPECT_TRUE(sanitized_url.is_valid()) << spec;
+    if (sanitized_url != url)
+      ++sanitized;
+  }
+  EXPECT_GT(sanitized, 0u);
+}
+
 }  // namespace brave
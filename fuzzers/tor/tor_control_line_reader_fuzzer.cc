@@ -0,0 +1,45 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <fuzzer/FuzzedDataProvider.h>
+
+#include <string.h>
+
+#include <string>
+
+#include "base/check_op.h"
+#include "base/logging.h"
+#include "brave/components/tor/tor_control_line_reader.h"
+#include "net/base/io_buffer.h"
+
+struct Environment {
+  Environment() { logging::SetMinLogLevel(logging::LOG_FATAL); }
+};
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  static Environment env;
+
+  FuzzedDataProvider data_provider(data, size);
+  tor::TorControlLineReader reader;
+
+  // Feed the input in reads of random size, like a socket would.
+  while (data_provider.remaining_bytes()) {
+    const size_t read_size = data_provider.ConsumeIntegralInRange<size_t>(
+        1, static_cast<size_t>(reader.read_capacity()));
+    const std::string chunk = data_provider.ConsumeBytesAsString(read_size);
+    memcpy(reader.read_buffer()->data(), chunk.data(), chunk.size());
+
+    const auto result =
+        reader.DidRead(chunk.size(), [](base::StringPiece line) {
+          CHECK_EQ(line.find_first_of("\r\n"), base::StringPiece::npos);
+          return true;
+        });
+    if (result != tor::TorControlLineReader::Result::kOk) {
+      break;
+    }
+    CHECK_GT(reader.read_capacity(), 0);
+  }
+  return 0;
+}
@@ -0,0 +1,155 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_binary_writer.h"
+
+#include "base/check.h"
+#include "base/strings/string_number_conversions.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_utf8_adaptor.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+constexpr uint8_t kMagic[] = {'P', 'G', 'B'};
+
+void AppendVarint(Vector<uint8_t>& out, uint64_t value) {
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value) | 0x80);
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+size_t CountDataElements(xmlNodePtr element) {
+  size_t count = 0;
+  for (xmlNodePtr child = element->children; child; child = child->next) {
+    if (child->type == XML_ELEMENT_NODE) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+// GraphML ids are the item id after an "n" or "e".
+uint64_t GetItemIdProp(xmlNodePtr element, const char* name) {
+  xmlChar* value = xmlGetProp(element, BAD_CAST name);
+  uint64_t id = 0;
+  const bool parsed =
+      value && *value &&
+      base::StringToUint64(reinterpret_cast<const char*>(value) + 1, &id);
+  DCHECK(parsed) << name;
+  xmlFree(value);
+  return id;
+}
+
+}  // namespace
+
+GraphBinaryWriter::GraphBinaryWriter(GraphOutput* output)
+    : GraphWriter(output) {}
+
+GraphBinaryWriter::~GraphBinaryWriter() = default;
+
+void GraphBinaryWriter::WriteHeader(const GraphDescription& description) {
+  AppendVarint(description_, InternString(description.version));
+  AppendVarint(description_, InternString(description.about));
+  AppendVarint(description_, description.is_root ? 1 : 0);
+  AppendVarint(description_, InternString(description.frame_id));
+  AppendVarint(description_,
+               static_cast<uint64_t>(description.end_time.InMilliseconds()));
+
+  ForEachKeyDefinition([this](xmlNodePtr element) {
+    ++key_count_;
+    AppendVarint(keys_, InternProp(element, "id"));
+    AppendVarint(keys_, InternProp(element, "for"));
+    AppendVarint(keys_, InternProp(element, "attr.name"));
+    AppendVarint(keys_, InternProp(element, "attr.type"));
+  });
+}
+
+void GraphBinaryWriter::Finish() {
+  Vector<uint8_t> head;
+  head.Append(kMagic, sizeof(kMagic));
+  head.push_back(kFormatVersion);
+
+  AppendVarint(head, strings_.size());
+  for (const String& str : strings_) {
+    StringUTF8Adaptor utf8(
+        str, WTF::kStrictUTF8ConversionReplacingUnpairedSurrogatesWithFFFD);
+    AppendVarint(head, utf8.size());
+    head.Append(reinterpret_cast<const uint8_t*>(utf8.data()),
+                static_cast<wtf_size_t>(utf8.size()));
+  }
+  output()->Write(head);
+  output()->Write(description_);
+
+  Vector<uint8_t> count;
+  AppendVarint(count, key_count_);
+  output()->Write(count);
+  output()->Write(keys_);
+
+  count.clear();
+  AppendVarint(count, node_count_);
+  output()->Write(count);
+  output()->Write(nodes_);
+
+  count.clear();
+  AppendVarint(count, edge_count_);
+  output()->Write(count);
+  output()->Write(edges_);
+}
+
+void GraphBinaryWriter::EncodeElement(xmlNodePtr element) {
+  Vector<uint8_t>* out = nullptr;
+  if (xmlStrEqual(element->name, BAD_CAST "edge")) {
+    out = &edges_;
+    ++edge_count_;
+    AppendVarint(*out, GetItemIdProp(element, "id"));
+    AppendVarint(*out, GetItemIdProp(element, "source"));
+    AppendVarint(*out, GetItemIdProp(element, "target"));
+  } else {
+    DCHECK(xmlStrEqual(element->name, BAD_CAST "node"));
+    out = &nodes_;
+    ++node_count_;
+    AppendVarint(*out, GetItemIdProp(element, "id"));
+  }
+
+  AppendVarint(*out, CountDataElements(element));
+  for (xmlNodePtr child = element->children; child; child = child->next) {
+    if (child->type != XML_ELEMENT_NODE) {
+      continue;
+    }
+    AppendVarint(*out, InternProp(child, "key"));
+    xmlChar* content = xmlNodeGetContent(child);
+    AppendVarint(*out, InternXmlString(content));
+    xmlFree(content);
+  }
+}
+
+uint64_t GraphBinaryWriter::InternString(const String& str) {
+  // Null strings can't be hash keys, and are written as empty anyway.
+  const String key = str.IsNull() ? g_empty_string.GetString() : str;
+  auto result = string_indices_.insert(key, strings_.size());
+  if (result.is_new_entry) {
+    strings_.push_back(key);
+  }
+  return result.stored_value->value;
+}
+
+uint64_t GraphBinaryWriter::InternXmlString(const xmlChar* str) {
+  if (!str) {
+    return InternString(g_empty_string);
+  }
+  return InternString(String::FromUTF8(reinterpret_cast<const char*>(str)));
+}
+
+uint64_t GraphBinaryWriter::InternProp(xmlNodePtr element, const char* name) {
+  xmlChar* value = xmlGetProp(element, BAD_CAST name);
+  const uint64_t index = InternXmlString(value);
+  xmlFree(value);
+  return index;
+}
+
+}  // namespace brave_page_graph
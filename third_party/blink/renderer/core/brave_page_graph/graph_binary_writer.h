@@ -0,0 +1,79 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_BINARY_WRITER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_BINARY_WRITER_H_
+
+#include <libxml/tree.h>
+
+#include <stdint.h>
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace brave_page_graph {
+
+// Writes a compact binary form of the graph that holds the same information
+// as the GraphML export. Every integer is an unsigned LEB128 varint and every
+// string is an index into a table of distinct strings, so repeated URLs,
+// node types and attribute values are stored once.
+//
+//   magic           "PGB" followed by kFormatVersion (one byte)
+//   strings         count, then per string: byte length, UTF-8 bytes
+//   description     version, about, is_root (0 or 1), frame_id, end time
+//                   in ms; strings are table indices
+//   keys            count, then per key: id, for, attr.name, attr.type
+//   nodes           count, then per node: item id, attribute count, then
+//                   per attribute: key id, value
+//   edges           count, then per edge: item id, source node item id,
+//                   target node item id, attribute count, attributes as
+//                   for nodes
+//
+// GraphML node and edge ids are "n" and "e" followed by the item id. Use
+// tools/page_graph/page_graph_binary_to_graphml.py to turn a binary export
+// into GraphML for existing tools.
+//
+// Tables are only written by Finish(), since the string table has to come
+// first. Until then the records are kept in their encoded form.
+class CORE_EXPORT GraphBinaryWriter : public GraphWriter {
+ public:
+  static constexpr uint8_t kFormatVersion = 1;
+
+  explicit GraphBinaryWriter(GraphOutput* output);
+  ~GraphBinaryWriter() override;
+
+  // GraphWriter:
+  void WriteHeader(const GraphDescription& description) override;
+  void Finish() override;
+
+ protected:
+  // GraphWriter:
+  void EncodeElement(xmlNodePtr element) override;
+
+ private:
+  // Returns the string table index of |str|, adding it if needed.
+  uint64_t InternString(const String& str);
+  uint64_t InternXmlString(const xmlChar* str);
+  uint64_t InternProp(xmlNodePtr element, const char* name);
+
+  HashMap<String, uint64_t> string_indices_;
+  Vector<String> strings_;
+
+  Vector<uint8_t> description_;
+  uint64_t key_count_ = 0;
+  Vector<uint8_t> keys_;
+  uint64_t node_count_ = 0;
+  Vector<uint8_t> nodes_;
+  uint64_t edge_count_ = 0;
+  Vector<uint8_t> edges_;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_BINARY_WRITER_H_
@@ -17,7 +17,9 @@ EdgeAttribute::EdgeAttribute(GraphItemContext* context,
                              NodeHTMLElement* in_node,
                              const String& name,
                              const bool is_style)
-    : GraphEdge(context, out_node, in_node), name_(name), is_style_(is_style) {}
+    : GraphEdge(context, out_node, in_node),
+      name_(AtomicString(name)),
+      is_style_(is_style) {}
 
 EdgeAttribute::~EdgeAttribute() = default;
 
@@ -8,6 +8,7 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/graph_edge.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
+#include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace brave_page_graph {
@@ -24,7 +25,7 @@ class EdgeAttribute : public GraphEdge {
                 const bool is_style = false);
   ~EdgeAttribute() override;
 
-  const String& GetName() const { return name_; }
+  const AtomicString& GetName() const { return name_; }
   bool IsStyle() const { return is_style_; }
 
   ItemDesc GetItemDesc() const override;
@@ -38,7 +39,7 @@ class EdgeAttribute : public GraphEdge {
   virtual bool IsEdgeAttributeSet() const;
 
  private:
-  const String name_;
+  const AtomicString name_;
   const bool is_style_;
 };
 
@@ -7,6 +7,7 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_EDGE_EVENT_LISTENER_EDGE_EVENT_LISTENER_ADD_H_
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/event_listener/edge_event_listener_action.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
@@ -15,7 +16,7 @@ namespace brave_page_graph {
 class NodeActor;
 class NodeHTMLElement;
 
-class EdgeEventListenerAdd final : public EdgeEventListenerAction {
+class CORE_EXPORT EdgeEventListenerAdd final : public EdgeEventListenerAction {
  public:
   EdgeEventListenerAdd(GraphItemContext* context,
                        NodeActor* out_node,
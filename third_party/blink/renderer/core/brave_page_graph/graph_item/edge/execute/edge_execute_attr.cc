@@ -15,7 +15,7 @@ EdgeExecuteAttr::EdgeExecuteAttr(GraphItemContext* context,
                                  NodeScript* in_node,
                                  const String& attribute_name)
     : EdgeExecute(context, out_node, in_node),
-      attribute_name_(attribute_name) {}
+      attribute_name_(AtomicString(attribute_name)) {}
 
 EdgeExecuteAttr::~EdgeExecuteAttr() = default;
 
@@ -8,6 +8,7 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/execute/edge_execute.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
+#include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace brave_page_graph {
@@ -24,7 +25,7 @@ class EdgeExecuteAttr : public EdgeExecute {
 
   ~EdgeExecuteAttr() override;
 
-  const String& GetAttributeName() { return attribute_name_; }
+  const AtomicString& GetAttributeName() { return attribute_name_; }
 
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
@@ -35,7 +36,7 @@ class EdgeExecuteAttr : public EdgeExecute {
   bool IsEdgeExecuteAttr() const override;
 
  private:
-  const String attribute_name_;
+  const AtomicString attribute_name_;
 };
 
 }  // namespace brave_page_graph
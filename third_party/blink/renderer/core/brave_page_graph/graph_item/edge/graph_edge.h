@@ -7,13 +7,14 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_EDGE_GRAPH_EDGE_H_
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 
 namespace brave_page_graph {
 
 class GraphNode;
 
-class GraphEdge : public GraphItem {
+class CORE_EXPORT GraphEdge : public GraphItem {
  public:
   GraphEdge(GraphItemContext* context, GraphNode* out_node, GraphNode* in_node);
 
@@ -22,6 +23,11 @@ class GraphEdge : public GraphItem {
   GraphNode* GetOutNode() const { return out_node_; }
   GraphNode* GetInNode() const { return in_node_; }
 
+  // The next edge in the in edges of GetInNode() and the out edges of
+  // GetOutNode() respectively.
+  const GraphEdge* GetNextInEdge() const { return next_in_edge_; }
+  const GraphEdge* GetNextOutEdge() const { return next_out_edge_; }
+
   GraphMLId GetGraphMLId() const override;
   void AddGraphMLTag(xmlDocPtr doc, xmlNodePtr parent_node) const override;
   void AddGraphMLAttributes(xmlDocPtr doc,
@@ -48,9 +54,15 @@ class GraphEdge : public GraphItem {
   virtual bool IsEdgeTextChange() const;
 
  private:
+  friend class GraphNode;
+
   // These pointers are not owning: the GraphItemContext instance owns them.
   GraphNode* const out_node_;
   GraphNode* const in_node_;
+  // Set by the nodes when the edge is added to them. Nodes only ever see
+  // their edges as const, hence mutable.
+  mutable const GraphEdge* next_in_edge_ = nullptr;
+  mutable const GraphEdge* next_out_edge_ = nullptr;
 };
 
 }  // namespace brave_page_graph
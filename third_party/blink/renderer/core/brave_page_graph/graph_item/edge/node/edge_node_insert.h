@@ -7,6 +7,7 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_EDGE_NODE_EDGE_NODE_INSERT_H_
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/node/edge_node.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 
 namespace brave_page_graph {
@@ -15,7 +16,7 @@ class NodeActor;
 class NodeHTML;
 class NodeHTMLElement;
 
-class EdgeNodeInsert final : public EdgeNode {
+class CORE_EXPORT EdgeNodeInsert final : public EdgeNode {
  public:
   EdgeNodeInsert(GraphItemContext* context,
                  NodeActor* out_node,
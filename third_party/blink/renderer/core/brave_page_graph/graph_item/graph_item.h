@@ -11,12 +11,13 @@
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/types.h"
+#include "third_party/blink/renderer/core/core_export.h"
 
 namespace brave_page_graph {
 
 class GraphItemContext;
 
-class GraphItem {
+class CORE_EXPORT GraphItem {
  public:
   explicit GraphItem(GraphItemContext* context);
   virtual ~GraphItem();
@@ -0,0 +1,46 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item_arena.h"
+
+#include <algorithm>
+
+#include "base/bits.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item.h"
+
+namespace brave_page_graph {
+
+GraphItemArena::GraphItemArena() = default;
+
+GraphItemArena::~GraphItemArena() {
+  // Items may point at each other but don't touch one another when they are
+  // destroyed, so the order doesn't matter beyond being deterministic.
+  for (GraphItem* item : items_) {
+    item->~GraphItem();
+  }
+}
+
+void* GraphItemArena::Allocate(size_t size) {
+  size = base::bits::AlignUp(size, alignof(std::max_align_t));
+  if (size > remaining_) {
+    // Oversized items get a block of their own, leaving the current one in
+    // use.
+    const size_t block_size = std::max(size, kBlockSize);
+    // Not value-initialized, items are constructed in place anyway.
+    blocks_.push_back(std::unique_ptr<uint8_t[]>(new uint8_t[block_size]));
+    allocated_bytes_ += block_size;
+    if (block_size > kBlockSize) {
+      return blocks_.back().get();
+    }
+    next_ = blocks_.back().get();
+    remaining_ = block_size;
+  }
+  void* result = next_;
+  next_ += size;
+  remaining_ -= size;
+  return result;
+}
+
+}  // namespace brave_page_graph
@@ -0,0 +1,65 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_GRAPH_ITEM_ARENA_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_GRAPH_ITEM_ARENA_H_
+
+#include <stdint.h>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace brave_page_graph {
+
+class GraphItem;
+
+// Owns the items of a graph. Recording a page creates a very large number of
+// small nodes and edges that all live as long as the graph, so instead of
+// allocating each one separately they are placed back to back in large
+// blocks. Items are destroyed together with the arena.
+class CORE_EXPORT GraphItemArena {
+ public:
+  static constexpr size_t kBlockSize = 64 * 1024;
+
+  GraphItemArena();
+  ~GraphItemArena();
+
+  GraphItemArena(const GraphItemArena&) = delete;
+  GraphItemArena& operator=(const GraphItemArena&) = delete;
+
+  template <typename T, typename... Args>
+  T* New(Args&&... args) {
+    static_assert(std::is_base_of_v<GraphItem, T>,
+                  "GraphItemArena only holds graph items");
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "Over-aligned graph items are not supported");
+    T* item = new (Allocate(sizeof(T))) T(std::forward<Args>(args)...);
+    items_.push_back(item);
+    return item;
+  }
+
+  size_t item_count() const { return items_.size(); }
+  size_t allocated_bytes() const { return allocated_bytes_; }
+
+ private:
+  void* Allocate(size_t size);
+
+  Vector<std::unique_ptr<uint8_t[]>> blocks_;
+  uint8_t* next_ = nullptr;
+  size_t remaining_ = 0;
+  size_t allocated_bytes_ = 0;
+  // In creation order, for destruction.
+  Vector<GraphItem*> items_;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_GRAPH_ITEM_ARENA_H_
@@ -0,0 +1,133 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item_arena.h"
+
+#include <stdint.h>
+
+#include <cstddef>
+
+#include "base/bits.h"
+#include "base/time/time.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item_context.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+class TestGraphItemContext : public GraphItemContext {
+ public:
+  base::TimeTicks GetGraphStartTime() const override { return start_time_; }
+  GraphItemId GetNextGraphItemId() override { return ++last_id_; }
+
+ private:
+  const base::TimeTicks start_time_ = base::TimeTicks::Now();
+  GraphItemId last_id_ = 0;
+};
+
+// Records its id when it's destroyed.
+class TestNode : public GraphNode {
+ public:
+  TestNode(GraphItemContext* context, Vector<GraphItemId>* destroyed)
+      : GraphNode(context), destroyed_(destroyed) {}
+  ~TestNode() override { destroyed_->push_back(GetId()); }
+
+  ItemName GetItemName() const override { return "test node"; }
+
+ private:
+  Vector<GraphItemId>* destroyed_;
+};
+
+// Larger than a block of the arena.
+class LargeTestNode : public TestNode {
+ public:
+  using TestNode::TestNode;
+
+  uint8_t payload[GraphItemArena::kBlockSize] = {};
+};
+
+// How many TestNodes fit in a block.
+constexpr size_t kNodesPerBlock =
+    GraphItemArena::kBlockSize /
+    base::bits::AlignUp(sizeof(TestNode), alignof(std::max_align_t));
+
+bool IsAligned(const void* ptr) {
+  return reinterpret_cast<uintptr_t>(ptr) % alignof(std::max_align_t) == 0;
+}
+
+}  // namespace
+
+class PageGraphGraphItemArenaTest : public testing::Test {
+ protected:
+  TestGraphItemContext context_;
+  Vector<GraphItemId> destroyed_;
+};
+
+TEST_F(PageGraphGraphItemArenaTest, PlacesItemsInSharedBlocks) {
+  GraphItemArena arena;
+  EXPECT_EQ(0u, arena.item_count());
+  EXPECT_EQ(0u, arena.allocated_bytes());
+
+  TestNode* first = arena.New<TestNode>(&context_, &destroyed_);
+  TestNode* second = arena.New<TestNode>(&context_, &destroyed_);
+  EXPECT_EQ(2u, arena.item_count());
+  EXPECT_EQ(GraphItemArena::kBlockSize, arena.allocated_bytes());
+  EXPECT_TRUE(IsAligned(first));
+  EXPECT_TRUE(IsAligned(second));
+  EXPECT_NE(first, second);
+  EXPECT_EQ(1u, first->GetId());
+  EXPECT_EQ(2u, second->GetId());
+}
+
+TEST_F(PageGraphGraphItemArenaTest, StartsNewBlockWhenFull) {
+  GraphItemArena arena;
+  for (size_t i = 0; i < kNodesPerBlock; ++i) {
+    EXPECT_TRUE(IsAligned(arena.New<TestNode>(&context_, &destroyed_)));
+  }
+  EXPECT_EQ(GraphItemArena::kBlockSize, arena.allocated_bytes());
+
+  EXPECT_TRUE(IsAligned(arena.New<TestNode>(&context_, &destroyed_)));
+  EXPECT_EQ(kNodesPerBlock + 1, arena.item_count());
+  EXPECT_EQ(2 * GraphItemArena::kBlockSize, arena.allocated_bytes());
+}
+
+TEST_F(PageGraphGraphItemArenaTest, GivesOversizedItemsOwnBlock) {
+  GraphItemArena arena;
+  TestNode* before = arena.New<TestNode>(&context_, &destroyed_);
+  LargeTestNode* large = arena.New<LargeTestNode>(&context_, &destroyed_);
+  TestNode* after = arena.New<TestNode>(&context_, &destroyed_);
+
+  EXPECT_TRUE(IsAligned(large));
+  EXPECT_EQ(3u, arena.item_count());
+  EXPECT_GT(arena.allocated_bytes(), 2 * GraphItemArena::kBlockSize);
+
+  // The small items keep sharing the first block.
+  const auto* before_bytes = reinterpret_cast<const uint8_t*>(before);
+  const auto* after_bytes = reinterpret_cast<const uint8_t*>(after);
+  EXPECT_LT(before_bytes, after_bytes);
+  EXPECT_LT(after_bytes - before_bytes,
+            static_cast<ptrdiff_t>(GraphItemArena::kBlockSize));
+}
+
+TEST_F(PageGraphGraphItemArenaTest, DestroysItemsInCreationOrder) {
+  {
+    GraphItemArena arena;
+    for (size_t i = 0; i < 2 * kNodesPerBlock; ++i) {
+      arena.New<TestNode>(&context_, &destroyed_);
+    }
+    arena.New<LargeTestNode>(&context_, &destroyed_);
+    EXPECT_TRUE(destroyed_.empty());
+  }
+
+  ASSERT_EQ(2 * kNodesPerBlock + 1, destroyed_.size());
+  for (wtf_size_t i = 0; i < destroyed_.size(); ++i) {
+    EXPECT_EQ(i + 1, destroyed_[i]);
+  }
+}
+
+}  // namespace brave_page_graph
@@ -7,11 +7,12 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_NODE_ACTOR_NODE_PARSER_H_
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/actor/node_actor.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 
 namespace brave_page_graph {
 
-class NodeParser final : public NodeActor {
+class CORE_EXPORT NodeParser final : public NodeActor {
  public:
   explicit NodeParser(GraphItemContext* context);
   ~NodeParser() override;
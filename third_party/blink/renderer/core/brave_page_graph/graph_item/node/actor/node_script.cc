@@ -78,7 +78,7 @@ void NodeScript::AddInEdge(const GraphEdge* in_edge) {
       const auto& attributes = element->GetAttributes();
       const auto source = attributes.find("src");
       if (source != attributes.end()) {
-        url_ = source->value;
+        url_ = AtomicString(source->value);
       }
     }
   }
@@ -8,6 +8,7 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/actor/node_actor.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
+#include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace brave_page_graph {
@@ -22,8 +23,8 @@ class NodeScript : public NodeActor {
   ScriptId GetScriptId() const { return script_id_; }
   const ScriptData& GetScriptData() const { return script_data_; }
 
-  const String& GetURL() const { return url_; }
-  void SetURL(const String url) { url_ = url; }
+  const AtomicString& GetURL() const { return url_; }
+  void SetURL(const String& url) { url_ = AtomicString(url); }
 
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
@@ -39,7 +40,7 @@ class NodeScript : public NodeActor {
  private:
   const ScriptId script_id_;
   const ScriptData script_data_;
-  String url_;
+  AtomicString url_;
 };
 
 }  // namespace brave_page_graph
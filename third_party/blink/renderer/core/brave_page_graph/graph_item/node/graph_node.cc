@@ -5,6 +5,7 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
 
+#include "base/check.h"
 #include "base/strings/string_number_conversions.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/graph_edge.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
@@ -15,12 +16,29 @@ GraphNode::GraphNode(GraphItemContext* context) : GraphItem(context) {}
 
 GraphNode::~GraphNode() = default;
 
+GraphNode::EdgeRange::Iterator& GraphNode::EdgeRange::Iterator::operator++() {
+  edge_ = in_edges_ ? edge_->GetNextInEdge() : edge_->GetNextOutEdge();
+  return *this;
+}
+
 void GraphNode::AddInEdge(const GraphEdge* in_edge) {
-  in_edges_.push_back(in_edge);
+  DCHECK(!in_edge->next_in_edge_);
+  if (last_in_edge_) {
+    last_in_edge_->next_in_edge_ = in_edge;
+  } else {
+    first_in_edge_ = in_edge;
+  }
+  last_in_edge_ = in_edge;
 }
 
 void GraphNode::AddOutEdge(const GraphEdge* out_edge) {
-  out_edges_.push_back(out_edge);
+  DCHECK(!out_edge->next_out_edge_);
+  if (last_out_edge_) {
+    last_out_edge_->next_out_edge_ = out_edge;
+  } else {
+    first_out_edge_ = out_edge;
+  }
+  last_out_edge_ = out_edge;
 }
 
 GraphMLId GraphNode::GetGraphMLId() const {
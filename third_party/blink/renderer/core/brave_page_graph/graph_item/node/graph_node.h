@@ -7,20 +7,52 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_NODE_GRAPH_NODE_H_
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 
 namespace brave_page_graph {
 
 class GraphEdge;
 
-class GraphNode : public GraphItem {
+class CORE_EXPORT GraphNode : public GraphItem {
  public:
   explicit GraphNode(GraphItemContext* context);
 
   ~GraphNode() override;
 
-  const EdgeList& GetInEdges() const { return in_edges_; }
-  const EdgeList& GetOutEdges() const { return out_edges_; }
+  // The in or out edges of a node, in the order they were added. They are
+  // linked through the edges themselves rather than kept in vectors.
+  class EdgeRange {
+   public:
+    class CORE_EXPORT Iterator {
+     public:
+      Iterator(const GraphEdge* edge, bool in_edges)
+          : edge_(edge), in_edges_(in_edges) {}
+
+      const GraphEdge* operator*() const { return edge_; }
+      Iterator& operator++();
+      bool operator!=(const Iterator& other) const {
+        return edge_ != other.edge_;
+      }
+
+     private:
+      const GraphEdge* edge_;
+      bool in_edges_;
+    };
+
+    EdgeRange(const GraphEdge* first, bool in_edges)
+        : first_(first), in_edges_(in_edges) {}
+
+    Iterator begin() const { return Iterator(first_, in_edges_); }
+    Iterator end() const { return Iterator(nullptr, in_edges_); }
+
+   private:
+    const GraphEdge* first_;
+    bool in_edges_;
+  };
+
+  EdgeRange GetInEdges() const { return EdgeRange(first_in_edge_, true); }
+  EdgeRange GetOutEdges() const { return EdgeRange(first_out_edge_, false); }
 
   virtual void AddInEdge(const GraphEdge* in_edge);
   virtual void AddOutEdge(const GraphEdge* out_edge);
@@ -49,10 +81,12 @@ class GraphNode : public GraphItem {
  private:
   // Reminder to self:
   //   out_edge -> node -> in_edge
-  // These vectors do not own their references.  All nodes in the entire
-  // context are owned by the GraphItemContext instance.
-  EdgeList in_edges_;
-  EdgeList out_edges_;
+  // These do not own their references.  All items in the entire context are
+  // owned by the GraphItemContext instance.
+  const GraphEdge* first_in_edge_ = nullptr;
+  const GraphEdge* last_in_edge_ = nullptr;
+  const GraphEdge* first_out_edge_ = nullptr;
+  const GraphEdge* last_out_edge_ = nullptr;
 };
 
 }  // namespace brave_page_graph
@@ -0,0 +1,107 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
+
+#include <memory>
+
+#include "base/time/time.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/graph_edge.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item_context.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+class TestGraphItemContext : public GraphItemContext {
+ public:
+  base::TimeTicks GetGraphStartTime() const override { return start_time_; }
+  GraphItemId GetNextGraphItemId() override { return ++last_id_; }
+
+ private:
+  const base::TimeTicks start_time_ = base::TimeTicks::Now();
+  GraphItemId last_id_ = 0;
+};
+
+class TestNode : public GraphNode {
+ public:
+  using GraphNode::GraphNode;
+
+  ItemName GetItemName() const override { return "test node"; }
+};
+
+class TestEdge : public GraphEdge {
+ public:
+  using GraphEdge::GraphEdge;
+
+  ItemName GetItemName() const override { return "test edge"; }
+};
+
+Vector<const GraphEdge*> ToVector(GraphNode::EdgeRange edges) {
+  Vector<const GraphEdge*> result;
+  for (const GraphEdge* edge : edges) {
+    result.push_back(edge);
+  }
+  return result;
+}
+
+}  // namespace
+
+class PageGraphGraphNodeTest : public testing::Test {
+ protected:
+  // Adds the edge to its nodes, as PageGraph does.
+  TestEdge* AddEdge(TestNode* out_node, TestNode* in_node) {
+    edges_.push_back(std::make_unique<TestEdge>(&context_, out_node, in_node));
+    TestEdge* edge = edges_.back().get();
+    in_node->AddInEdge(edge);
+    out_node->AddOutEdge(edge);
+    return edge;
+  }
+
+  TestGraphItemContext context_;
+  TestNode a_{&context_};
+  TestNode b_{&context_};
+  TestNode c_{&context_};
+  Vector<std::unique_ptr<TestEdge>> edges_;
+};
+
+TEST_F(PageGraphGraphNodeTest, NoEdges) {
+  EXPECT_TRUE(ToVector(a_.GetInEdges()).empty());
+  EXPECT_TRUE(ToVector(a_.GetOutEdges()).empty());
+}
+
+TEST_F(PageGraphGraphNodeTest, EdgesInAddedOrder) {
+  const GraphEdge* a_to_b = AddEdge(&a_, &b_);
+  const GraphEdge* a_to_c = AddEdge(&a_, &c_);
+  const GraphEdge* c_to_b = AddEdge(&c_, &b_);
+  const GraphEdge* a_to_b_again = AddEdge(&a_, &b_);
+
+  EXPECT_EQ((Vector<const GraphEdge*>{a_to_b, a_to_c, a_to_b_again}),
+            ToVector(a_.GetOutEdges()));
+  EXPECT_TRUE(ToVector(a_.GetInEdges()).empty());
+
+  EXPECT_EQ((Vector<const GraphEdge*>{a_to_b, c_to_b, a_to_b_again}),
+            ToVector(b_.GetInEdges()));
+  EXPECT_TRUE(ToVector(b_.GetOutEdges()).empty());
+
+  EXPECT_EQ((Vector<const GraphEdge*>{a_to_c}), ToVector(c_.GetInEdges()));
+  EXPECT_EQ((Vector<const GraphEdge*>{c_to_b}), ToVector(c_.GetOutEdges()));
+}
+
+TEST_F(PageGraphGraphNodeTest, SelfEdge) {
+  const GraphEdge* a_to_a = AddEdge(&a_, &a_);
+  const GraphEdge* a_to_b = AddEdge(&a_, &b_);
+
+  // The in and out edge lists are linked separately through the same edge.
+  EXPECT_EQ((Vector<const GraphEdge*>{a_to_a}), ToVector(a_.GetInEdges()));
+  EXPECT_EQ((Vector<const GraphEdge*>{a_to_a, a_to_b}),
+            ToVector(a_.GetOutEdges()));
+  EXPECT_EQ(nullptr, a_to_a->GetNextInEdge());
+  EXPECT_EQ(a_to_b, a_to_a->GetNextOutEdge());
+}
+
+}  // namespace brave_page_graph
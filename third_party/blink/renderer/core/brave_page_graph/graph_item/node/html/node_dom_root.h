@@ -8,6 +8,7 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/html/node_html_element.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
+#include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace brave_page_graph {
@@ -18,8 +19,8 @@ class NodeDOMRoot final : public NodeHTMLElement {
               const blink::DOMNodeId dom_node_id,
               const String& tag_name);
 
-  void SetURL(const String& url) { url_ = url; }
-  const String& GetURL() const { return url_; }
+  void SetURL(const String& url) { url_ = AtomicString(url); }
+  const AtomicString& GetURL() const { return url_; }
 
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
@@ -30,7 +31,7 @@ class NodeDOMRoot final : public NodeHTMLElement {
   bool IsNodeDOMRoot() const override;
 
  private:
-  String url_;
+  AtomicString url_;
 };
 
 }  // namespace brave_page_graph
@@ -33,7 +33,7 @@ namespace brave_page_graph {
 NodeHTMLElement::NodeHTMLElement(GraphItemContext* context,
                                  const DOMNodeId dom_node_id,
                                  const String& tag_name)
-    : NodeHTML(context, dom_node_id), tag_name_(tag_name) {}
+    : NodeHTML(context, dom_node_id), tag_name_(AtomicString(tag_name)) {}
 
 NodeHTMLElement::~NodeHTMLElement() = default;
 
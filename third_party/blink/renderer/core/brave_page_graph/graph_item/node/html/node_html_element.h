@@ -9,7 +9,9 @@
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/html/node_html.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/types.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
+#include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 #include "third_party/blink/renderer/platform/wtf/hash_map.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
@@ -18,7 +20,7 @@ namespace brave_page_graph {
 
 class EdgeEventListenerAdd;
 
-class NodeHTMLElement : public NodeHTML {
+class CORE_EXPORT NodeHTMLElement : public NodeHTML {
  public:
   using Attributes = HashMap<String, String>;
 
@@ -27,7 +29,7 @@ class NodeHTMLElement : public NodeHTML {
                   const String& tag_name);
   ~NodeHTMLElement() override;
 
-  const String& TagName() const { return tag_name_; }
+  const AtomicString& TagName() const { return tag_name_; }
 
   const HTMLNodeList& GetChildNodes() const { return child_nodes_; }
 
@@ -54,7 +56,7 @@ class NodeHTMLElement : public NodeHTML {
   void AddInEdge(const GraphEdge* in_edge) override;
 
  private:
-  const String tag_name_;
+  const AtomicString tag_name_;
 
   HTMLNodeList child_nodes_;
 
@@ -7,12 +7,13 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_NODE_HTML_NODE_HTML_TEXT_H_
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/html/node_html.h"
+#include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace brave_page_graph {
 
-class NodeHTMLText final : public NodeHTML {
+class CORE_EXPORT NodeHTMLText final : public NodeHTML {
  public:
   NodeHTMLText(GraphItemContext* context,
                const blink::DOMNodeId dom_node_id,
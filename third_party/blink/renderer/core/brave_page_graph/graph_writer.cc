@@ -0,0 +1,63 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
+
+#include "base/check.h"
+#include "base/numerics/safe_conversions.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
+
+namespace brave_page_graph {
+
+GraphBufferOutput::GraphBufferOutput() = default;
+
+GraphBufferOutput::~GraphBufferOutput() = default;
+
+void GraphBufferOutput::Write(base::span<const uint8_t> bytes) {
+  buffer_.Append(bytes.data(), base::checked_cast<wtf_size_t>(bytes.size()));
+}
+
+GraphWriter::GraphWriter(GraphOutput* output)
+    : output_(output),
+      doc_(xmlNewDoc(BAD_CAST "1.0")),
+      scratch_(xmlNewDocNode(doc_, nullptr, BAD_CAST "graph", nullptr)) {
+  DCHECK(output_);
+}
+
+GraphWriter::~GraphWriter() {
+  xmlFreeNode(scratch_);
+  xmlFreeDoc(doc_);
+}
+
+void GraphWriter::WriteItem(const GraphItem& item) {
+  item.AddGraphMLTag(doc_, scratch_);
+  DCHECK(scratch_->children);
+  for (xmlNodePtr element = scratch_->children; element;
+       element = element->next) {
+    if (element->type == XML_ELEMENT_NODE) {
+      EncodeElement(element);
+    }
+  }
+  ClearScratch();
+}
+
+void GraphWriter::ForEachKeyDefinition(ElementCallback callback) {
+  for (const auto& graphml_attr : GetGraphMLAttrs()) {
+    graphml_attr.second->AddDefinitionNode(scratch_);
+    DCHECK(scratch_->children);
+    callback(scratch_->children);
+    ClearScratch();
+  }
+}
+
+void GraphWriter::ClearScratch() {
+  while (xmlNodePtr child = scratch_->children) {
+    xmlUnlinkNode(child);
+    xmlFreeNode(child);
+  }
+}
+
+}  // namespace brave_page_graph
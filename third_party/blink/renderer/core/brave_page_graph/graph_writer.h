@@ -0,0 +1,97 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_WRITER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_WRITER_H_
+
+#include <libxml/tree.h>
+
+#include <utility>
+
+#include "base/containers/span.h"
+#include "base/functional/function_ref.h"
+#include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace brave_page_graph {
+
+class GraphItem;
+
+// Graph level facts that are written before any node or edge.
+struct GraphDescription {
+  String version;
+  String about;
+  bool is_root = false;
+  String frame_id;
+  base::TimeDelta end_time;
+};
+
+// Receives an export as it's produced. Writers call Write() whenever a piece
+// is ready, so an output may pass it on instead of keeping all of it.
+class GraphOutput {
+ public:
+  virtual ~GraphOutput() = default;
+  virtual void Write(base::span<const uint8_t> bytes) = 0;
+};
+
+// Keeps the whole export in memory.
+class CORE_EXPORT GraphBufferOutput : public GraphOutput {
+ public:
+  GraphBufferOutput();
+  ~GraphBufferOutput() override;
+
+  // GraphOutput:
+  void Write(base::span<const uint8_t> bytes) override;
+
+  Vector<uint8_t> TakeBuffer() { return std::move(buffer_); }
+
+ private:
+  Vector<uint8_t> buffer_;
+};
+
+// Base for the export formats. Items are exported one at a time: each one
+// adds its GraphML elements to a scratch element, the format encodes them and
+// they're freed again, so the graph is never held as a whole DOM. An item may
+// add more than its own element, e.g. HTML elements add the structure and
+// event listener edges that aren't recorded as items.
+class CORE_EXPORT GraphWriter {
+ public:
+  explicit GraphWriter(GraphOutput* output);
+  virtual ~GraphWriter();
+
+  GraphWriter(const GraphWriter&) = delete;
+  GraphWriter& operator=(const GraphWriter&) = delete;
+
+  virtual void WriteHeader(const GraphDescription& description) = 0;
+  void WriteItem(const GraphItem& item);
+  virtual void Finish() = 0;
+
+ protected:
+  using ElementCallback = base::FunctionRef<void(xmlNodePtr element)>;
+
+  // Runs |callback| with the <key> element of every GraphML attribute.
+  void ForEachKeyDefinition(ElementCallback callback);
+
+  // Encodes a <node> or <edge> element.
+  virtual void EncodeElement(xmlNodePtr element) = 0;
+
+  xmlDocPtr doc() const { return doc_; }
+  GraphOutput* output() const { return output_; }
+
+ private:
+  // Unlinks and frees whatever was added to |scratch_|.
+  void ClearScratch();
+
+  const raw_ptr<GraphOutput> output_;
+  const xmlDocPtr doc_;
+  const xmlNodePtr scratch_;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_WRITER_H_
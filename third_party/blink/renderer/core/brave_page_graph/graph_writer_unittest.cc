@@ -0,0 +1,185 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
+
+#include <string>
+
+#include "base/check.h"
+#include "base/time/time.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_binary_writer.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/event_listener/edge_event_listener_add.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/graph_edge.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/node/edge_node_insert.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/actor/node_parser.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/html/node_html_element.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/html/node_html_text.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml_writer.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/page_graph_context.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+// Wires up edges the way PageGraph does, without a document.
+class TestGraphContext : public PageGraphContext {
+ public:
+  base::TimeTicks GetGraphStartTime() const override { return start_time_; }
+  GraphItemId GetNextGraphItemId() override { return ++last_id_; }
+  GraphItemArena& GetGraphItemArena() override { return arena_; }
+
+  void AddGraphItem(GraphItem* graph_item) override {
+    if (auto* edge = blink::DynamicTo<GraphEdge>(graph_item)) {
+      edge->GetInNode()->AddInEdge(edge);
+      edge->GetOutNode()->AddOutEdge(edge);
+    }
+    items_.push_back(graph_item);
+  }
+
+  const Vector<GraphItem*>& items() const { return items_; }
+
+ private:
+  const base::TimeTicks start_time_ = base::TimeTicks::Now();
+  GraphItemId last_id_ = 0;
+  GraphItemArena arena_;
+  Vector<GraphItem*> items_;
+};
+
+// Reads the unsigned LEB128 varints of a binary export.
+class VarintReader {
+ public:
+  explicit VarintReader(const Vector<uint8_t>& buffer) : buffer_(buffer) {}
+
+  uint64_t Read() {
+    uint64_t value = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(offset_, buffer_.size());
+      const uint8_t byte = buffer_[offset_++];
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if (!(byte & 0x80)) {
+        return value;
+      }
+    }
+  }
+
+  void Skip(uint64_t bytes) { offset_ += bytes; }
+
+  bool AtEnd() const { return offset_ == buffer_.size(); }
+
+ private:
+  const Vector<uint8_t>& buffer_;
+  wtf_size_t offset_ = 0;
+};
+
+}  // namespace
+
+class PageGraphGraphWriterTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    // A parsed <div> with a <span> and a text child and one click listener.
+    // Its structure and listener edges are only added when it's exported.
+    auto* parser = context_.AddNode<NodeParser>();
+    auto* div = context_.AddNode<NodeHTMLElement>(1, "div");
+    auto* span = context_.AddNode<NodeHTMLElement>(2, "span");
+    auto* text = context_.AddNode<NodeHTMLText>(3, "text");
+    context_.AddEdge<EdgeNodeInsert>(parser, span, div);
+    context_.AddEdge<EdgeNodeInsert>(parser, text, div, span);
+    context_.AddEdge<EdgeEventListenerAdd>(parser, div, "click", 1, parser);
+  }
+
+  Vector<uint8_t> Export(GraphWriter& writer, GraphBufferOutput& output) {
+    writer.WriteHeader(GraphDescription());
+    for (const GraphItem* item : context_.items()) {
+      writer.WriteItem(*item);
+    }
+    writer.Finish();
+    return output.TakeBuffer();
+  }
+
+  TestGraphContext context_;
+};
+
+// 3 recorded insert and listener edges, 2 structure edges for the children
+// of the div and 1 edge for its listener.
+constexpr size_t kExpectedNodeCount = 4;
+constexpr size_t kExpectedEdgeCount = 6;
+
+TEST_F(PageGraphGraphWriterTest, GraphMLHasEveryEdge) {
+  GraphBufferOutput output;
+  GraphMLWriter writer(&output);
+  const Vector<uint8_t> buffer = Export(writer, output);
+  const std::string graphml(buffer.begin(), buffer.end());
+
+  size_t node_count = 0;
+  for (size_t pos = graphml.find("<node "); pos != std::string::npos;
+       pos = graphml.find("<node ", pos + 1)) {
+    ++node_count;
+  }
+  size_t edge_count = 0;
+  for (size_t pos = graphml.find("<edge "); pos != std::string::npos;
+       pos = graphml.find("<edge ", pos + 1)) {
+    ++edge_count;
+  }
+  EXPECT_EQ(kExpectedNodeCount, node_count);
+  EXPECT_EQ(kExpectedEdgeCount, edge_count);
+}
+
+TEST_F(PageGraphGraphWriterTest, BinaryHasEveryEdge) {
+  GraphBufferOutput output;
+  GraphBinaryWriter writer(&output);
+  const Vector<uint8_t> buffer = Export(writer, output);
+
+  ASSERT_GE(buffer.size(), 4u);
+  EXPECT_EQ('P', buffer[0]);
+  EXPECT_EQ('G', buffer[1]);
+  EXPECT_EQ('B', buffer[2]);
+  EXPECT_EQ(GraphBinaryWriter::kFormatVersion, buffer[3]);
+
+  VarintReader reader(buffer);
+  reader.Skip(4);
+
+  const uint64_t string_count = reader.Read();
+  for (uint64_t i = 0; i < string_count; ++i) {
+    reader.Skip(reader.Read());
+  }
+
+  // version, about, is_root, frame_id, end time.
+  for (int i = 0; i < 5; ++i) {
+    reader.Read();
+  }
+
+  const uint64_t key_count = reader.Read();
+  for (uint64_t i = 0; i < key_count * 4; ++i) {
+    reader.Read();
+  }
+
+  const uint64_t node_count = reader.Read();
+  EXPECT_EQ(kExpectedNodeCount, node_count);
+  for (uint64_t i = 0; i < node_count; ++i) {
+    reader.Read();
+    const uint64_t attribute_count = reader.Read();
+    for (uint64_t j = 0; j < attribute_count * 2; ++j) {
+      reader.Read();
+    }
+  }
+
+  const uint64_t edge_count = reader.Read();
+  EXPECT_EQ(kExpectedEdgeCount, edge_count);
+  for (uint64_t i = 0; i < edge_count; ++i) {
+    // The edge, source and target ids.
+    for (int j = 0; j < 3; ++j) {
+      reader.Read();
+    }
+    const uint64_t attribute_count = reader.Read();
+    for (uint64_t j = 0; j < attribute_count * 2; ++j) {
+      reader.Read();
+    }
+  }
+  EXPECT_TRUE(reader.AtEnd());
+}
+
+}  // namespace brave_page_graph
@@ -0,0 +1,103 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml_writer.h"
+
+#include <libxml/xmlIO.h>
+#include <libxml/xmlsave.h>
+
+#include "base/check.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/strings/string_number_conversions.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/libxml_utils.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+constexpr char kEncoding[] = "UTF-8";
+
+constexpr char kProlog[] =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\" "
+    "xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+    "xsi:schemaLocation=\"http://graphml.graphdrawing.org/xmlns "
+    "http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd\">";
+constexpr char kGraphStart[] = "<graph id=\"G\" edgedefault=\"directed\">";
+constexpr char kGraphEnd[] = "</graph></graphml>\n";
+
+}  // namespace
+
+GraphMLWriter::GraphMLWriter(GraphOutput* output)
+    : GraphWriter(output),
+      buffer_(xmlOutputBufferCreateIO(&GraphMLWriter::OnWrite,
+                                      nullptr,
+                                      output,
+                                      nullptr)) {
+  CHECK(buffer_);
+}
+
+GraphMLWriter::~GraphMLWriter() {
+  xmlOutputBufferClose(buffer_);
+}
+
+void GraphMLWriter::WriteHeader(const GraphDescription& description) {
+  WriteString(kProlog);
+
+  xmlNodePtr desc_node =
+      xmlNewDocNode(doc(), nullptr, BAD_CAST "desc", nullptr);
+  xmlNewTextChild(desc_node, nullptr, BAD_CAST "version",
+                  XmlUtf8String(description.version).get());
+  xmlNewTextChild(desc_node, nullptr, BAD_CAST "about",
+                  XmlUtf8String(description.about).get());
+  xmlNewTextChild(desc_node, nullptr, BAD_CAST "is_root",
+                  BAD_CAST(description.is_root ? "true" : "false"));
+  xmlNewTextChild(desc_node, nullptr, BAD_CAST "frame_id",
+                  XmlUtf8String(description.frame_id).get());
+
+  xmlNodePtr time_container_node =
+      xmlNewChild(desc_node, nullptr, BAD_CAST "time", nullptr);
+  xmlNewTextChild(time_container_node, nullptr, BAD_CAST "start",
+                  BAD_CAST base::NumberToString(0).c_str());
+  xmlNewTextChild(
+      time_container_node, nullptr, BAD_CAST "end",
+      BAD_CAST base::NumberToString(description.end_time.InMilliseconds())
+          .c_str());
+
+  WriteElement(desc_node);
+  xmlFreeNode(desc_node);
+
+  ForEachKeyDefinition(
+      [this](xmlNodePtr element) { WriteElement(element); });
+
+  WriteString(kGraphStart);
+}
+
+void GraphMLWriter::Finish() {
+  WriteString(kGraphEnd);
+  xmlOutputBufferFlush(buffer_);
+}
+
+void GraphMLWriter::EncodeElement(xmlNodePtr element) {
+  WriteElement(element);
+}
+
+// static
+int GraphMLWriter::OnWrite(void* context, const char* buffer, int len) {
+  static_cast<GraphOutput*>(context)->Write(base::as_bytes(
+      base::make_span(buffer, base::checked_cast<size_t>(len))));
+  return len;
+}
+
+void GraphMLWriter::WriteString(base::StringPiece str) {
+  xmlOutputBufferWrite(buffer_, base::checked_cast<int>(str.size()),
+                       str.data());
+}
+
+void GraphMLWriter::WriteElement(xmlNodePtr element) {
+  xmlNodeDumpOutput(buffer_, doc(), element, 0, 0, kEncoding);
+}
+
+}  // namespace brave_page_graph
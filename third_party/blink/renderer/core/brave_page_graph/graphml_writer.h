@@ -0,0 +1,43 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPHML_WRITER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPHML_WRITER_H_
+
+#include <libxml/tree.h>
+
+#include "base/strings/string_piece.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
+#include "third_party/blink/renderer/core/core_export.h"
+
+namespace brave_page_graph {
+
+// Writes GraphML. Each element is serialized straight into a libxml output
+// buffer that flushes to the GraphOutput in small chunks as it fills up.
+class CORE_EXPORT GraphMLWriter : public GraphWriter {
+ public:
+  explicit GraphMLWriter(GraphOutput* output);
+  ~GraphMLWriter() override;
+
+  // GraphWriter:
+  void WriteHeader(const GraphDescription& description) override;
+  void Finish() override;
+
+ protected:
+  // GraphWriter:
+  void EncodeElement(xmlNodePtr element) override;
+
+ private:
+  static int OnWrite(void* context, const char* buffer, int len);
+
+  void WriteString(base::StringPiece str);
+  void WriteElement(xmlNodePtr element);
+
+  xmlOutputBufferPtr buffer_;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPHML_WRITER_H_
@@ -5,8 +5,6 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/page_graph.h"
 
-#include <libxml/tree.h>
-
 #include <signal.h>
 #include <climits>
 #include <iostream>
@@ -24,6 +22,7 @@
 #include "base/ranges/algorithm.h"
 #include "brave/components/brave_page_graph/common/features.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_binary_writer.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/attribute/edge_attribute_delete.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/attribute/edge_attribute_set.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/binding/edge_binding.h"
@@ -79,8 +78,8 @@
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_localstorage.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_root.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_sessionstorage.h"
-#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
-#include "brave/third_party/blink/renderer/core/brave_page_graph/libxml_utils.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml_writer.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/request_tracker.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/tracked_request.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/scripts/script_tracker.h"
@@ -181,7 +180,6 @@ using brave_page_graph::NodeTrackerFilter;
 using brave_page_graph::NormalizeUrl;
 using brave_page_graph::ScriptId;
 using brave_page_graph::TrackedRequest;
-using brave_page_graph::XmlUtf8String;
 
 namespace blink {
 
@@ -883,10 +881,11 @@ GraphItemId PageGraph::GetNextGraphItemId() {
   return ++id_counter_;
 }
 
-void PageGraph::AddGraphItem(std::unique_ptr<GraphItem> graph_item) {
-  GraphItem* item = graph_item.get();
-  graph_items_.push_back(std::move(graph_item));
+brave_page_graph::GraphItemArena& PageGraph::GetGraphItemArena() {
+  return graph_items_;
+}
 
+void PageGraph::AddGraphItem(GraphItem* item) {
   if (auto* graph_node = DynamicTo<GraphNode>(item)) {
     nodes_.push_back(graph_node);
     if (auto* element_node = DynamicTo<NodeHTMLElement>(graph_node)) {
@@ -973,68 +972,42 @@ void PageGraph::GenerateReportForNode(const blink::DOMNodeId node_id,
 }
 
 String PageGraph::ToGraphML() const {
-  xmlDocPtr graphml_doc = xmlNewDoc(BAD_CAST "1.0");
-  xmlNodePtr graphml_root_node = xmlNewNode(nullptr, BAD_CAST "graphml");
-  xmlDocSetRootElement(graphml_doc, graphml_root_node);
-
-  xmlNewNs(graphml_root_node, BAD_CAST "http://graphml.graphdrawing.org/xmlns",
-           nullptr);
-  xmlNsPtr xsi_ns = xmlNewNs(
-      graphml_root_node, BAD_CAST "http://www.w3.org/2001/XMLSchema-instance",
-      BAD_CAST "xsi");
-  xmlNewNsProp(graphml_root_node, xsi_ns, BAD_CAST "schemaLocation",
-               BAD_CAST
-               "http://graphml.graphdrawing.org/xmlns "
-               "http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd");
-
-  xmlNodePtr desc_container_node =
-      xmlNewChild(graphml_root_node, nullptr, BAD_CAST "desc", nullptr);
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "version",
-                  BAD_CAST kPageGraphVersion);
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "about",
-                  BAD_CAST kPageGraphUrl);
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "is_root",
-                  BAD_CAST(IsRootFrame() ? "true" : "false"));
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "frame_id",
-                  XmlUtf8String(frame_id_).get());
-
-  xmlNodePtr time_container_node =
-      xmlNewChild(desc_container_node, nullptr, BAD_CAST "time", nullptr);
-
-  xmlNewTextChild(time_container_node, nullptr, BAD_CAST "start",
-                  BAD_CAST base::NumberToString(0).c_str());
-
-  const base::TimeDelta end_time = base::TimeTicks::Now() - start_;
-  xmlNewTextChild(
-      time_container_node, nullptr, BAD_CAST "end",
-      BAD_CAST base::NumberToString(end_time.InMilliseconds()).c_str());
-
-  for (const auto& graphml_attr : brave_page_graph::GetGraphMLAttrs()) {
-    graphml_attr.second->AddDefinitionNode(graphml_root_node);
-  }
-
-  xmlNodePtr graph_node =
-      xmlNewChild(graphml_root_node, nullptr, BAD_CAST "graph", nullptr);
-  xmlSetProp(graph_node, BAD_CAST "id", BAD_CAST "G");
-  xmlSetProp(graph_node, BAD_CAST "edgedefault", BAD_CAST "directed");
+  brave_page_graph::GraphBufferOutput output;
+  {
+    brave_page_graph::GraphMLWriter writer(&output);
+    WriteGraph(writer);
+  }
+  const Vector<uint8_t> graphml = output.TakeBuffer();
+  auto graphml_string = String::FromUTF8(graphml.data(), graphml.size());
+  DCHECK(!graphml_string.empty());
+  return graphml_string;
+}
+
+Vector<uint8_t> PageGraph::ToBinary() const {
+  brave_page_graph::GraphBufferOutput output;
+  {
+    brave_page_graph::GraphBinaryWriter writer(&output);
+    WriteGraph(writer);
+  }
+  return output.TakeBuffer();
+}
+
+void PageGraph::WriteGraph(GraphWriter& writer) const {
+  brave_page_graph::GraphDescription description;
+  description.version = kPageGraphVersion;
+  description.about = kPageGraphUrl;
+  description.is_root = IsRootFrame();
+  description.frame_id = frame_id_;
+  description.end_time = base::TimeTicks::Now() - start_;
+  writer.WriteHeader(description);
 
   for (const auto* node : nodes_) {
-    node->AddGraphMLTag(graphml_doc, graph_node);
+    writer.WriteItem(*node);
   }
   for (const auto* edge : edges_) {
-    edge->AddGraphMLTag(graphml_doc, graph_node);
+    writer.WriteItem(*edge);
   }
-
-  xmlChar* xml_string;
-  int size;
-  xmlDocDumpMemoryEnc(graphml_doc, &xml_string, &size, "UTF-8");
-  auto graphml_string = String::FromUTF8(xml_string, size);
-  DCHECK(!graphml_string.empty());
-
-  xmlFree(xml_string);
-  xmlFree(graphml_doc);
-
-  return graphml_string;
+  writer.Finish();
 }
 
 NodeHTML* PageGraph::GetHTMLNode(const DOMNodeId node_id) const {
@@ -12,6 +12,7 @@
 
 #include "base/time/time.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/blink_probe_types.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item_arena.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/page_graph_context.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/request_tracker.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/scripts/script_tracker.h"
@@ -40,6 +41,7 @@ namespace brave_page_graph {
 
 class GraphEdge;
 class GraphNode;
+class GraphWriter;
 class NodeActor;
 class NodeAdFilter;
 class NodeBinding;
@@ -224,12 +226,14 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
   // PageGraphContext:
   base::TimeTicks GetGraphStartTime() const override;
   brave_page_graph::GraphItemId GetNextGraphItemId() override;
-  void AddGraphItem(
-      std::unique_ptr<brave_page_graph::GraphItem> graph_item) override;
+  brave_page_graph::GraphItemArena& GetGraphItemArena() override;
+  void AddGraphItem(brave_page_graph::GraphItem* graph_item) override;
 
   void GenerateReportForNode(const blink::DOMNodeId node_id,
                              blink::protocol::Array<String>& report);
   String ToGraphML() const;
+  // Compact alternative to ToGraphML(), see GraphBinaryWriter for the format.
+  Vector<uint8_t> ToBinary() const;
 
  private:
 #define PAGE_GRAPH_USING_DECL(type) using type = brave_page_graph::type
@@ -241,8 +245,8 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
   PAGE_GRAPH_USING_DECL(FingerprintingRule);
   PAGE_GRAPH_USING_DECL(GraphEdge);
   PAGE_GRAPH_USING_DECL(GraphItemId);
-  PAGE_GRAPH_USING_DECL(GraphItemUniquePtrList);
   PAGE_GRAPH_USING_DECL(GraphNode);
+  PAGE_GRAPH_USING_DECL(GraphWriter);
   PAGE_GRAPH_USING_DECL(InspectorId);
   PAGE_GRAPH_USING_DECL(MethodName);
   PAGE_GRAPH_USING_DECL(NodeActor);
@@ -427,6 +431,9 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
   // frame tree.
   bool IsRootFrame() const;
 
+  // Writes the whole graph through |writer|, one item at a time.
+  void WriteGraph(GraphWriter& writer) const;
+
   // The blink assigned frame id for the local root's frame.
   const String frame_id_;
   // Script tracker helper.
@@ -440,10 +447,10 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
   // the graph's construction if needed.
   GraphItemId id_counter_ = 0;
 
-  // These vectors own all of the items that are shared and indexed across
-  // the rest of the graph.  All the other pointers (the weak pointers)
-  // do not own their data.
-  GraphItemUniquePtrList graph_items_;
+  // Owns all of the items that are shared and indexed across the rest of
+  // the graph.  All the other pointers (the weak pointers) do not own their
+  // data.
+  brave_page_graph::GraphItemArena graph_items_;
   EdgeList edges_;
   NodeList nodes_;
 
@@ -44,7 +44,6 @@ using MethodName = String;
 using RequestURL = blink::KURL;
 using InspectorId = uint64_t;
 
-using GraphItemUniquePtrList = Vector<std::unique_ptr<GraphItem>>;
 using EdgeList = Vector<const GraphEdge*>;
 using NodeList = Vector<GraphNode*>;
 using HTMLNodeList = Vector<NodeHTML*>;
@@ -10,6 +10,7 @@
 
 #include "brave/third_party/blink/renderer/brave_farbling_constants.h"
 #include "brave/third_party/blink/renderer/platform/brave_audio_farbling_helper.h"
+#include "brave/third_party/blink/renderer/platform/brave_canvas_farbling_helper.h"
 #include "third_party/abseil-cpp/absl/random/random.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/renderer/core/core_export.h"
@@ -98,6 +99,7 @@ class CORE_EXPORT BraveSessionCache final
   WTF::HashMap<FarbleKey, int> farbled_integers_;
   BraveFarblingLevel farbling_level_;
   absl::optional<blink::BraveAudioFarblingHelper> audio_farbling_helper_;
+  absl::optional<blink::BraveCanvasFarblingHelper> canvas_farbling_helper_;
 
   void PerturbPixelsInternal(const unsigned char* data, size_t size);
 };
@@ -7,6 +7,8 @@
 
 #include <limits.h>
 
+#include <algorithm>
+
 #include "third_party/blink/renderer/platform/audio/audio_utilities.h"
 
 namespace blink {
@@ -14,11 +16,78 @@ namespace {
 
 constexpr uint64_t zero = 0;
 constexpr double maxUInt64AsDouble = static_cast<double>(UINT64_MAX);
+constexpr double kMaxByteValue = UCHAR_MAX;
+// Number of LFSR states generated ahead before they are turned into samples,
+// and of samples the byte conversions farble at a time on the stack.
+constexpr size_t kBatchSize = 64;
 
 inline uint64_t lfsr_next(uint64_t v) {
   return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
 }
 
+// The kernels below keep the exact arithmetic of the original per-sample
+// loops (including the float/double conversions), so the output stays
+// bit-identical for the same seed. They are written as plain loops over
+// contiguous memory without branches or modulo indexing, which lets the
+// compiler vectorize them.
+
+void ScaleSamples(const float* source,
+                  float* destination,
+                  size_t len,
+                  double fudge_factor) {
+  for (size_t i = 0; i < len; ++i) {
+    destination[i] = source[i] * fudge_factor;
+  }
+}
+
+// Copies |len| samples of the ring buffer |input_buffer| starting at |start|
+// into |destination|, scaled by |fudge_factor|.
+void ScaleRingBufferSamples(const float* input_buffer,
+                            unsigned input_buffer_size,
+                            size_t start,
+                            float* destination,
+                            size_t len,
+                            double fudge_factor) {
+  size_t done = 0;
+  while (done < len) {
+    const size_t count = std::min(len - done, input_buffer_size - start);
+    ScaleSamples(input_buffer + start, destination + done, count,
+                 fudge_factor);
+    done += count;
+    start = 0;
+  }
+}
+
+// Fills |destination| with the noise used in max farbling mode, continuing
+// from the LFSR state |v|. The states are stepped in batches, which keeps the
+// serial dependency chain in a tight loop and the conversion to samples
+// vectorizable.
+void FillNoise(uint64_t& v, float* destination, size_t len) {
+  uint64_t states[kBatchSize];
+  for (size_t offset = 0; offset < len; offset += kBatchSize) {
+    const size_t count = std::min(kBatchSize, len - offset);
+    for (size_t i = 0; i < count; ++i) {
+      v = lfsr_next(v);
+      states[i] = v;
+    }
+    float* batch = destination + offset;
+    for (size_t i = 0; i < count; ++i) {
+      batch[i] = (states[i] / maxUInt64AsDouble) / 10;
+    }
+  }
+}
+
+// Scale from nominal -1 -> +1 to unsigned byte, clipped to the valid range.
+void ConvertToBytes(const float* source,
+                    unsigned char* destination,
+                    size_t len) {
+  for (size_t i = 0; i < len; ++i) {
+    double scaled_value = 128 * (source[i] + 1);
+    scaled_value = std::clamp(scaled_value, 0.0, kMaxByteValue);
+    destination[i] = static_cast<unsigned char>(scaled_value);
+  }
+}
+
 }  // namespace
 
 BraveAudioFarblingHelper::BraveAudioFarblingHelper(double fudge_factor,
@@ -32,14 +101,9 @@ void BraveAudioFarblingHelper::FarbleAudioChannel(float* dst,
                                                   size_t count) const {
   if (max_) {
     uint64_t v = seed_;
-    for (size_t i = 0; i < count; i++) {
-      v = lfsr_next(v);
-      dst[i] = (v / maxUInt64AsDouble) / 10;
-    }
+    FillNoise(v, dst, count);
   } else {
-    for (size_t i = 0; i < count; i++) {
-      dst[i] = dst[i] * fudge_factor_;
-    }
+    ScaleSamples(dst, dst, count, fudge_factor_);
   }
 }
 
@@ -53,21 +117,12 @@ void BraveAudioFarblingHelper::FarbleFloatTimeDomainData(
     unsigned input_buffer_size) const {
   if (max_) {
     uint64_t v = seed_;
-    for (size_t i = 0; i < len; ++i) {
-      v = lfsr_next(v);
-      float value = (v / maxUInt64AsDouble) / 10;
-      destination[i] = value;
-    }
+    FillNoise(v, destination, len);
   } else {
-    for (size_t i = 0; i < len; ++i) {
-      // Buffer access is protected due to modulo operation.
-      float value =
-          fudge_factor_ *
-          input_buffer[(i + write_index - fft_size + input_buffer_size) %
-                       input_buffer_size];
-
-      destination[i] = value;
-    }
+    ScaleRingBufferSamples(
+        input_buffer, input_buffer_size,
+        (write_index - fft_size + input_buffer_size) % input_buffer_size,
+        destination, len, fudge_factor_);
   }
 }
 
@@ -79,46 +134,20 @@ void BraveAudioFarblingHelper::FarbleByteTimeDomainData(
     unsigned write_index,
     unsigned fft_size,
     unsigned input_buffer_size) const {
-  if (max_) {
-    uint64_t v = seed_;
-    for (size_t i = 0; i < len; ++i) {
-      v = lfsr_next(v);
-      float value = (v / maxUInt64AsDouble) / 10;
-
-      // Scale from nominal -1 -> +1 to unsigned byte.
-      double scaled_value = 128 * (value + 1);
-
-      // Clip to valid range.
-      if (scaled_value < 0) {
-        scaled_value = 0;
-      }
-      if (scaled_value > UCHAR_MAX) {
-        scaled_value = UCHAR_MAX;
-      }
-
-      destination[i] = static_cast<unsigned char>(scaled_value);
-    }
-  } else {
-    for (size_t i = 0; i < len; ++i) {
-      // Buffer access is protected due to modulo operation.
-      float value =
-          fudge_factor_ *
-          input_buffer[(i + write_index - fft_size + input_buffer_size) %
-                       input_buffer_size];
-
-      // Scale from nominal -1 -> +1 to unsigned byte.
-      double scaled_value = 128 * (value + 1);
-
-      // Clip to valid range.
-      if (scaled_value < 0) {
-        scaled_value = 0;
-      }
-      if (scaled_value > UCHAR_MAX) {
-        scaled_value = UCHAR_MAX;
-      }
-
-      destination[i] = static_cast<unsigned char>(scaled_value);
+  uint64_t v = seed_;
+  size_t start =
+      (write_index - fft_size + input_buffer_size) % input_buffer_size;
+  float values[kBatchSize];
+  for (size_t offset = 0; offset < len; offset += kBatchSize) {
+    const size_t count = std::min(kBatchSize, len - offset);
+    if (max_) {
+      FillNoise(v, values, count);
+    } else {
+      ScaleRingBufferSamples(input_buffer, input_buffer_size, start, values,
+                             count, fudge_factor_);
+      start = (start + count) % input_buffer_size;
     }
+    ConvertToBytes(values, destination + offset, count);
   }
 }
 
@@ -129,47 +158,28 @@ void BraveAudioFarblingHelper::FarbleConvertToByteData(
     size_t len,
     double min_decibels,
     double range_scale_factor) const {
-  if (max_) {
-    uint64_t v = seed_;
-    for (size_t i = 0; i < len; ++i) {
-      v = lfsr_next(v);
-      float linear_value = (v / maxUInt64AsDouble) / 10;
-      double db_mag = audio_utilities::LinearToDecibels(linear_value);
-
-      // The range m_minDecibels to m_maxDecibels will be scaled to byte values
-      // from 0 to UCHAR_MAX.
-      double scaled_value =
-          UCHAR_MAX * (db_mag - min_decibels) * range_scale_factor;
-
-      // Clip to valid range.
-      if (scaled_value < 0) {
-        scaled_value = 0;
-      }
-      if (scaled_value > UCHAR_MAX) {
-        scaled_value = UCHAR_MAX;
-      }
-
-      destination[i] = static_cast<unsigned char>(scaled_value);
+  uint64_t v = seed_;
+  float linear_values[kBatchSize];
+  for (size_t offset = 0; offset < len; offset += kBatchSize) {
+    const size_t count = std::min(kBatchSize, len - offset);
+    if (max_) {
+      FillNoise(v, linear_values, count);
+    } else {
+      ScaleSamples(source + offset, linear_values, count, fudge_factor_);
     }
-  } else {
-    for (size_t i = 0; i < len; ++i) {
-      float linear_value = fudge_factor_ * source[i];
-      double db_mag = audio_utilities::LinearToDecibels(linear_value);
 
-      // The range m_minDecibels to m_maxDecibels will be scaled to byte values
-      // from 0 to UCHAR_MAX.
+    for (size_t i = 0; i < count; ++i) {
+      double db_mag = audio_utilities::LinearToDecibels(linear_values[i]);
+
+      // The range m_minDecibels to m_maxDecibels will be scaled to byte
+      // values from 0 to UCHAR_MAX.
       double scaled_value =
           UCHAR_MAX * (db_mag - min_decibels) * range_scale_factor;
 
       // Clip to valid range.
-      if (scaled_value < 0) {
-        scaled_value = 0;
-      }
-      if (scaled_value > UCHAR_MAX) {
-        scaled_value = UCHAR_MAX;
-      }
-
-      destination[i] = static_cast<unsigned char>(scaled_value);
+      scaled_value = std::clamp(scaled_value, 0.0, kMaxByteValue);
+
+      destination[offset + i] = static_cast<unsigned char>(scaled_value);
     }
   }
 }
@@ -180,18 +190,13 @@ void BraveAudioFarblingHelper::FarbleConvertFloatToDb(const float* source,
                                                       size_t len) const {
   if (max_) {
     uint64_t v = seed_;
-    for (size_t i = 0; i < len; ++i) {
-      v = lfsr_next(v);
-      float linear_value = (v / maxUInt64AsDouble) / 10;
-      double db_mag = audio_utilities::LinearToDecibels(linear_value);
-      destination[i] = static_cast<float>(db_mag);
-    }
+    FillNoise(v, destination, len);
   } else {
-    for (size_t i = 0; i < len; ++i) {
-      float linear_value = fudge_factor_ * source[i];
-      double db_mag = audio_utilities::LinearToDecibels(linear_value);
-      destination[i] = static_cast<float>(db_mag);
-    }
+    ScaleSamples(source, destination, len, fudge_factor_);
+  }
+  for (size_t i = 0; i < len; ++i) {
+    double db_mag = audio_utilities::LinearToDecibels(destination[i]);
+    destination[i] = static_cast<float>(db_mag);
   }
 }
 
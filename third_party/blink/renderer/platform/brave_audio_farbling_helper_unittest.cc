@@ -0,0 +1,163 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/platform/brave_audio_farbling_helper.h"
+
+#include <limits.h>
+#include <stdint.h>
+
+#include <cmath>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/audio/audio_utilities.h"
+
+namespace blink {
+
+namespace {
+
+constexpr uint64_t kSeed = 0x8badf00ddeadbeef;
+constexpr double kFudgeFactor = 0.99;
+constexpr double kMinDecibels = -100;
+constexpr double kRangeScaleFactor = 1.0 / 70;
+
+// Not a multiple of the batch size the helper farbles at a time.
+constexpr size_t kLen = 1000;
+constexpr unsigned kInputBufferSize = 1536;
+constexpr unsigned kFftSize = 1024;
+// Makes the window wrap around the end of the ring buffer.
+constexpr unsigned kWriteIndex = 300;
+
+// The per-sample implementation the helper used to have. The helper has to
+// keep producing the same bytes for the same seed.
+class ReferenceFarbler {
+ public:
+  ReferenceFarbler(double fudge_factor, uint64_t seed, bool max)
+      : fudge_factor_(fudge_factor), seed_(seed), max_(max) {}
+
+  void ByteTimeDomainData(const float* input_buffer,
+                          unsigned char* destination,
+                          size_t len,
+                          unsigned write_index,
+                          unsigned fft_size,
+                          unsigned input_buffer_size) const {
+    uint64_t v = seed_;
+    for (size_t i = 0; i < len; ++i) {
+      float value;
+      if (max_) {
+        v = Next(v);
+        value = (v / kMaxUInt64AsDouble) / 10;
+      } else {
+        value = fudge_factor_ *
+                input_buffer[(i + write_index - fft_size + input_buffer_size) %
+                             input_buffer_size];
+      }
+      double scaled_value = 128 * (value + 1);
+      if (scaled_value < 0) {
+        scaled_value = 0;
+      }
+      if (scaled_value > UCHAR_MAX) {
+        scaled_value = UCHAR_MAX;
+      }
+      destination[i] = static_cast<unsigned char>(scaled_value);
+    }
+  }
+
+  void ConvertToByteData(const float* source,
+                         unsigned char* destination,
+                         size_t len,
+                         double min_decibels,
+                         double range_scale_factor) const {
+    uint64_t v = seed_;
+    for (size_t i = 0; i < len; ++i) {
+      float linear_value;
+      if (max_) {
+        v = Next(v);
+        linear_value = (v / kMaxUInt64AsDouble) / 10;
+      } else {
+        linear_value = fudge_factor_ * source[i];
+      }
+      double db_mag = audio_utilities::LinearToDecibels(linear_value);
+      double scaled_value =
+          UCHAR_MAX * (db_mag - min_decibels) * range_scale_factor;
+      if (scaled_value < 0) {
+        scaled_value = 0;
+      }
+      if (scaled_value > UCHAR_MAX) {
+        scaled_value = UCHAR_MAX;
+      }
+      destination[i] = static_cast<unsigned char>(scaled_value);
+    }
+  }
+
+ private:
+  static constexpr double kMaxUInt64AsDouble = static_cast<double>(UINT64_MAX);
+
+  static uint64_t Next(uint64_t v) {
+    constexpr uint64_t zero = 0;
+    return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
+  }
+
+  double fudge_factor_;
+  uint64_t seed_;
+  bool max_;
+};
+
+// A signal that spans the whole byte range, so both clipping bounds are hit.
+std::vector<float> MakeSignal(size_t len) {
+  std::vector<float> signal(len);
+  for (size_t i = 0; i < len; ++i) {
+    signal[i] = 1.2f * std::sin(0.05f * i);
+  }
+  return signal;
+}
+
+}  // namespace
+
+class BraveAudioFarblingHelperTest : public testing::TestWithParam<bool> {
+ protected:
+  bool max() const { return GetParam(); }
+};
+
+TEST_P(BraveAudioFarblingHelperTest, ByteTimeDomainDataMatchesReference) {
+  const std::vector<float> input_buffer = MakeSignal(kInputBufferSize);
+
+  std::vector<unsigned char> expected(kLen);
+  ReferenceFarbler(kFudgeFactor, kSeed, max())
+      .ByteTimeDomainData(input_buffer.data(), expected.data(), kLen,
+                          kWriteIndex, kFftSize, kInputBufferSize);
+
+  std::vector<unsigned char> actual(kLen);
+  BraveAudioFarblingHelper(kFudgeFactor, kSeed, max())
+      .FarbleByteTimeDomainData(input_buffer.data(), actual.data(), kLen,
+                                kWriteIndex, kFftSize, kInputBufferSize);
+
+  EXPECT_EQ(expected, actual);
+}
+
+TEST_P(BraveAudioFarblingHelperTest, ConvertToByteDataMatchesReference) {
+  std::vector<float> source = MakeSignal(kLen);
+  for (float& sample : source) {
+    sample = std::abs(sample);
+  }
+
+  std::vector<unsigned char> expected(kLen);
+  ReferenceFarbler(kFudgeFactor, kSeed, max())
+      .ConvertToByteData(source.data(), expected.data(), kLen, kMinDecibels,
+                         kRangeScaleFactor);
+
+  std::vector<unsigned char> actual(kLen);
+  BraveAudioFarblingHelper(kFudgeFactor, kSeed, max())
+      .FarbleConvertToByteData(source.data(), actual.data(), kLen,
+                               kMinDecibels, kRangeScaleFactor);
+
+  EXPECT_EQ(expected, actual);
+}
+
+INSTANTIATE_TEST_SUITE_P(All,
+                         BraveAudioFarblingHelperTest,
+                         testing::Bool());
+
+}  // namespace blink
@@ -0,0 +1,106 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/platform/brave_canvas_farbling_helper.h"
+
+#include <algorithm>
+
+#include "base/check.h"
+#include "base/containers/span.h"
+#include "base/hash/hash.h"
+#include "base/strings/string_piece.h"
+#include "crypto/hmac.h"
+
+namespace blink {
+namespace {
+
+constexpr uint64_t zero = 0;
+
+inline uint64_t lfsr_next(uint64_t v) {
+  return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
+}
+
+}  // namespace
+
+BraveCanvasFarblingHelper::BraveCanvasFarblingHelper(uint64_t key)
+    : key_(key) {}
+
+BraveCanvasFarblingHelper::~BraveCanvasFarblingHelper() = default;
+
+void BraveCanvasFarblingHelper::PerturbPixels(uint8_t* data, size_t size) {
+  if (!data || size == 0)
+    return;
+
+  for (size_t offset = 0; offset < size; offset += kTileSize) {
+    PerturbTile(data + offset, std::min(kTileSize, size - offset),
+                offset / kTileSize);
+  }
+}
+
+void BraveCanvasFarblingHelper::PerturbTile(uint8_t* pixels,
+                                            size_t size,
+                                            size_t tile_index) {
+  // Four bytes per pixel
+  const size_t pixel_count = size / 4;
+  if (pixel_count == 0)
+    return;
+
+  // The digest covers the tile position and contents. The seed is a keyed
+  // hash of the digest alone, so a memoized seed is always the one that would
+  // be computed again and the result doesn't depend on the cache state.
+  const uint64_t tile_digest =
+      base::HashInts64(base::FastHash(base::make_span(pixels, size)),
+                       static_cast<uint64_t>(tile_index));
+  const TileSeed tile_seed = GetTileSeed(tile_digest);
+
+  uint64_t v = *reinterpret_cast<const uint64_t*>(tile_seed.data());
+  uint64_t pixel_index;
+  // choose which channel (R, G, or B) to perturb
+  uint8_t channel;
+  // iterate through 32-byte tile seed and use each bit to determine how to
+  // perturb the current pixel
+  for (int i = 0; i < 32; i++) {
+    uint8_t bit = tile_seed[i];
+    for (int j = 0; j < 16; j++) {
+      if (j % 8 == 0)
+        bit = tile_seed[i];
+      channel = v % 3;
+      pixel_index = 4 * (v % pixel_count) + channel;
+      pixels[pixel_index] = pixels[pixel_index] ^ (bit & 0x1);
+      bit = bit >> 1;
+      // find next pixel to perturb
+      v = lfsr_next(v);
+    }
+  }
+}
+
+BraveCanvasFarblingHelper::TileSeed BraveCanvasFarblingHelper::GetTileSeed(
+    uint64_t tile_digest) {
+  // Empty and deleted values are reserved by WTF::HashMap, their seeds are
+  // not memoized.
+  const bool cacheable =
+      WTF::HashMap<uint64_t, TileSeed>::IsValidKey(tile_digest);
+  if (cacheable) {
+    auto it = tile_seeds_.find(tile_digest);
+    if (it != tile_seeds_.end())
+      return it->value;
+  }
+
+  TileSeed tile_seed;
+  crypto::HMAC h(crypto::HMAC::SHA256);
+  CHECK(h.Init(reinterpret_cast<const unsigned char*>(&key_), sizeof key_));
+  CHECK(h.Sign(base::StringPiece(reinterpret_cast<const char*>(&tile_digest),
+                                 sizeof tile_digest),
+               tile_seed.data(), tile_seed.size()));
+
+  if (cacheable) {
+    if (tile_seeds_.size() >= kMaxCachedTileSeeds)
+      tile_seeds_.clear();
+    tile_seeds_.insert(tile_digest, tile_seed);
+  }
+  return tile_seed;
+}
+
+}  // namespace blink
@@ -0,0 +1,55 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_PLATFORM_BRAVE_CANVAS_FARBLING_HELPER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_PLATFORM_BRAVE_CANVAS_FARBLING_HELPER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "third_party/blink/renderer/platform/platform_export.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+
+namespace blink {
+
+// Perturbs canvas readbacks. Pixels are split into tiles which are seeded
+// separately, so big canvases that are read back often don't need the whole
+// buffer to be signed on every readback.
+class PLATFORM_EXPORT BraveCanvasFarblingHelper final {
+ public:
+  // Tiles are this many bytes (a multiple of the pixel size).
+  static constexpr size_t kTileSize = 64 * 1024;
+  // Upper bound for memoized tile seeds, the cache is reset once it is full.
+  static constexpr wtf_size_t kMaxCachedTileSeeds = 4096;
+
+  // |key| is the per session and per domain key the perturbation is derived
+  // from.
+  explicit BraveCanvasFarblingHelper(uint64_t key);
+  ~BraveCanvasFarblingHelper();
+
+  // Perturbs |size| bytes of 4 bytes per pixel data in place. The result only
+  // depends on the key and the pixels, not on what was perturbed before.
+  void PerturbPixels(uint8_t* data, size_t size);
+
+  wtf_size_t GetCachedTileSeedsCountForTesting() const {
+    return tile_seeds_.size();
+  }
+
+ private:
+  using TileSeed = std::array<uint8_t, 32>;
+
+  void PerturbTile(uint8_t* pixels, size_t size, size_t tile_index);
+  TileSeed GetTileSeed(uint64_t tile_digest);
+
+  uint64_t key_;
+  // Seeds of already perturbed tiles, keyed by their digest.
+  WTF::HashMap<uint64_t, TileSeed> tile_seeds_;
+};
+
+}  // namespace blink
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_PLATFORM_BRAVE_CANVAS_FARBLING_HELPER_H_
@@ -0,0 +1,118 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/platform/brave_canvas_farbling_helper.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace blink {
+
+namespace {
+
+constexpr uint64_t kKey = 0x8badf00ddeadbeef;
+constexpr uint64_t kOtherKey = 0xdeadbeef8badf00d;
+
+// Two full tiles and a partial one.
+constexpr size_t kPixelsSize = 2 * BraveCanvasFarblingHelper::kTileSize + 400;
+
+std::vector<uint8_t> MakePixels() {
+  std::vector<uint8_t> pixels(kPixelsSize);
+  for (size_t i = 0; i < pixels.size(); ++i) {
+    pixels[i] = static_cast<uint8_t>(i * 31);
+  }
+  return pixels;
+}
+
+std::vector<uint8_t> Perturb(BraveCanvasFarblingHelper& helper,
+                             std::vector<uint8_t> pixels) {
+  helper.PerturbPixels(pixels.data(), pixels.size());
+  return pixels;
+}
+
+}  // namespace
+
+TEST(BraveCanvasFarblingHelperTest, PerturbsPixels) {
+  BraveCanvasFarblingHelper helper(kKey);
+  const std::vector<uint8_t> pixels = MakePixels();
+  EXPECT_NE(Perturb(helper, pixels), pixels);
+}
+
+TEST(BraveCanvasFarblingHelperTest, SameKeyGivesSamePerturbation) {
+  BraveCanvasFarblingHelper helper(kKey);
+  const std::vector<uint8_t> pixels = MakePixels();
+  const std::vector<uint8_t> uncached = Perturb(helper, pixels);
+  EXPECT_EQ(helper.GetCachedTileSeedsCountForTesting(), 3u);
+
+  // Memoized seeds give the same result.
+  EXPECT_EQ(Perturb(helper, pixels), uncached);
+  EXPECT_EQ(helper.GetCachedTileSeedsCountForTesting(), 3u);
+
+  // So does another helper with the same key.
+  BraveCanvasFarblingHelper other_helper(kKey);
+  EXPECT_EQ(Perturb(other_helper, pixels), uncached);
+}
+
+TEST(BraveCanvasFarblingHelperTest, OtherKeyGivesOtherPerturbation) {
+  BraveCanvasFarblingHelper helper(kKey);
+  BraveCanvasFarblingHelper other_helper(kOtherKey);
+  const std::vector<uint8_t> pixels = MakePixels();
+  EXPECT_NE(Perturb(helper, pixels), Perturb(other_helper, pixels));
+}
+
+TEST(BraveCanvasFarblingHelperTest, ResultDoesNotDependOnCacheState) {
+  BraveCanvasFarblingHelper fresh_helper(kKey);
+  const std::vector<uint8_t> pixels = MakePixels();
+  const std::vector<uint8_t> expected = Perturb(fresh_helper, pixels);
+
+  // Fill the cache up to the point it is reset, with other contents.
+  BraveCanvasFarblingHelper helper(kKey);
+  // Every iteration adds seeds for the first two tiles.
+  constexpr size_t kTileSize = BraveCanvasFarblingHelper::kTileSize;
+  for (wtf_size_t i = 0;
+       i < BraveCanvasFarblingHelper::kMaxCachedTileSeeds / 2 + 1; ++i) {
+    std::vector<uint8_t> other_pixels = MakePixels();
+    for (size_t offset : {size_t{0}, kTileSize}) {
+      other_pixels[offset] = static_cast<uint8_t>(i);
+      other_pixels[offset + 1] = static_cast<uint8_t>(i >> 8);
+    }
+    helper.PerturbPixels(other_pixels.data(), other_pixels.size());
+  }
+  EXPECT_LE(helper.GetCachedTileSeedsCountForTesting(),
+            BraveCanvasFarblingHelper::kMaxCachedTileSeeds);
+
+  EXPECT_EQ(Perturb(helper, pixels), expected);
+}
+
+TEST(BraveCanvasFarblingHelperTest, TilesArePerturbedSeparately) {
+  BraveCanvasFarblingHelper helper(kKey);
+  const std::vector<uint8_t> pixels = MakePixels();
+  const std::vector<uint8_t> perturbed = Perturb(helper, pixels);
+
+  // Changing a pixel of the last tile doesn't change how the others are
+  // perturbed.
+  std::vector<uint8_t> changed_pixels = pixels;
+  changed_pixels.back() ^= 0xff;
+  const std::vector<uint8_t> changed_perturbed =
+      Perturb(helper, changed_pixels);
+  const size_t last_tile = 2 * BraveCanvasFarblingHelper::kTileSize;
+  EXPECT_TRUE(std::equal(perturbed.begin(), perturbed.begin() + last_tile,
+                         changed_perturbed.begin()));
+
+  // The same contents at another position are perturbed differently.
+  std::vector<uint8_t> same_tiles(2 * BraveCanvasFarblingHelper::kTileSize);
+  std::fill(same_tiles.begin(), same_tiles.end(), 0x7f);
+  helper.PerturbPixels(same_tiles.data(), same_tiles.size());
+  EXPECT_FALSE(std::equal(
+      same_tiles.begin(),
+      same_tiles.begin() + BraveCanvasFarblingHelper::kTileSize,
+      same_tiles.begin() + BraveCanvasFarblingHelper::kTileSize));
+}
+
+}  // namespace blink
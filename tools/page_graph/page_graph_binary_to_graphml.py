@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+# Copyright (c) 2023 The Brave Authors. All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this file,
+# You can obtain one at https://mozilla.org/MPL/2.0/.
+"""Converts a binary Page Graph export to GraphML.
+
+The binary format is written by GraphBinaryWriter, see
+third_party/blink/renderer/core/brave_page_graph/graph_binary_writer.h.
+"""
+
+import argparse
+import sys
+
+from xml.sax.saxutils import escape, quoteattr
+
+MAGIC = b'PGB'
+FORMAT_VERSION = 1
+
+GRAPHML_PROLOG = (
+    '<?xml version="1.0" encoding="UTF-8"?>\n'
+    '<graphml xmlns="http://graphml.graphdrawing.org/xmlns" '
+    'xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance" '
+    'xsi:schemaLocation="http://graphml.graphdrawing.org/xmlns '
+    'http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd">')
+
+
+class Reader:
+
+  def __init__(self, data: bytes):
+    self.data = data
+    self.pos = 0
+
+  def ReadBytes(self, size: int) -> bytes:
+    if self.pos + size > len(self.data):
+      raise ValueError('Truncated page graph')
+    result = self.data[self.pos:self.pos + size]
+    self.pos += size
+    return result
+
+  def ReadVarint(self) -> int:
+    result = 0
+    shift = 0
+    while True:
+      byte = self.ReadBytes(1)[0]
+      result |= (byte & 0x7f) << shift
+      if not byte & 0x80:
+        return result
+      shift += 7
+
+
+def WriteData(out, reader: Reader, strings: list):
+  for _ in range(reader.ReadVarint()):
+    key = strings[reader.ReadVarint()]
+    value = strings[reader.ReadVarint()]
+    out.write(f'<data key={quoteattr(key)}>{escape(value)}</data>')
+
+
+def Convert(data: bytes, out):
+  reader = Reader(data)
+  if reader.ReadBytes(len(MAGIC)) != MAGIC:
+    raise ValueError('Not a binary page graph')
+  version = reader.ReadBytes(1)[0]
+  if version != FORMAT_VERSION:
+    raise ValueError(f'Unsupported format version {version}')
+
+  strings = []
+  for _ in range(reader.ReadVarint()):
+    strings.append(reader.ReadBytes(reader.ReadVarint()).decode('utf-8'))
+
+  out.write(GRAPHML_PROLOG)
+
+  pg_version = strings[reader.ReadVarint()]
+  about = strings[reader.ReadVarint()]
+  is_root = 'true' if reader.ReadVarint() else 'false'
+  frame_id = strings[reader.ReadVarint()]
+  end_time = reader.ReadVarint()
+  out.write(f'<desc><version>{escape(pg_version)}</version>'
+            f'<about>{escape(about)}</about><is_root>{is_root}</is_root>'
+            f'<frame_id>{escape(frame_id)}</frame_id>'
+            f'<time><start>0</start><end>{end_time}</end></time></desc>')
+
+  for _ in range(reader.ReadVarint()):
+    key_id, key_for, name, key_type = (strings[reader.ReadVarint()]
+                                       for _ in range(4))
+    out.write(f'<key id={quoteattr(key_id)} for={quoteattr(key_for)} '
+              f'attr.name={quoteattr(name)} attr.type={quoteattr(key_type)}/>')
+
+  out.write('<graph id="G" edgedefault="directed">')
+  for _ in range(reader.ReadVarint()):
+    node_id = reader.ReadVarint()
+    out.write(f'<node id="n{node_id}">')
+    WriteData(out, reader, strings)
+    out.write('</node>')
+  for _ in range(reader.ReadVarint()):
+    edge_id = reader.ReadVarint()
+    source = reader.ReadVarint()
+    target = reader.ReadVarint()
+    out.write(f'<edge id="e{edge_id}" source="n{source}" target="n{target}">')
+    WriteData(out, reader, strings)
+    out.write('</edge>')
+  out.write('</graph></graphml>\n')
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__)
+  parser.add_argument('input', help='Binary page graph file')
+  parser.add_argument('output',
+                      nargs='?',
+                      help='GraphML file to write, stdout by default')
+  args = parser.parse_args()
+
+  with open(args.input, 'rb') as f:
+    data = f.read()
+
+  if args.output:
+    with open(args.output, 'w', encoding='utf-8') as out:
+      Convert(data, out)
+  else:
+    Convert(data, sys.stdout)
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())